@@ -32,6 +32,7 @@
 #import "CLLocation+ORKJSONDictionary.h"
 
 #import "ORKHelpers_Internal.h"
+#import "ORKJSONWriter.h"
 
 
 @implementation CLLocation (ORKJSONDictionary)
@@ -70,4 +71,38 @@
     return dictionary;
 }
 
+- (void)ork_writeJSONToWriter:(ORKJSONWriter *)writer {
+    CLLocationCoordinate2D coord = self.coordinate;
+    CLLocationAccuracy horizAccuracy = self.horizontalAccuracy;
+    CLLocationAccuracy vertAccuracy = self.verticalAccuracy;
+    CLLocationDirection course = self.course;
+    CLLocationSpeed speed = self.speed;
+    CLFloor *floor = self.floor;
+    
+    [writer beginObject];
+    [writer writeKey:"timestamp" string:ORKStringFromDateISO8601(self.timestamp)];
+    if (horizAccuracy >= 0) {
+        [writer writeKey:"coordinate"];
+        [writer beginObject];
+        [writer writeKey:"latitude" double:coord.latitude];
+        [writer writeKey:"longitude" double:coord.longitude];
+        [writer endObject];
+        [writer writeKey:"horizontalAccuracy" double:horizAccuracy];
+    }
+    if (vertAccuracy >= 0) {
+        [writer writeKey:"altitude" double:self.altitude];
+        [writer writeKey:"verticalAccuracy" double:vertAccuracy];
+    }
+    if (course >= 0) {
+        [writer writeKey:"course" double:course];
+    }
+    if (speed >= 0) {
+        [writer writeKey:"speed" double:speed];
+    }
+    if (floor) {
+        [writer writeKey:"floor" integer:floor.level];
+    }
+    [writer endObject];
+}
+
 @end
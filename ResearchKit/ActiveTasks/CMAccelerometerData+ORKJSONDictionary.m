@@ -31,6 +31,8 @@
 
 #import "CMAccelerometerData+ORKJSONDictionary.h"
 
+#import "ORKJSONWriter.h"
+
 
 @implementation CMAccelerometerData (ORKJSONDictionary)
 
@@ -43,4 +45,15 @@
     return dictionary;
 }
 
+- (void)ork_writeJSONToWriter:(ORKJSONWriter *)writer {
+    CMAcceleration acceleration = self.acceleration;
+    
+    [writer beginObject];
+    [writer writeKey:"timestamp" double:self.timestamp];
+    [writer writeKey:"x" double:acceleration.x];
+    [writer writeKey:"y" double:acceleration.y];
+    [writer writeKey:"z" double:acceleration.z];
+    [writer endObject];
+}
+
 @end
@@ -34,10 +34,14 @@
 
 NS_ASSUME_NONNULL_BEGIN
 
+@class ORKJSONWriter;
+
 @interface CMDeviceMotion (ORKJSONDictionary)
 
 - (NSDictionary *)ork_JSONDictionary;
 
+- (void)ork_writeJSONToWriter:(ORKJSONWriter *)writer;
+
 @end
 
 NS_ASSUME_NONNULL_END
@@ -31,6 +31,18 @@
 
 #import "CMDeviceMotion+ORKJSONDictionary.h"
 
+#import "ORKJSONWriter.h"
+
+
+static void ORKWriteVector(ORKJSONWriter *writer, const char *key, double x, double y, double z) {
+    [writer writeKey:key];
+    [writer beginObject];
+    [writer writeKey:"x" double:x];
+    [writer writeKey:"y" double:y];
+    [writer writeKey:"z" double:z];
+    [writer endObject];
+}
+
 
 @implementation CMDeviceMotion (ORKJSONDictionary)
 
@@ -73,4 +85,37 @@
     return dictionary;
 }
 
+- (void)ork_writeJSONToWriter:(ORKJSONWriter *)writer {
+    CMQuaternion attitude = self.attitude.quaternion;
+    CMRotationRate rotationRate = self.rotationRate;
+    CMAcceleration gravity = self.gravity;
+    CMAcceleration userAccel = self.userAcceleration;
+    CMCalibratedMagneticField field = self.magneticField;
+    
+    [writer beginObject];
+    [writer writeKey:"timestamp" double:self.timestamp];
+    
+    [writer writeKey:"attitude"];
+    [writer beginObject];
+    [writer writeKey:"x" double:attitude.x];
+    [writer writeKey:"y" double:attitude.y];
+    [writer writeKey:"z" double:attitude.z];
+    [writer writeKey:"w" double:attitude.w];
+    [writer endObject];
+    
+    ORKWriteVector(writer, "rotationRate", rotationRate.x, rotationRate.y, rotationRate.z);
+    ORKWriteVector(writer, "gravity", gravity.x, gravity.y, gravity.z);
+    ORKWriteVector(writer, "userAcceleration", userAccel.x, userAccel.y, userAccel.z);
+    
+    [writer writeKey:"magneticField"];
+    [writer beginObject];
+    [writer writeKey:"x" double:field.field.x];
+    [writer writeKey:"y" double:field.field.y];
+    [writer writeKey:"z" double:field.field.z];
+    [writer writeKey:"accuracy" double:field.accuracy];
+    [writer endObject];
+    
+    [writer endObject];
+}
+
 @end
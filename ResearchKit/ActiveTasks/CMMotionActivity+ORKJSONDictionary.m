@@ -32,6 +32,7 @@
 #import "CMMotionActivity+ORKJSONDictionary.h"
 
 #import "ORKHelpers_Internal.h"
+#import "ORKJSONWriter.h"
 
 
 static NSString *const ActivityUnknown = @"unknown";
@@ -81,4 +82,17 @@ static NSString *const ConfidenceKey = @"confidence";
              StartDateKey: ORKStringFromDateISO8601(self.startDate)};
 }
 
+- (void)ork_writeJSONToWriter:(ORKJSONWriter *)writer {
+    [writer beginObject];
+    [writer writeKey:"confidence" string:stringFromActivityConfidence(self.confidence)];
+    [writer writeKey:"activity"];
+    [writer beginArray];
+    for (NSString *activity in activityArray(self)) {
+        [writer writeString:activity];
+    }
+    [writer endArray];
+    [writer writeKey:"startDate" string:ORKStringFromDateISO8601(self.startDate)];
+    [writer endObject];
+}
+
 @end
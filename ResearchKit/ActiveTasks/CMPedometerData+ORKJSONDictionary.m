@@ -32,6 +32,7 @@
 #import "CMPedometerData+ORKJSONDictionary.h"
 
 #import "ORKHelpers_Internal.h"
+#import "ORKJSONWriter.h"
 
 @import CoreMotion;
 
@@ -46,4 +47,25 @@
     return dictionary;
 }
 
+- (void)ork_writeJSONToWriter:(ORKJSONWriter *)writer {
+    [writer beginObject];
+    [writer writeKey:"startDate" string:ORKStringFromDateISO8601(self.startDate)];
+    [writer writeKey:"endDate" string:ORKStringFromDateISO8601(self.endDate)];
+    [writer writeKey:"numberOfSteps" integer:self.numberOfSteps.longLongValue];
+    // Optional values are omitted when unavailable, as with -setValue:forKey: above
+    if (self.distance) {
+        [writer writeKey:"distance"];
+        [writer writeObject:self.distance];
+    }
+    if (self.floorsAscended) {
+        [writer writeKey:"floorsAscended"];
+        [writer writeObject:self.floorsAscended];
+    }
+    if (self.floorsDescended) {
+        [writer writeKey:"floorsDescended"];
+        [writer writeObject:self.floorsDescended];
+    }
+    [writer endObject];
+}
+
 @end
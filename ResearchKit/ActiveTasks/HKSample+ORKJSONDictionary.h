@@ -34,6 +34,8 @@
 
 NS_ASSUME_NONNULL_BEGIN
 
+@class ORKJSONWriter;
+
 typedef NS_OPTIONS(NSInteger, ORKSampleJSONOptions) {
     ORKSampleIncludeMetadata = 0x1,
     ORKSampleIncludeSource = 0x2,
@@ -47,6 +49,8 @@ typedef NS_OPTIONS(NSInteger, ORKSampleJSONOptions) {
 
 - (NSDictionary *)ork_JSONDictionaryWithOptions:(ORKSampleJSONOptions)options unit:(nullable HKUnit *)unit;
 
+- (void)ork_writeJSONToWriter:(ORKJSONWriter *)writer options:(ORKSampleJSONOptions)options unit:(nullable HKUnit *)unit;
+
 @end
 
 
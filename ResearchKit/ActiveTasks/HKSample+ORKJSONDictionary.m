@@ -32,6 +32,7 @@
 #import "HKSample+ORKJSONDictionary.h"
 
 #import "ORKHelpers_Internal.h"
+#import "ORKJSONWriter.h"
 
 
 static NSString *const HKSampleIdentifierKey = @"type"; // For compatibility with Health XML export
@@ -103,6 +104,46 @@ static NSString *const HKCorrelatedObjectsKey = @"objects";
     return [self ork_JSONMutableDictionaryWithOptions:options unit:unit];
 }
 
+// Writes the same fields as -ork_JSONMutableDictionaryWithOptions:unit:, without building the dictionary
+- (void)ork_writeJSONFieldsToWriter:(ORKJSONWriter *)writer options:(ORKSampleJSONOptions)options unit:(HKUnit *)unit {
+    [writer writeKey:"type" string:[[self sampleType] identifier]];
+    
+    NSDate *startDate = [self startDate];
+    if (startDate) {
+        [writer writeKey:"startDate" string:ORKStringFromDateISO8601(startDate)];
+    }
+    NSDate *endDate = [self endDate];
+    if (endDate) {
+        [writer writeKey:"endDate" string:ORKStringFromDateISO8601(endDate)];
+    }
+    if (unit) {
+        [writer writeKey:"unit" string:[unit unitString]];
+    }
+    if ((options & ORKSampleIncludeUUID)) {
+        NSUUID *uuid = [self UUID];
+        if (uuid) {
+            [writer writeKey:"uuid" string:uuid.UUIDString];
+        }
+    }
+    if ((options & ORKSampleIncludeMetadata) && self.metadata.count > 0) {
+        // NSDate values are written as ISO 8601 strings by the writer
+        [writer writeKey:"metadata"];
+        [writer writeObject:self.metadata];
+    }
+    if (options & ORKSampleIncludeSource) {
+        HKSource *source = [[self sourceRevision] source];
+        if (source.name) {
+            [writer writeKey:"source" string:source.name];
+        }
+    }
+}
+
+- (void)ork_writeJSONToWriter:(ORKJSONWriter *)writer options:(ORKSampleJSONOptions)options unit:(HKUnit *)unit {
+    [writer beginObject];
+    [self ork_writeJSONFieldsToWriter:writer options:options unit:unit];
+    [writer endObject];
+}
+
 @end
 
 
@@ -122,6 +163,13 @@ static NSString *const HKCorrelatedObjectsKey = @"objects";
     return dictionary;
 }
 
+- (void)ork_writeJSONToWriter:(ORKJSONWriter *)writer options:(ORKSampleJSONOptions)options unit:(HKUnit *)unit {
+    [writer beginObject];
+    [self ork_writeJSONFieldsToWriter:writer options:options unit:unit];
+    [writer writeKey:"value" integer:self.value];
+    [writer endObject];
+}
+
 @end
 
 
@@ -143,6 +191,13 @@ static NSString *const HKCorrelatedObjectsKey = @"objects";
     return dictionary;
 }
 
+- (void)ork_writeJSONToWriter:(ORKJSONWriter *)writer options:(ORKSampleJSONOptions)options unit:(HKUnit *)unit {
+    [writer beginObject];
+    [self ork_writeJSONFieldsToWriter:writer options:options unit:unit];
+    [writer writeKey:"value" double:[[self quantity] doubleValueForUnit:unit]];
+    [writer endObject];
+}
+
 @end
 
 
@@ -36,6 +36,8 @@
 #import "ORKRecorder_Internal.h"
 
 #import "ORKHelpers_Internal.h"
+#import "ORKJSONWriter.h"
+#import "ORKMotionSensorHub.h"
 #import "CMAccelerometerData+ORKJSONDictionary.h"
 
 @import CoreMotion;
@@ -44,6 +46,8 @@
 @interface ORKAccelerometerRecorder () {
     ORKDataLogger *_logger;
     NSError *_recordingError;
+    ORKMotionSensorHub *_sensorHub;
+    id _sensorObserver;
 }
 
 @property (nonatomic, strong) CMMotionManager *motionManager;
@@ -81,7 +85,7 @@
 }
 
 - (CMMotionManager *)createMotionManager {
-    return [[CMMotionManager alloc] init];
+    return [ORKMotionSensorHub sharedHub].motionManager;
 }
 
 - (void)start {
@@ -106,16 +110,18 @@
         return;
     }
     
-    self.motionManager.accelerometerUpdateInterval = 1.0 / _frequency;
-    
     self.uptime = [NSProcessInfo processInfo].systemUptime;
     
-    [self.motionManager stopAccelerometerUpdates];
+    // The hub delivers samples on one serial queue, so a single writer can be reused
+    ORKJSONWriter *writer = [ORKJSONWriter new];
     
-    [self.motionManager startAccelerometerUpdatesToQueue:[[NSOperationQueue alloc] init] withHandler:^(CMAccelerometerData *data, NSError *error) {
+    _sensorHub = [ORKMotionSensorHub hubForMotionManager:self.motionManager];
+    _sensorObserver = [_sensorHub addAccelerometerObserverWithFrequency:_frequency handler:^(CMAccelerometerData *data, NSError *error) {
          BOOL success = NO;
          if (data) {
-             success = [_logger append:[data ork_JSONDictionary] error:&error];
+             [writer reset];
+             [data ork_writeJSONToWriter:writer];
+             success = [_logger appendJSONWriter:writer error:&error];
          }
          if (!success) {
              dispatch_async(dispatch_get_main_queue(), ^{
@@ -148,7 +154,9 @@
 
 - (void)doStopRecording {
     if (self.isRecording) {
-        [self.motionManager stopAccelerometerUpdates];
+        [_sensorHub removeObserver:_sensorObserver];
+        _sensorObserver = nil;
+        _sensorHub = nil;
         self.motionManager = nil;
     }
 }
@@ -165,7 +173,7 @@
 }
 
 - (BOOL)isRecording {
-    return self.motionManager.accelerometerActive;
+    return (_sensorObserver != nil);
 }
 
 - (NSString *)mimeType {
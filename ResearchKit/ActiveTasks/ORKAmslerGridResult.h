@@ -30,6 +30,7 @@
 
 
 #import <ResearchKit/ORKResult.h>
+#import <ResearchKit/ORKStroke.h>
 
 NS_ASSUME_NONNULL_BEGIN
 
@@ -62,6 +63,13 @@ ORK_CLASS_AVAILABLE
  */
 @property (nonatomic, copy, nullable) NSArray <UIBezierPath *> *path;
 
+/**
+ The touch samples of each stroke drawn to mark the area, with timing and force.
+ 
+ Strokes are archived with the compact encoding of `+[ORKStroke dataWithStrokes:]`.
+ */
+@property (nonatomic, copy, nullable) NSArray <ORKStroke *> *strokes;
+
 @end
 
 NS_ASSUME_NONNULL_END
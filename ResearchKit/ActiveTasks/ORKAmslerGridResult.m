@@ -54,6 +54,9 @@
     ORK_ENCODE_IMAGE(aCoder, image);
     ORK_ENCODE_OBJ(aCoder, path);
     ORK_ENCODE_ENUM(aCoder, eyeSide);
+    if (_strokes) {
+        [aCoder encodeObject:[ORKStroke dataWithStrokes:_strokes] forKey:@ORK_STRINGIFY(strokes)];
+    }
 }
 
 - (instancetype)initWithCoder:(NSCoder *)aDecoder {
@@ -62,6 +65,10 @@
         ORK_DECODE_IMAGE(aDecoder, image);
         ORK_DECODE_OBJ_ARRAY(aDecoder, path, UIBezierPath);
         ORK_DECODE_ENUM(aDecoder, eyeSide);
+        NSData *strokeData = [aDecoder decodeObjectOfClass:[NSData class] forKey:@ORK_STRINGIFY(strokes)];
+        if (strokeData) {
+            _strokes = [ORKStroke strokesWithData:strokeData error:NULL];
+        }
     }
     return self;
 }
@@ -71,7 +78,7 @@
 }
 
 - (NSUInteger)hash {
-    return super.hash ^ self.image.hash ^ self.path.hash;
+    return super.hash ^ self.image.hash ^ self.path.hash ^ self.strokes.hash;
 }
 
 - (BOOL)isEqual:(id)object {
@@ -81,6 +88,7 @@
     return (isParentSame &&
             ORKEqualObjects(self.image, castObject.image) &&
             ORKEqualObjects(self.path, castObject.path) &&
+            ORKEqualObjects(self.strokes, castObject.strokes) &&
             (self.eyeSide == castObject.eyeSide));
 }
 
@@ -89,6 +97,7 @@
     result->_image = [_image copy];
     result->_path = ORKArrayCopyObjects(_path);
     result->_eyeSide = _eyeSide;
+    result->_strokes = [_strokes copy];
     return result;
 }
 
@@ -186,6 +186,7 @@
     if (_freehandDrawingView.freehandDrawingExists) {
         UIImage *image = [self getImage];
         ORKAmslerGridResult *amslerGridResult = [[ORKAmslerGridResult alloc] initWithIdentifier:self.step.identifier image:image path:_freehandDrawingView.freehandDrawingPath eyeSide: [self amslerGridStep].eyeSide];
+        amslerGridResult.strokes = _freehandDrawingView.strokes;
         parentResult.results = @[amslerGridResult];
     }
 
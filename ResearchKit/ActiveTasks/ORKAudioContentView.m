@@ -71,7 +71,7 @@ static const CGFloat GraphViewRedZoneHeight = 25;
 
 
 @implementation ORKAudioContentView {
-    NSMutableArray *_samples;
+    double _lastSample;
     UIColor *_keyColor;
 }
 
@@ -100,7 +100,7 @@ static const CGFloat GraphViewRedZoneHeight = 25;
         
         self.alertThreshold = GraphViewBlueZoneHeight / ((GraphViewRedZoneHeight * 2) + GraphViewBlueZoneHeight);
         
-        [self updateGraphSamples];
+        [self updateAlertLabelHidden];
         [self applyKeyColor];
         [self setUpConstraints];
     }
@@ -182,7 +182,7 @@ static const CGFloat GraphViewRedZoneHeight = 25;
 - (void)setAlertThreshold:(CGFloat)alertThreshold {
     _alertThreshold = alertThreshold;
     _graphView.alertThreshold = alertThreshold;
-    [self updateGraphSamples];
+    [self updateAlertLabelHidden];
 }
 
 - (void)setTimeLeft:(NSTimeInterval)timeLeft {
@@ -205,14 +205,8 @@ static const CGFloat GraphViewRedZoneHeight = 25;
     _timerLabel.hidden = (string == nil);    
 }
 
-- (void)updateGraphSamples {
-    _graphView.values = _samples;
-    [self updateAlertLabelHidden];
-}
-
 - (void)updateAlertLabelHidden {
-    NSNumber *sample = _samples.lastObject;
-    BOOL show = (!_finished && (sample.doubleValue > _alertThreshold)) || _failed;
+    BOOL show = (!_finished && (_lastSample > _alertThreshold)) || _failed;
     
     if (_alertLabel.hidden && show) {
         UIAccessibilityPostNotification(UIAccessibilityAnnouncementNotification, _alertLabel.text);
@@ -220,27 +214,27 @@ static const CGFloat GraphViewRedZoneHeight = 25;
     _alertLabel.hidden = !show;
 }
 
+- (NSArray *)samples {
+    return _graphView.values;
+}
+
 - (void)setSamples:(NSArray *)samples {
-    _samples = [samples mutableCopy];
-    [self updateGraphSamples];
+    _graphView.values = samples;
+    _lastSample = [samples.lastObject doubleValue];
+    [self updateAlertLabelHidden];
 }
 
 - (void)addSample:(NSNumber *)sample {
     NSAssert(sample != nil, @"Sample should be non-nil");
-    if (!_samples) {
-        _samples = [NSMutableArray array];
-    }
-    [_samples addObject:sample];
-    // Try to keep around 250 samples
-    if (_samples.count > 500) {
-        _samples = [[_samples subarrayWithRange:(NSRange){250, _samples.count - 250}] mutableCopy];
-    }
-    [self updateGraphSamples];
+    [_graphView appendValue:sample.doubleValue];
+    _lastSample = sample.doubleValue;
+    [self updateAlertLabelHidden];
 }
 
 - (void)removeAllSamples {
-    _samples = nil;
-    [self updateGraphSamples];
+    [_graphView removeAllValues];
+    _lastSample = 0;
+    [self updateAlertLabelHidden];
 }
 
 #pragma mark Accessibility
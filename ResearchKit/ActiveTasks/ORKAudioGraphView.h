@@ -37,10 +37,15 @@ NS_ASSUME_NONNULL_BEGIN
 @property (nonatomic, strong) UIColor *keyColor;
 @property (nonatomic, strong) UIColor *alertColor;
 
-@property (nonatomic, copy) NSArray *values;
+/// The most recent values, oldest first. Only as many values as fit in the widest screen are kept.
+@property (nonatomic, copy) NSArray<NSNumber *> *values;
 
 @property (nonatomic) CGFloat alertThreshold;
 
+/// Appends a value at the right edge of the graph, dropping the oldest value once the graph is full.
+- (void)appendValue:(double)value;
+
+- (void)removeAllValues;
 
 @end
 
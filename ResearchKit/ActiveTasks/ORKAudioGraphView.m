@@ -30,6 +30,7 @@
 
 
 #import "ORKAudioGraphView.h"
+#import "ORKRingBuffer.h"
 #import "ORKSkin.h"
 
 
@@ -37,16 +38,22 @@ static const CGFloat ValueLineWidth = 4.5;
 static const CGFloat ValueLineMargin = 1.5;
 static const CGFloat GraphHeight = 150.0;
 
+// More bars than the widest screen can show
+static const NSUInteger MaximumNumberOfValues = 512;
 
-@implementation ORKAudioGraphView
+
+@implementation ORKAudioGraphView {
+    ORKRingBuffer *_valueBuffer;
+}
 
 - (instancetype)initWithFrame:(CGRect)frame {
     self = [super initWithFrame:frame];
     if (self) {
         [self setUpConstraints];
         
+        _valueBuffer = [[ORKRingBuffer alloc] initWithCapacity:MaximumNumberOfValues];
 #if TARGET_IPHONE_SIMULATOR
-        _values = @[ @(0.2), @(0.6), @(0.55), @(0.1), @(0.75), @(0.7) ];
+        self.values = @[ @(0.2), @(0.6), @(0.55), @(0.1), @(0.75), @(0.7) ];
 #endif
     }
     return self;
@@ -65,8 +72,30 @@ static const CGFloat GraphHeight = 150.0;
     [NSLayoutConstraint activateConstraints:@[heightConstraint]];
 }
 
-- (void)setValues:(NSArray *)values {
-    _values = [values copy];
+- (NSArray<NSNumber *> *)values {
+    NSUInteger count = _valueBuffer.count;
+    NSMutableArray<NSNumber *> *values = [NSMutableArray arrayWithCapacity:count];
+    for (NSUInteger index = 0; index < count; index++) {
+        [values addObject:@([_valueBuffer valueAtIndex:index])];
+    }
+    return [values copy];
+}
+
+- (void)setValues:(NSArray<NSNumber *> *)values {
+    [_valueBuffer removeAllValues];
+    for (NSNumber *value in values) {
+        [_valueBuffer appendValue:value.doubleValue];
+    }
+    [self setNeedsDisplay];
+}
+
+- (void)appendValue:(double)value {
+    [_valueBuffer appendValue:value];
+    [self setNeedsDisplay];
+}
+
+- (void)removeAllValues {
+    [_valueBuffer removeAllValues];
     [self setNeedsDisplay];
 }
 
@@ -125,8 +154,9 @@ static const CGFloat GraphHeight = 150.0;
         path1.lineWidth = ValueLineWidth;
         UIBezierPath *path2 = [path1 copy];
         
-        for (NSNumber *value in [_values reverseObjectEnumerator]) {
-            CGFloat floatValue = value.doubleValue;
+        // Draw from the newest value leftwards, only as far as the view is wide
+        for (NSUInteger index = _valueBuffer.count; index > 0; index--) {
+            CGFloat floatValue = [_valueBuffer valueAtIndex:index - 1];
             
             UIBezierPath *path = nil;
             if (floatValue > _alertThreshold) {
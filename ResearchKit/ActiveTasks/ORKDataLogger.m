@@ -32,6 +32,7 @@
 #import "ORKDataLogger.h"
 
 #import "ORKHelpers_Internal.h"
+#import "ORKJSONWriter.h"
 #import "CMMotionActivity+ORKJSONDictionary.h"
 #import "HKSample+ORKJSONDictionary.h"
 
@@ -62,6 +63,13 @@ static NSString *const ORKDataLoggerManagerConfigurationFilename = @".ORKDataLog
 @end
 
 
+@interface ORKJSONLogFormatter ()
+
+- (BOOL)appendItemsData:(NSData *)itemsData fileHandle:(NSFileHandle *)fileHandle error:(NSError **)error;
+
+@end
+
+
 @interface ORKObjectObserver : NSObject
 
 - (instancetype)initWithObject:(id)object keys:(NSArray *)keys selector:(SEL)selector;
@@ -382,22 +390,8 @@ static NSInteger _ORKJSON_terminatorLength = 0;
         }
     }
     
-    // Seek to the end of the file; we'll later backtrack
-    unsigned long long offset = [fileHandle seekToEndOfFile];
-    if (offset == 0) {
-        if (![self beginLogWithFileHandle:fileHandle error:error]) {
-            return NO;
-        }
-        offset = [fileHandle offsetInFile];
-    }
-    
-    unsigned long long checkpoint = [self checkpointWithFileHandle:fileHandle];
-    
-    NSMutableData *outputData = [NSMutableData data];
+    NSMutableData *itemsData = [NSMutableData data];
     NSData *separatorData = [kJSONObjectSeparatorString dataUsingEncoding:NSUTF8StringEncoding];
-    if (offset > _ORKJSON_emptyLogLength) {
-        [outputData appendData:separatorData];
-    }
     
     // Serialize each object separately to the buffer, pending a single write, so the
     // objects form part of a single array.
@@ -413,9 +407,9 @@ static NSInteger _ORKJSON_terminatorLength = 0;
             success = NO;
             *stop = YES;
         } else {
-            [outputData appendData:data];
+            [itemsData appendData:data];
             if (idx + 1 < numObjects) {
-                [outputData appendData:separatorData];
+                [itemsData appendData:separatorData];
             }
         }
     }];
@@ -423,12 +417,36 @@ static NSInteger _ORKJSON_terminatorLength = 0;
         return success;
     }
     
+    return [self appendItemsData:itemsData fileHandle:fileHandle error:error];
+}
+
+/*
+ * Appends already serialized, comma separated JSON items to the log. The caller
+ * is responsible for the validity of `itemsData`.
+ */
+- (BOOL)appendItemsData:(NSData *)itemsData fileHandle:(NSFileHandle *)fileHandle error:(NSError * __autoreleasing *)error {
+    // Seek to the end of the file; we'll later backtrack
+    unsigned long long offset = [fileHandle seekToEndOfFile];
+    if (offset == 0) {
+        if (![self beginLogWithFileHandle:fileHandle error:error]) {
+            return NO;
+        }
+        offset = [fileHandle offsetInFile];
+    }
+    
+    unsigned long long checkpoint = [self checkpointWithFileHandle:fileHandle];
+    
+    NSMutableData *outputData = [NSMutableData dataWithCapacity:itemsData.length + 1 + _ORKJSON_terminatorLength];
+    if (offset > _ORKJSON_emptyLogLength) {
+        [outputData appendData:[kJSONObjectSeparatorString dataUsingEncoding:NSUTF8StringEncoding]];
+    }
+    [outputData appendData:itemsData];
     [outputData appendData:[kJSONLogFooterString dataUsingEncoding:NSUTF8StringEncoding]];
 
     assert(_ORKJSON_terminatorLength < offset);
     [fileHandle seekToFileOffset:(offset - _ORKJSON_terminatorLength)];
     
-    success = [self writeData:outputData fileHandle:fileHandle error:error];
+    BOOL success = [self writeData:outputData fileHandle:fileHandle error:error];
     
     if (!success) {
         [self rollbackToCheckpoint:checkpoint fileHandle:fileHandle];
@@ -639,6 +657,21 @@ static NSInteger _ORKJSON_terminatorLength = 0;
     return success;
 }
 
+- (BOOL)appendJSONWriter:(ORKJSONWriter *)writer error:(NSError * __autoreleasing *)error {
+    if (!writer.itemCount) {
+        @throw [NSException exceptionWithName:NSInvalidArgumentException reason:@"Empty writer" userInfo:nil];
+    }
+    if (![self.logFormatter isKindOfClass:[ORKJSONLogFormatter class]]) {
+        @throw [NSException exceptionWithName:NSInvalidArgumentException reason:@"JSON writer output requires an ORKJSONLogFormatter" userInfo:nil];
+    }
+    NSData *itemsData = writer.data;
+    __block BOOL success = NO;
+    dispatch_sync(_queue, ^{
+        success = [self queue_appendJSONItemsData:itemsData error:error];
+    });
+    return success;
+}
+
 - (BOOL)markFileUploaded:(BOOL)uploaded atURL:(NSURL *)url error:(NSError * __autoreleasing *)error {
     __block BOOL success = NO;
     dispatch_sync(_queue, ^{
@@ -957,6 +990,23 @@ static NSInteger _ORKJSON_terminatorLength = 0;
     return result;
 }
 
+- (BOOL)queue_appendJSONItemsData:(NSData *)itemsData error:(NSError **)error {
+    [self queue_rolloverIfNeeded];
+    
+    NSFileHandle *fileHandle = [self queue_fileHandleWithError:error];
+    if (!fileHandle) {
+        return NO;
+    }
+    
+    BOOL result = [(ORKJSONLogFormatter *)self.logFormatter appendItemsData:itemsData fileHandle:_currentFileHandle error:error];
+    
+    // Quick check to see if we've run over the maximum log file size
+    if ((self.maximumCurrentLogFileSize > 0) && ([_currentFileHandle offsetInFile] >= self.maximumCurrentLogFileSize)) {
+        [self queue_rollover];
+    }
+    return result;
+}
+
 - (BOOL)queue_markFileUploaded:(BOOL)uploaded atURL:(NSURL *)url error:(NSError **)error {
     BOOL success = [url ork_setUploaded:uploaded error:error];
     [self queue_setNeedsUpdateBytes];
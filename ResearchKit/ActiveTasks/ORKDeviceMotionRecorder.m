@@ -36,6 +36,8 @@
 #import "ORKRecorder_Internal.h"
 
 #import "ORKHelpers_Internal.h"
+#import "ORKJSONWriter.h"
+#import "ORKMotionSensorHub.h"
 #import "CMDeviceMotion+ORKJSONDictionary.h"
 
 @import CoreMotion;
@@ -43,6 +45,8 @@
 
 @interface ORKDeviceMotionRecorder () {
     ORKDataLogger *_logger;
+    ORKMotionSensorHub *_sensorHub;
+    id _sensorObserver;
 }
 
 @property (nonatomic, strong) CMMotionManager *motionManager;
@@ -81,7 +85,7 @@
 }
 
 - (CMMotionManager *)createMotionManager {
-    return [[CMMotionManager alloc] init];
+    return [ORKMotionSensorHub sharedHub].motionManager;
 }
 
 - (void)start {
@@ -97,19 +101,27 @@
     }
     
     self.motionManager = [self createMotionManager];
-    self.motionManager.deviceMotionUpdateInterval = 1.0 / _frequency;
     
     self.uptime = [NSProcessInfo processInfo].systemUptime;
     
-    [self.motionManager stopDeviceMotionUpdates];
+    // The hub delivers samples on one serial queue, so a single writer can be reused
+    ORKJSONWriter *writer = [ORKJSONWriter new];
     
-    [self.motionManager startDeviceMotionUpdatesToQueue:[NSOperationQueue mainQueue] withHandler:^(CMDeviceMotion *data, NSError *error) {
+    _sensorHub = [ORKMotionSensorHub hubForMotionManager:self.motionManager];
+    _sensorObserver = [_sensorHub addDeviceMotionObserverWithFrequency:_frequency handler:^(CMDeviceMotion *data, NSError *error) {
          BOOL success = NO;
          if (data) {
-             success = [_logger append:[data ork_JSONDictionary] error:&error];
+             [writer reset];
+             [data ork_writeJSONToWriter:writer];
+             success = [_logger appendJSONWriter:writer error:&error];
              id delegate = self.delegate;
              if ([delegate respondsToSelector:@selector(deviceMotionRecorderDidUpdateWithMotion:)]) {
-                 [delegate deviceMotionRecorderDidUpdateWithMotion:data];
+                 // Delegates update UI, so keep notifying them on the main queue
+                 dispatch_async(dispatch_get_main_queue(), ^{
+                     if (self.isRecording) {
+                         [delegate deviceMotionRecorderDidUpdateWithMotion:data];
+                     }
+                 });
              }
          }
          if (!success) {
@@ -141,7 +153,9 @@
 
 - (void)doStopRecording {
     if (self.isRecording) {
-        [self.motionManager stopDeviceMotionUpdates];
+        [_sensorHub removeObserver:_sensorObserver];
+        _sensorObserver = nil;
+        _sensorHub = nil;
         self.motionManager = nil;
     }
 }
@@ -152,7 +166,7 @@
 }
 
 - (BOOL)isRecording {
-    return self.motionManager.deviceMotionActive;
+    return (_sensorObserver != nil);
 }
 
 - (NSString *)mimeType {
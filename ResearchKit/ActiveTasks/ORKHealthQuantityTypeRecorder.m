@@ -35,6 +35,7 @@
 #import "ORKRecorder_Private.h"
 #import "ORKRecorder_Internal.h"
 #import "HKSample+ORKJSONDictionary.h"
+#import "ORKJSONWriter.h"
 
 
 @interface ORKHealthQuantityTypeRecorder () {
@@ -114,17 +115,17 @@ static const NSInteger _HealthAnchoredQueryLimit = 100;
         return;
     }
     
-    // Do conversion to dictionary on whatever queue we happen to be on.
-    NSMutableArray *dictionaries = [NSMutableArray arrayWithCapacity:resultCount];
-    [results enumerateObjectsUsingBlock:^(HKQuantitySample *sample, NSUInteger idx, BOOL *stop) {
-        [dictionaries addObject:[sample ork_JSONDictionaryWithOptions:ORKSampleIncludeSource|ORKSampleIncludeMetadata unit:_unit]];
-    }];
+    // Do conversion to JSON on whatever queue we happen to be on.
+    ORKJSONWriter *writer = [ORKJSONWriter new];
+    for (HKQuantitySample *sample in results) {
+        [sample ork_writeJSONToWriter:writer options:ORKSampleIncludeSource|ORKSampleIncludeMetadata unit:_unit];
+    }
     
     dispatch_async(dispatch_get_main_queue(), ^{
         [self updateMostRecentSample:results.lastObject];
         
         NSError *error = nil;
-        if (![_logger appendObjects:dictionaries error:&error]) {
+        if (![_logger appendJSONWriter:writer error:&error]) {
             // Logger writes are unrecoverable
             [self finishRecordingWithError:error];
             return;
@@ -0,0 +1,102 @@
+/*
+ Copyright (c) 2026, CareEvolution, Inc.
+ 
+ Redistribution and use in source and binary forms, with or without modification,
+ are permitted provided that the following conditions are met:
+ 
+ 1.  Redistributions of source code must retain the above copyright notice, this
+ list of conditions and the following disclaimer.
+ 
+ 2.  Redistributions in binary form must reproduce the above copyright notice,
+ this list of conditions and the following disclaimer in the documentation and/or
+ other materials provided with the distribution.
+ 
+ 3.  Neither the name of the copyright holder(s) nor the names of any contributors
+ may be used to endorse or promote products derived from this software without
+ specific prior written permission. No license is granted to the trademarks of
+ the copyright holders even if such marks are included in this software.
+ 
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE
+ FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+@import Foundation;
+#import "ORKDataLogger.h"
+
+
+NS_ASSUME_NONNULL_BEGIN
+
+/**
+ The `ORKJSONWriter` class is an internal component that formats JSON directly into a reusable
+ byte buffer, without building intermediate Foundation containers.
+ 
+ Recorders use it to encode samples with a fixed schema. Each top-level value written is one log
+ item; consecutive items are separated automatically, so the buffer can be spliced into the
+ `items` array of an `ORKJSONLogFormatter` log as-is.
+ 
+ Keys are passed as C string literals and are not escaped. Doubles are written with the shortest
+ representation that round-trips; non-finite values are written as `null`.
+ 
+ A writer is not thread safe.
+ */
+@interface ORKJSONWriter : NSObject
+
+/// The number of complete top-level items in the buffer.
+@property (nonatomic, readonly) NSUInteger itemCount;
+
+/// The buffer contents. The returned data is only valid until the writer is next modified.
+@property (nonatomic, readonly) NSData *data;
+
+/// Empties the buffer, keeping its storage for reuse.
+- (void)reset;
+
+/// Empties the buffer without closing any open containers, so long output can be flushed in chunks.
+- (void)discardBufferedBytes;
+
+- (void)beginObject;
+- (void)endObject;
+- (void)beginArray;
+- (void)endArray;
+
+- (void)writeKey:(const char *)key;
+
+/// Writes a key that is escaped like a string value, for keys that are not known in advance.
+- (void)writeEscapedKey:(NSString *)key;
+
+- (void)writeDouble:(double)value;
+- (void)writeInteger:(long long)value;
+- (void)writeBool:(BOOL)value;
+- (void)writeNull;
+- (void)writeString:(NSString *)string;
+
+/// Writes a plist-style value (`NSString`, `NSNumber`, `NSDate`, `NSNull`, `NSArray`, or `NSDictionary`); dates are written as ISO 8601 strings.
+- (void)writeObject:(id)object;
+
+- (void)writeKey:(const char *)key double:(double)value;
+- (void)writeKey:(const char *)key integer:(long long)value;
+- (void)writeKey:(const char *)key string:(NSString *)string;
+
+@end
+
+
+@interface ORKDataLogger (ORKJSONWriter)
+
+/**
+ Appends every item in `writer` to the log as a single write.
+ 
+ The logger must use an `ORKJSONLogFormatter`. The writer is not reset.
+ */
+- (BOOL)appendJSONWriter:(ORKJSONWriter *)writer error:(NSError * _Nullable *)error;
+
+@end
+
+NS_ASSUME_NONNULL_END
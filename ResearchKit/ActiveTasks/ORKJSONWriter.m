@@ -0,0 +1,304 @@
+/*
+ Copyright (c) 2026, CareEvolution, Inc.
+ 
+ Redistribution and use in source and binary forms, with or without modification,
+ are permitted provided that the following conditions are met:
+ 
+ 1.  Redistributions of source code must retain the above copyright notice, this
+ list of conditions and the following disclaimer.
+ 
+ 2.  Redistributions in binary form must reproduce the above copyright notice,
+ this list of conditions and the following disclaimer in the documentation and/or
+ other materials provided with the distribution.
+ 
+ 3.  Neither the name of the copyright holder(s) nor the names of any contributors
+ may be used to endorse or promote products derived from this software without
+ specific prior written permission. No license is granted to the trademarks of
+ the copyright holders even if such marks are included in this software.
+ 
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE
+ FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#import "ORKJSONWriter.h"
+
+#import "ORKHelpers_Internal.h"
+
+#include <xlocale.h>
+
+
+static const NSUInteger ORKJSONWriterMaximumDepth = 32;
+
+/*
+ * Formats a double with the fewest significant digits (up to 17) that parse back to the same value.
+ * Uses the C locale explicitly so the decimal separator is always '.'.
+ */
+static int ORKJSONFormatDouble(char *buffer, size_t size, double value) {
+    int length = 0;
+    for (int precision = 15; precision <= 17; precision++) {
+        length = snprintf_l(buffer, size, NULL, "%.*g", precision, value);
+        if (strtod_l(buffer, NULL, NULL) == value) {
+            break;
+        }
+    }
+    return length;
+}
+
+
+@implementation ORKJSONWriter {
+    NSMutableData *_buffer;
+    NSUInteger _depth;
+    BOOL _hasElement[ORKJSONWriterMaximumDepth + 1];
+    BOOL _expectingValue;
+}
+
+- (instancetype)init {
+    self = [super init];
+    if (self) {
+        _buffer = [NSMutableData dataWithCapacity:1024];
+    }
+    return self;
+}
+
+- (NSData *)data {
+    return _buffer;
+}
+
+- (void)reset {
+    _buffer.length = 0;
+    _depth = 0;
+    _hasElement[0] = NO;
+    _expectingValue = NO;
+    _itemCount = 0;
+}
+
+- (void)discardBufferedBytes {
+    _buffer.length = 0;
+}
+
+- (void)appendBytes:(const char *)bytes length:(NSUInteger)length {
+    [_buffer appendBytes:bytes length:length];
+}
+
+- (void)appendCString:(const char *)string {
+    [_buffer appendBytes:string length:strlen(string)];
+}
+
+- (void)appendCharacter:(char)character {
+    [_buffer appendBytes:&character length:1];
+}
+
+- (void)writeSeparatorIfNeeded {
+    if (_hasElement[_depth]) {
+        [self appendCharacter:','];
+    }
+    _hasElement[_depth] = YES;
+}
+
+- (void)beginValue {
+    if (_expectingValue) {
+        _expectingValue = NO;
+    } else {
+        [self writeSeparatorIfNeeded];
+    }
+}
+
+- (void)endValue {
+    if (_depth == 0) {
+        _itemCount++;
+    }
+}
+
+- (void)beginContainer:(char)opening {
+    [self beginValue];
+    if (_depth >= ORKJSONWriterMaximumDepth) {
+        @throw [NSException exceptionWithName:NSInvalidArgumentException reason:@"JSON nesting too deep" userInfo:nil];
+    }
+    [self appendCharacter:opening];
+    _depth++;
+    _hasElement[_depth] = NO;
+}
+
+- (void)endContainer:(char)closing {
+    NSAssert(_depth > 0 && !_expectingValue, @"Unbalanced JSON container");
+    [self appendCharacter:closing];
+    _depth--;
+    [self endValue];
+}
+
+- (void)beginObject {
+    [self beginContainer:'{'];
+}
+
+- (void)endObject {
+    [self endContainer:'}'];
+}
+
+- (void)beginArray {
+    [self beginContainer:'['];
+}
+
+- (void)endArray {
+    [self endContainer:']'];
+}
+
+- (void)writeKey:(const char *)key {
+    NSAssert(_depth > 0 && !_expectingValue, @"Key written outside of an object");
+    [self writeSeparatorIfNeeded];
+    [self appendCharacter:'"'];
+    [self appendCString:key];
+    [self appendBytes:"\":" length:2];
+    _expectingValue = YES;
+}
+
+- (void)writeEscapedKey:(NSString *)key {
+    NSAssert(_depth > 0 && !_expectingValue, @"Key written outside of an object");
+    [self writeSeparatorIfNeeded];
+    [self writeEscapedString:key];
+    [self appendCharacter:':'];
+    _expectingValue = YES;
+}
+
+- (void)writeEscapedString:(NSString *)string {
+    static const char hexDigits[] = "0123456789abcdef";
+    
+    const char *utf8 = string.UTF8String ? : "";
+    const char *runStart = utf8;
+    const char *cursor = utf8;
+    
+    [self appendCharacter:'"'];
+    for (; *cursor; cursor++) {
+        unsigned char c = (unsigned char)*cursor;
+        if (c >= 0x20 && c != '"' && c != '\\' && c != '/') {
+            continue;
+        }
+        
+        [self appendBytes:runStart length:(cursor - runStart)];
+        runStart = cursor + 1;
+        
+        // Match NSJSONSerialization, which also escapes '/'
+        switch (c) {
+            case '"': [self appendBytes:"\\\"" length:2]; break;
+            case '\\': [self appendBytes:"\\\\" length:2]; break;
+            case '/': [self appendBytes:"\\/" length:2]; break;
+            case '\b': [self appendBytes:"\\b" length:2]; break;
+            case '\f': [self appendBytes:"\\f" length:2]; break;
+            case '\n': [self appendBytes:"\\n" length:2]; break;
+            case '\r': [self appendBytes:"\\r" length:2]; break;
+            case '\t': [self appendBytes:"\\t" length:2]; break;
+            default: {
+                char escape[6] = { '\\', 'u', '0', '0', hexDigits[c >> 4], hexDigits[c & 0xF] };
+                [self appendBytes:escape length:sizeof(escape)];
+                break;
+            }
+        }
+    }
+    [self appendBytes:runStart length:(cursor - runStart)];
+    [self appendCharacter:'"'];
+}
+
+- (void)writeDouble:(double)value {
+    if (!isfinite(value)) {
+        [self writeNull];
+        return;
+    }
+    [self beginValue];
+    char buffer[32];
+    int length = ORKJSONFormatDouble(buffer, sizeof(buffer), value);
+    [self appendBytes:buffer length:length];
+    [self endValue];
+}
+
+- (void)writeInteger:(long long)value {
+    [self beginValue];
+    char buffer[24];
+    int length = snprintf_l(buffer, sizeof(buffer), NULL, "%lld", value);
+    [self appendBytes:buffer length:length];
+    [self endValue];
+}
+
+- (void)writeBool:(BOOL)value {
+    [self beginValue];
+    if (value) {
+        [self appendBytes:"true" length:4];
+    } else {
+        [self appendBytes:"false" length:5];
+    }
+    [self endValue];
+}
+
+- (void)writeNull {
+    [self beginValue];
+    [self appendBytes:"null" length:4];
+    [self endValue];
+}
+
+- (void)writeString:(NSString *)string {
+    [self beginValue];
+    [self writeEscapedString:string];
+    [self endValue];
+}
+
+- (void)writeNumber:(NSNumber *)number {
+    if ((__bridge CFBooleanRef)number == kCFBooleanTrue || (__bridge CFBooleanRef)number == kCFBooleanFalse) {
+        [self writeBool:number.boolValue];
+    } else if (CFNumberIsFloatType((__bridge CFNumberRef)number) || [number isKindOfClass:[NSDecimalNumber class]]) {
+        [self writeDouble:number.doubleValue];
+    } else {
+        [self writeInteger:number.longLongValue];
+    }
+}
+
+- (void)writeObject:(id)object {
+    if ([object isKindOfClass:[NSString class]]) {
+        [self writeString:object];
+    } else if ([object isKindOfClass:[NSNumber class]]) {
+        [self writeNumber:object];
+    } else if ([object isKindOfClass:[NSDate class]]) {
+        [self writeString:ORKStringFromDateISO8601(object)];
+    } else if ([object isKindOfClass:[NSNull class]]) {
+        [self writeNull];
+    } else if ([object isKindOfClass:[NSArray class]]) {
+        [self beginArray];
+        for (id element in (NSArray *)object) {
+            [self writeObject:element];
+        }
+        [self endArray];
+    } else if ([object isKindOfClass:[NSDictionary class]]) {
+        NSDictionary *dictionary = object;
+        [self beginObject];
+        for (id key in dictionary) {
+            [self writeEscapedKey:[key description]];
+            [self writeObject:dictionary[key]];
+        }
+        [self endObject];
+    } else {
+        @throw [NSException exceptionWithName:NSInvalidArgumentException reason:@"ORKJSONWriter accepts property list objects only" userInfo:@{@"object": object}];
+    }
+}
+
+- (void)writeKey:(const char *)key double:(double)value {
+    [self writeKey:key];
+    [self writeDouble:value];
+}
+
+- (void)writeKey:(const char *)key integer:(long long)value {
+    [self writeKey:key];
+    [self writeInteger:value];
+}
+
+- (void)writeKey:(const char *)key string:(NSString *)string {
+    [self writeKey:key];
+    [self writeString:string];
+}
+
+@end
@@ -66,6 +66,27 @@ ORK_CLASS_AVAILABLE
  */
 @property (nonatomic, strong, nullable, readonly) CLLocationManager *locationManager;
 
+/**
+ The minimum distance, in meters, from the last recorded location for a new location to be recorded.
+ 
+ See `ORKLocationRecorderConfiguration`. The default value is 0, which disables distance decimation.
+ */
+@property (nonatomic) CLLocationDistance minimumDistance;
+
+/**
+ The minimum time, in seconds, since the last recorded location for a new location to be recorded.
+ 
+ The default value is 0, which disables time decimation.
+ */
+@property (nonatomic) NSTimeInterval minimumTimeInterval;
+
+/**
+ The largest horizontal accuracy, in meters, that a location may have to be recorded.
+ 
+ The default value is 0, which records locations regardless of their accuracy.
+ */
+@property (nonatomic) CLLocationAccuracy maximumHorizontalAccuracy;
+
 @end
 
 NS_ASSUME_NONNULL_END
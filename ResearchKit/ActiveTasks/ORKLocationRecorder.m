@@ -35,13 +35,25 @@
 
 #import "ORKRecorder_Internal.h"
 
+#import "ORKHelpers_Internal.h"
+#import "ORKJSONWriter.h"
 #import "CLLocation+ORKJSONDictionary.h"
 
 #import <CoreLocation/CoreLocation.h>
+#import <UIKit/UIKit.h>
+
+
+// Locations are buffered and written together, at most this many at a time and at most this long after
+// the first of them was buffered
+static const NSUInteger ORKLocationRecorderMaximumPendingLocations = 16;
+static const NSTimeInterval ORKLocationRecorderMaximumFlushInterval = 10.0;
 
 
 @interface ORKLocationRecorder () <CLLocationManagerDelegate> {
     ORKDataLogger *_logger;
+    ORKJSONWriter *_writer;
+    CLLocation *_lastRecordedLocation;
+    NSTimer *_flushTimer;
     NSError *_recordingError;
     BOOL _started;
 }
@@ -103,10 +115,19 @@
     }
     
     self.uptime = [NSProcessInfo processInfo].systemUptime;
+    _writer = [ORKJSONWriter new];
+    _lastRecordedLocation = nil;
+    [[NSNotificationCenter defaultCenter] addObserver:self
+                                             selector:@selector(applicationDidEnterBackground:)
+                                                 name:UIApplicationDidEnterBackgroundNotification
+                                               object:nil];
     [self.locationManager startUpdatingLocation];
 }
 
 - (void)doStopRecording {
+    [[NSNotificationCenter defaultCenter] removeObserver:self name:UIApplicationDidEnterBackgroundNotification object:nil];
+    [_flushTimer invalidate];
+    _flushTimer = nil;
     [self.locationManager stopUpdatingLocation];
     self.locationManager.delegate = nil;
     self.locationManager = nil;
@@ -114,6 +135,11 @@
 
 - (void)stop {
     [self doStopRecording];
+    
+    NSError *flushError = nil;
+    if (![self flushPendingLocationsWithError:&flushError] && !_recordingError) {
+        _recordingError = flushError;
+    }
     [_logger finishCurrentLog];
     
     NSError *error = _recordingError;
@@ -128,28 +154,89 @@
     [super stop];
 }
 
+- (BOOL)shouldRecordLocation:(CLLocation *)location {
+    CLLocationAccuracy horizontalAccuracy = location.horizontalAccuracy;
+    if (_maximumHorizontalAccuracy > 0 && (horizontalAccuracy < 0 || horizontalAccuracy > _maximumHorizontalAccuracy)) {
+        return NO;
+    }
+    
+    BOOL decimatesByDistance = (_minimumDistance > 0);
+    BOOL decimatesByTime = (_minimumTimeInterval > 0);
+    if (!_lastRecordedLocation || (!decimatesByDistance && !decimatesByTime)) {
+        return YES;
+    }
+    
+    if (decimatesByTime && [location.timestamp timeIntervalSinceDate:_lastRecordedLocation.timestamp] >= _minimumTimeInterval) {
+        return YES;
+    }
+    // Only compare positions when both fixes have a valid coordinate
+    if (decimatesByDistance && horizontalAccuracy >= 0 && _lastRecordedLocation.horizontalAccuracy >= 0 &&
+        [location distanceFromLocation:_lastRecordedLocation] >= _minimumDistance) {
+        return YES;
+    }
+    return NO;
+}
+
+- (BOOL)flushPendingLocationsWithError:(NSError **)error {
+    [_flushTimer invalidate];
+    _flushTimer = nil;
+    if (_writer.itemCount == 0) {
+        return YES;
+    }
+    BOOL success = [_logger appendJSONWriter:_writer error:error];
+    [_writer reset];
+    return success;
+}
+
 - (void)locationManager:(CLLocationManager *)manager
      didUpdateLocations:(NSArray *)locations {
     BOOL success = YES;
     NSParameterAssert(locations.count >= 0);
     NSError *error = nil;
-    if (locations) {
-        NSMutableArray *dictionaries = [NSMutableArray arrayWithCapacity:locations.count];
-        [locations enumerateObjectsUsingBlock:^(CLLocation *obj, NSUInteger idx, BOOL *stop) {
-            NSDictionary *d = [obj ork_JSONDictionary];
-            [dictionaries addObject:d];
-        }];
-        
-        success = [_logger appendObjects:dictionaries error:&error];
+    for (CLLocation *location in locations) {
+        if ([self shouldRecordLocation:location]) {
+            [location ork_writeJSONToWriter:_writer];
+            _lastRecordedLocation = location;
+        }
+    }
+    
+    if (_writer.itemCount >= ORKLocationRecorderMaximumPendingLocations) {
+        success = [self flushPendingLocationsWithError:&error];
+    } else if (_writer.itemCount > 0 && _flushTimer == nil) {
+        // Fixes may stop arriving while the device is stationary, so the deadline needs its own timer
+        _flushTimer = [NSTimer scheduledTimerWithTimeInterval:ORKLocationRecorderMaximumFlushInterval
+                                                       target:self
+                                                     selector:@selector(flushTimerFired:)
+                                                     userInfo:nil
+                                                      repeats:NO];
     }
     if (!success) {
-        dispatch_async(dispatch_get_main_queue(), ^{
-            _recordingError = error;
-            [self stop];
-        });
+        [self stopWithRecordingError:error];
+    }
+}
+
+- (void)flushTimerFired:(NSTimer *)timer {
+    NSError *error = nil;
+    if (![self flushPendingLocationsWithError:&error]) {
+        [self stopWithRecordingError:error];
+    }
+}
+
+- (void)applicationDidEnterBackground:(NSNotification *)notification {
+    // The app may be suspended or terminated without warning from here on
+    NSError *error = nil;
+    if (![self flushPendingLocationsWithError:&error]) {
+        [self stopWithRecordingError:error];
     }
 }
 
+- (void)stopWithRecordingError:(NSError *)error {
+    dispatch_async(dispatch_get_main_queue(), ^{
+        _recordingError = error;
+        [self stop];
+    });
+}
+
 - (void)finishRecordingWithError:(NSError *)error {
     [self doStopRecording];
     [super finishRecordingWithError:nil];
@@ -163,6 +250,8 @@
     [super reset];
     
     _logger = nil;
+    _writer = nil;
+    _lastRecordedLocation = nil;
 }
 
 - (NSString *)mimeType {
@@ -179,14 +268,30 @@
 }
 
 - (ORKRecorder *)recorderForStep:(ORKStep *)step outputDirectory:(NSURL *)outputDirectory {
-    return [[ORKLocationRecorder alloc] initWithIdentifier:self.identifier step:step outputDirectory:outputDirectory];
+    ORKLocationRecorder *recorder = [[ORKLocationRecorder alloc] initWithIdentifier:self.identifier step:step outputDirectory:outputDirectory];
+    recorder.minimumDistance = self.minimumDistance;
+    recorder.minimumTimeInterval = self.minimumTimeInterval;
+    recorder.maximumHorizontalAccuracy = self.maximumHorizontalAccuracy;
+    return recorder;
 }
 
 - (instancetype)initWithCoder:(NSCoder *)aDecoder {
     self = [super initWithCoder:aDecoder];
+    if (self) {
+        ORK_DECODE_DOUBLE(aDecoder, minimumDistance);
+        ORK_DECODE_DOUBLE(aDecoder, minimumTimeInterval);
+        ORK_DECODE_DOUBLE(aDecoder, maximumHorizontalAccuracy);
+    }
     return self;
 }
 
+- (void)encodeWithCoder:(NSCoder *)aCoder {
+    [super encodeWithCoder:aCoder];
+    ORK_ENCODE_DOUBLE(aCoder, minimumDistance);
+    ORK_ENCODE_DOUBLE(aCoder, minimumTimeInterval);
+    ORK_ENCODE_DOUBLE(aCoder, maximumHorizontalAccuracy);
+}
+
 + (BOOL)supportsSecureCoding {
     return YES;
 }
@@ -194,7 +299,11 @@
 - (BOOL)isEqual:(id)object {
     BOOL isParentSame = [super isEqual:object];
     
-    return isParentSame;
+    __typeof(self) castObject = object;
+    return (isParentSame &&
+            (self.minimumDistance == castObject.minimumDistance) &&
+            (self.minimumTimeInterval == castObject.minimumTimeInterval) &&
+            (self.maximumHorizontalAccuracy == castObject.maximumHorizontalAccuracy));
 }
 
 - (ORKPermissionMask)requestedPermissionMask {
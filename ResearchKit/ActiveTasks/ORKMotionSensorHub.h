@@ -0,0 +1,91 @@
+/*
+ Copyright (c) 2026, CareEvolution, Inc.
+ 
+ Redistribution and use in source and binary forms, with or without modification,
+ are permitted provided that the following conditions are met:
+ 
+ 1.  Redistributions of source code must retain the above copyright notice, this
+ list of conditions and the following disclaimer.
+ 
+ 2.  Redistributions in binary form must reproduce the above copyright notice,
+ this list of conditions and the following disclaimer in the documentation and/or
+ other materials provided with the distribution.
+ 
+ 3.  Neither the name of the copyright holder(s) nor the names of any contributors
+ may be used to endorse or promote products derived from this software without
+ specific prior written permission. No license is granted to the trademarks of
+ the copyright holders even if such marks are included in this software.
+ 
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE
+ FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+@import Foundation;
+@import CoreMotion;
+
+
+NS_ASSUME_NONNULL_BEGIN
+
+/**
+ The `ORKMotionSensorHub` class is an internal component that shares one `CMMotionManager` among
+ all the recorders that need motion data.
+ 
+ Each sensor runs once, at the highest frequency any observer has requested, and is stopped when
+ its last observer is removed. Every sample is delivered on a single serial queue; observers that
+ asked for a lower frequency receive a decimated stream, so their timestamps stay aligned with the
+ other observers' samples.
+ 
+ Observers must be added and removed on the main queue. Because removing an observer waits for its
+ handler to return, handlers must not wait synchronously on the main queue.
+ */
+@interface ORKMotionSensorHub : NSObject
+
+/// The hub for the application's shared motion manager.
++ (ORKMotionSensorHub *)sharedHub;
+
+/**
+ Returns the hub driving `motionManager`, creating one if needed.
+ 
+ Returns `sharedHub` for the shared motion manager. Other managers, such as mocks, get their own hub.
+ */
++ (ORKMotionSensorHub *)hubForMotionManager:(CMMotionManager *)motionManager;
+
++ (instancetype)new NS_UNAVAILABLE;
+- (instancetype)init NS_UNAVAILABLE;
+
+@property (nonatomic, strong, readonly) CMMotionManager *motionManager;
+
+/**
+ Starts delivering accelerometer data to `handler` at approximately `frequency` hertz.
+ 
+ @return An opaque observer token to pass to `removeObserver:`.
+ */
+- (id)addAccelerometerObserverWithFrequency:(double)frequency handler:(CMAccelerometerHandler)handler;
+
+/**
+ Starts delivering device motion data to `handler` at approximately `frequency` hertz.
+ 
+ @return An opaque observer token to pass to `removeObserver:`.
+ */
+- (id)addDeviceMotionObserverWithFrequency:(double)frequency handler:(CMDeviceMotionHandler)handler;
+
+/**
+ Stops delivering samples to the observer, stopping the sensor if it was the last one.
+ 
+ When this method returns, the observer's handler is not running and is not called again, even for
+ samples the delivery queue had already received.
+ */
+- (void)removeObserver:(id)observer;
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,282 @@
+/*
+ Copyright (c) 2026, CareEvolution, Inc.
+ 
+ Redistribution and use in source and binary forms, with or without modification,
+ are permitted provided that the following conditions are met:
+ 
+ 1.  Redistributions of source code must retain the above copyright notice, this
+ list of conditions and the following disclaimer.
+ 
+ 2.  Redistributions in binary form must reproduce the above copyright notice,
+ this list of conditions and the following disclaimer in the documentation and/or
+ other materials provided with the distribution.
+ 
+ 3.  Neither the name of the copyright holder(s) nor the names of any contributors
+ may be used to endorse or promote products derived from this software without
+ specific prior written permission. No license is granted to the trademarks of
+ the copyright holders even if such marks are included in this software.
+ 
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE
+ FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#import "ORKMotionSensorHub.h"
+
+#import "ORKHelpers_Internal.h"
+
+
+typedef void (^ORKMotionSensorHandler)(id _Nullable sample, NSError * _Nullable error);
+
+
+@interface ORKMotionSensorObserver : NSObject
+
+- (instancetype)initWithFrequency:(double)frequency handler:(ORKMotionSensorHandler)handler;
+
+@property (nonatomic, readonly) NSTimeInterval interval;
+
+- (void)deliverSample:(id)sample timestamp:(NSTimeInterval)timestamp sensorInterval:(NSTimeInterval)sensorInterval;
+
+- (void)deliverError:(NSError *)error;
+
+- (void)cancel;
+
+@end
+
+
+@implementation ORKMotionSensorObserver {
+    ORKMotionSensorHandler _handler;
+    NSTimeInterval _lastTimestamp;
+    BOOL _cancelled;
+}
+
+- (instancetype)initWithFrequency:(double)frequency handler:(ORKMotionSensorHandler)handler {
+    self = [super init];
+    if (self) {
+        _interval = 1.0 / MAX(frequency, 1.0);
+        _handler = [handler copy];
+        _lastTimestamp = -1;
+    }
+    return self;
+}
+
+/*
+ * Called on the delivery queue only. Observers that run at the sensor's rate get every
+ * sample; slower observers get the first sample at least one of their intervals after the
+ * previous one, allowing half a sensor interval of jitter.
+ *
+ * The handler runs under the same lock as `cancel`, so once `cancel` returns the handler is
+ * neither running nor called again, even for a sample the delivery queue had already dequeued.
+ */
+- (void)deliverSample:(id)sample timestamp:(NSTimeInterval)timestamp sensorInterval:(NSTimeInterval)sensorInterval {
+    @synchronized (self) {
+        if (_cancelled) {
+            return;
+        }
+        if (_interval > sensorInterval && _lastTimestamp >= 0 && (timestamp - _lastTimestamp) < (_interval - sensorInterval / 2)) {
+            return;
+        }
+        _lastTimestamp = timestamp;
+        _handler(sample, nil);
+    }
+}
+
+- (void)deliverError:(NSError *)error {
+    @synchronized (self) {
+        if (!_cancelled) {
+            _handler(nil, error);
+        }
+    }
+}
+
+- (void)cancel {
+    @synchronized (self) {
+        _cancelled = YES;
+    }
+}
+
+@end
+
+
+@interface ORKMotionSensorHub ()
+
+// Replaced wholesale on the main queue and read on the delivery queue
+@property (atomic, copy) NSArray<ORKMotionSensorObserver *> *accelerometerObservers;
+@property (atomic, copy) NSArray<ORKMotionSensorObserver *> *deviceMotionObservers;
+@property (atomic) NSTimeInterval accelerometerInterval;
+@property (atomic) NSTimeInterval deviceMotionInterval;
+
+@end
+
+
+@implementation ORKMotionSensorHub {
+    NSOperationQueue *_queue;
+    BOOL _accelerometerRunning;
+    BOOL _deviceMotionRunning;
+}
+
++ (ORKMotionSensorHub *)sharedHub {
+    static ORKMotionSensorHub *sharedHub = nil;
+    static dispatch_once_t onceToken;
+    dispatch_once(&onceToken, ^{
+        sharedHub = [[ORKMotionSensorHub alloc] initWithMotionManager:[[CMMotionManager alloc] init]];
+    });
+    return sharedHub;
+}
+
++ (ORKMotionSensorHub *)hubForMotionManager:(CMMotionManager *)motionManager {
+    ORKThrowInvalidArgumentExceptionIfNil(motionManager);
+    NSAssert([NSThread isMainThread], @"Motion sensor hubs must be used on the main thread");
+    
+    ORKMotionSensorHub *sharedHub = [self sharedHub];
+    if (motionManager == sharedHub.motionManager) {
+        return sharedHub;
+    }
+    
+    static NSMapTable<CMMotionManager *, ORKMotionSensorHub *> *hubs = nil;
+    if (!hubs) {
+        hubs = [NSMapTable weakToWeakObjectsMapTable];
+    }
+    ORKMotionSensorHub *hub = [hubs objectForKey:motionManager];
+    if (!hub) {
+        hub = [[ORKMotionSensorHub alloc] initWithMotionManager:motionManager];
+        [hubs setObject:hub forKey:motionManager];
+    }
+    return hub;
+}
+
++ (instancetype)new {
+    ORKThrowMethodUnavailableException();
+}
+
+- (instancetype)init {
+    ORKThrowMethodUnavailableException();
+}
+
+- (instancetype)initWithMotionManager:(CMMotionManager *)motionManager {
+    self = [super init];
+    if (self) {
+        _motionManager = motionManager;
+        _queue = [[NSOperationQueue alloc] init];
+        _queue.name = @"ORKMotionSensorHub";
+        _queue.maxConcurrentOperationCount = 1;
+        _accelerometerObservers = @[];
+        _deviceMotionObservers = @[];
+    }
+    return self;
+}
+
+static NSTimeInterval ORKShortestObserverInterval(NSArray<ORKMotionSensorObserver *> *observers) {
+    NSTimeInterval interval = DBL_MAX;
+    for (ORKMotionSensorObserver *observer in observers) {
+        interval = MIN(interval, observer.interval);
+    }
+    return interval;
+}
+
+static void ORKDeliverSample(id sample, NSTimeInterval timestamp, NSError *error, NSArray<ORKMotionSensorObserver *> *observers, NSTimeInterval sensorInterval) {
+    for (ORKMotionSensorObserver *observer in observers) {
+        if (sample) {
+            [observer deliverSample:sample timestamp:timestamp sensorInterval:sensorInterval];
+        } else {
+            [observer deliverError:error];
+        }
+    }
+}
+
+#pragma mark Accelerometer
+
+- (id)addAccelerometerObserverWithFrequency:(double)frequency handler:(CMAccelerometerHandler)handler {
+    NSAssert([NSThread isMainThread], @"Motion sensor hubs must be used on the main thread");
+    ORKMotionSensorObserver *observer = [[ORKMotionSensorObserver alloc] initWithFrequency:frequency handler:handler];
+    self.accelerometerObservers = [self.accelerometerObservers arrayByAddingObject:observer];
+    [self updateAccelerometer];
+    return observer;
+}
+
+- (void)updateAccelerometer {
+    NSArray<ORKMotionSensorObserver *> *observers = self.accelerometerObservers;
+    if (observers.count == 0) {
+        if (_accelerometerRunning) {
+            [_motionManager stopAccelerometerUpdates];
+            _accelerometerRunning = NO;
+        }
+        return;
+    }
+    
+    NSTimeInterval interval = ORKShortestObserverInterval(observers);
+    self.accelerometerInterval = interval;
+    _motionManager.accelerometerUpdateInterval = interval;
+    
+    if (!_accelerometerRunning) {
+        _accelerometerRunning = YES;
+        ORKWeakTypeOf(self) weakSelf = self;
+        [_motionManager startAccelerometerUpdatesToQueue:_queue withHandler:^(CMAccelerometerData *data, NSError *error) {
+            ORKStrongTypeOf(self) strongSelf = weakSelf;
+            ORKDeliverSample(data, data.timestamp, error, strongSelf.accelerometerObservers, strongSelf.accelerometerInterval);
+        }];
+    }
+}
+
+#pragma mark Device motion
+
+- (id)addDeviceMotionObserverWithFrequency:(double)frequency handler:(CMDeviceMotionHandler)handler {
+    NSAssert([NSThread isMainThread], @"Motion sensor hubs must be used on the main thread");
+    ORKMotionSensorObserver *observer = [[ORKMotionSensorObserver alloc] initWithFrequency:frequency handler:handler];
+    self.deviceMotionObservers = [self.deviceMotionObservers arrayByAddingObject:observer];
+    [self updateDeviceMotion];
+    return observer;
+}
+
+- (void)updateDeviceMotion {
+    NSArray<ORKMotionSensorObserver *> *observers = self.deviceMotionObservers;
+    if (observers.count == 0) {
+        if (_deviceMotionRunning) {
+            [_motionManager stopDeviceMotionUpdates];
+            _deviceMotionRunning = NO;
+        }
+        return;
+    }
+    
+    NSTimeInterval interval = ORKShortestObserverInterval(observers);
+    self.deviceMotionInterval = interval;
+    _motionManager.deviceMotionUpdateInterval = interval;
+    
+    if (!_deviceMotionRunning) {
+        _deviceMotionRunning = YES;
+        ORKWeakTypeOf(self) weakSelf = self;
+        [_motionManager startDeviceMotionUpdatesToQueue:_queue withHandler:^(CMDeviceMotion *motion, NSError *error) {
+            ORKStrongTypeOf(self) strongSelf = weakSelf;
+            ORKDeliverSample(motion, motion.timestamp, error, strongSelf.deviceMotionObservers, strongSelf.deviceMotionInterval);
+        }];
+    }
+}
+
+#pragma mark Observers
+
+- (void)removeObserver:(id)observer {
+    NSAssert([NSThread isMainThread], @"Motion sensor hubs must be used on the main thread");
+    // Samples already dequeued for this observer are dropped rather than delivered after removal
+    [(ORKMotionSensorObserver *)observer cancel];
+    if ([self.accelerometerObservers containsObject:observer]) {
+        NSMutableArray *observers = [self.accelerometerObservers mutableCopy];
+        [observers removeObjectIdenticalTo:observer];
+        self.accelerometerObservers = observers;
+        [self updateAccelerometer];
+    } else if ([self.deviceMotionObservers containsObject:observer]) {
+        NSMutableArray *observers = [self.deviceMotionObservers mutableCopy];
+        [observers removeObjectIdenticalTo:observer];
+        self.deviceMotionObservers = observers;
+        [self updateDeviceMotion];
+    }
+}
+
+@end
@@ -36,6 +36,7 @@
 #import "ORKRecorder_Internal.h"
 
 #import "ORKHelpers_Internal.h"
+#import "ORKJSONWriter.h"
 #import "CMPedometerData+ORKJSONDictionary.h"
 
 
@@ -117,7 +118,9 @@
         
         BOOL success = NO;
         if (pedometerData) {
-            success = [_logger append:[pedometerData ork_JSONDictionary] error:&error];
+            ORKJSONWriter *writer = [ORKJSONWriter new];
+            [pedometerData ork_writeJSONToWriter:writer];
+            success = [_logger appendJSONWriter:writer error:&error];
             dispatch_async(dispatch_get_main_queue(), ^{
                 ORKStrongTypeOf(self) strongSelf = weakSelf;
                 [strongSelf updateStatisticsWithData:pedometerData];
@@ -313,11 +313,37 @@ ORK_CLASS_AVAILABLE
  of an `ORKActiveStep` object, include that step in a task, and present it with
  a task view controller.
  
- No additional parameters besides the identifier are required.
+ No additional parameters besides the identifier are required. By default every location
+ delivered by CoreLocation is recorded. To record a decimated stream instead, set
+ `minimumDistance`, `minimumTimeInterval`, or `maximumHorizontalAccuracy`.
  */
 ORK_CLASS_AVAILABLE
 @interface ORKLocationRecorderConfiguration : ORKRecorderConfiguration
 
+/**
+ The minimum distance, in meters, from the last recorded location for a new location to be recorded.
+ 
+ When both `minimumDistance` and `minimumTimeInterval` are set, a location is recorded if it
+ satisfies either of them, so stationary periods are still sampled. The default value is 0,
+ which disables distance decimation.
+ */
+@property (nonatomic) double minimumDistance;
+
+/**
+ The minimum time, in seconds, since the last recorded location for a new location to be recorded.
+ 
+ The default value is 0, which disables time decimation.
+ */
+@property (nonatomic) NSTimeInterval minimumTimeInterval;
+
+/**
+ The largest horizontal accuracy, in meters, that a location may have to be recorded.
+ 
+ Locations with a larger or invalid horizontal accuracy are discarded. The default value is 0,
+ which records locations regardless of their accuracy.
+ */
+@property (nonatomic) double maximumHorizontalAccuracy;
+
 /**
  Returns an initialized location recorder configuration.
  
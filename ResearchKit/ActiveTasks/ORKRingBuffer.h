@@ -1,5 +1,5 @@
 /*
- Copyright (c) 2015, Apple Inc. All rights reserved.
+ Copyright (c) 2026, CareEvolution, Inc.
  
  Redistribution and use in source and binary forms, with or without modification,
  are permitted provided that the following conditions are met:
@@ -34,42 +34,30 @@
 
 NS_ASSUME_NONNULL_BEGIN
 
-typedef _Nullable id (^ORKESerializationPropertyGetter)(NSDictionary *dict, NSString *property);
-typedef _Nullable id (^ORKESerializationInitBlock)(NSDictionary *dict, ORKESerializationPropertyGetter getter);
-typedef _Nullable id (^ORKESerializationObjectToJSONBlock)(id object);
-typedef _Nullable id (^ORKESerializationJSONToObjectBlock)(id jsonObject);
-
-
-@interface ORKESerializer : NSObject
-
-+ (nullable NSDictionary *)JSONObjectForObject:(id)object error:(NSError **)error;
-
-+ (nullable NSData *)JSONDataForObject:(id)object error:(NSError **)error;
-
-+ (nullable id)objectFromJSONObject:(NSDictionary *)object error:(NSError **)error;
+/**
+ The `ORKRingBuffer` class is an internal fixed-capacity store of double values, used to keep the
+ most recent samples of a live display.
+ 
+ Appending to a full buffer overwrites the oldest value, so the memory used and the cost of every
+ operation stay constant for the whole recording. Index 0 is the oldest value.
+ */
+@interface ORKRingBuffer : NSObject
 
-+ (nullable id)objectFromJSONData:(NSData *)data error:(NSError **)error;
+- (instancetype)initWithCapacity:(NSUInteger)capacity NS_DESIGNATED_INITIALIZER;
 
-+ (NSArray *)serializableClasses;
++ (instancetype)new NS_UNAVAILABLE;
+- (instancetype)init NS_UNAVAILABLE;
 
-@end
+@property (nonatomic, readonly) NSUInteger capacity;
 
+@property (nonatomic, readonly) NSUInteger count;
 
-@interface ORKESerializer (Registration)
+- (void)appendValue:(double)value;
 
-+ (void)registerSerializableClass:(Class)serializableClass
-                        initBlock:(nullable ORKESerializationInitBlock)initBlock;
+- (double)valueAtIndex:(NSUInteger)index;
 
-+ (void)registerSerializableClassPropertyName:(NSString *)propertyName
-                                     forClass:(Class)serializableClass
-                                   valueClass:(Class)valueClass
-                               containerClass:(nullable Class)containerClass
-                               writeAfterInit:(BOOL)writeAfterInit
-                            objectToJSONBlock:(nullable ORKESerializationObjectToJSONBlock)objectToJSON
-                            jsonToObjectBlock:(nullable ORKESerializationJSONToObjectBlock)jsonToObjectBlock;
+- (void)removeAllValues;
 
 @end
 
-
 NS_ASSUME_NONNULL_END
-
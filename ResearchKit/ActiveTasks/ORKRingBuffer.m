@@ -0,0 +1,87 @@
+/*
+ Copyright (c) 2026, CareEvolution, Inc.
+ 
+ Redistribution and use in source and binary forms, with or without modification,
+ are permitted provided that the following conditions are met:
+ 
+ 1.  Redistributions of source code must retain the above copyright notice, this
+ list of conditions and the following disclaimer.
+ 
+ 2.  Redistributions in binary form must reproduce the above copyright notice,
+ this list of conditions and the following disclaimer in the documentation and/or
+ other materials provided with the distribution.
+ 
+ 3.  Neither the name of the copyright holder(s) nor the names of any contributors
+ may be used to endorse or promote products derived from this software without
+ specific prior written permission. No license is granted to the trademarks of
+ the copyright holders even if such marks are included in this software.
+ 
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE
+ FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#import "ORKRingBuffer.h"
+
+#import "ORKHelpers_Internal.h"
+
+
+@implementation ORKRingBuffer {
+    NSMutableData *_data;
+    NSUInteger _start;
+}
+
++ (instancetype)new {
+    ORKThrowMethodUnavailableException();
+}
+
+- (instancetype)init {
+    ORKThrowMethodUnavailableException();
+}
+
+- (instancetype)initWithCapacity:(NSUInteger)capacity {
+    if (capacity == 0) {
+        @throw [NSException exceptionWithName:NSInvalidArgumentException reason:@"capacity must be greater than 0" userInfo:nil];
+    }
+    self = [super init];
+    if (self) {
+        _capacity = capacity;
+        _data = [NSMutableData dataWithLength:capacity * sizeof(double)];
+    }
+    return self;
+}
+
+- (void)appendValue:(double)value {
+    double *values = _data.mutableBytes;
+    values[(_start + _count) % _capacity] = value;
+    if (_count < _capacity) {
+        _count++;
+    } else {
+        _start = (_start + 1) % _capacity;
+    }
+}
+
+- (double)valueAtIndex:(NSUInteger)index {
+    if (index >= _count) {
+        @throw [NSException exceptionWithName:NSRangeException
+                                       reason:[NSString stringWithFormat:@"index %lu beyond bounds [0 .. %lu]", (unsigned long)index, (unsigned long)_count]
+                                     userInfo:nil];
+    }
+    const double *values = _data.bytes;
+    return values[(_start + index) % _capacity];
+}
+
+- (void)removeAllValues {
+    _start = 0;
+    _count = 0;
+}
+
+@end
@@ -51,7 +51,6 @@
 
 
 @implementation ORKSpeechInNoiseContentView {
-    NSMutableArray *_samples;
     UIColor *_alertColor;
     ORKSubheadlineLabel *_textLabel;
 }
@@ -65,7 +64,6 @@
         [self setupGraphView];
         [self setupPlayButton];
         [self setupTextLabel];
-        [self updateGraphSamples];
         [self applyAlertColor];
         [self setUpConstraints];
     }
@@ -161,27 +159,14 @@
     [NSLayoutConstraint activateConstraints:constraints];
 }
 
-- (void)updateGraphSamples {
-    _graphView.values = _samples;
-}
-
 - (void)addSample:(NSNumber *)sample {
     NSAssert(sample != nil, @"Sample should be non-nil");
-    if (!_samples) {
-        _samples = [NSMutableArray array];
-    }
-    [_samples addObject:sample];
-    // Try to keep around 250 samples
-    if (_samples.count > 500) {
-        _samples = [[_samples subarrayWithRange:(NSRange){250, _samples.count - 250}] mutableCopy];
-    }
-    [self updateGraphSamples];
+    [_graphView appendValue:sample.doubleValue];
 }
 
 
 - (void)removeAllSamples {
-    _samples = nil;
-    [self updateGraphSamples];
+    [_graphView removeAllValues];
 }
 
 @end
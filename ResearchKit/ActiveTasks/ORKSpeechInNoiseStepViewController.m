@@ -63,8 +63,62 @@
 
 @end
 
+// Decoded bundled audio files by file name. Cached buffers are never modified, so they can be decoded
+// ahead of presentation on a background queue and shared between view controllers.
+static NSCache<NSString *, AVAudioPCMBuffer *> *ORKSpeechInNoiseAudioBufferCache() {
+    static NSCache<NSString *, AVAudioPCMBuffer *> *cache = nil;
+    static dispatch_once_t onceToken;
+    dispatch_once(&onceToken, ^{
+        cache = [NSCache new];
+    });
+    return cache;
+}
+
+static AVAudioPCMBuffer *ORKSpeechInNoiseDecodedAudioBuffer(NSString *file) {
+    if (file.length == 0) {
+        return nil;
+    }
+    
+    NSCache<NSString *, AVAudioPCMBuffer *> *cache = ORKSpeechInNoiseAudioBufferCache();
+    AVAudioPCMBuffer *buffer = [cache objectForKey:file];
+    if (buffer) {
+        return buffer;
+    }
+    
+    NSURL *fileURL = [[NSBundle bundleForClass:[ORKSpeechInNoiseStepViewController class]] URLForResource:[file stringByDeletingPathExtension] withExtension:[file pathExtension]];
+    AVAudioFile *audioFile = [[AVAudioFile alloc] initForReading:fileURL error:nil];
+    if (!audioFile) {
+        return nil;
+    }
+    
+    buffer = [[AVAudioPCMBuffer alloc] initWithPCMFormat:audioFile.processingFormat frameCapacity:(AVAudioFrameCount)audioFile.length];
+    if (![audioFile readIntoBuffer:buffer error:nil]) {
+        return nil;
+    }
+    [cache setObject:buffer forKey:file cost:buffer.frameLength * buffer.format.streamDescription->mBytesPerFrame * buffer.format.channelCount];
+    return buffer;
+}
+
+static AVAudioPCMBuffer *ORKSpeechInNoiseCopyAudioBuffer(AVAudioPCMBuffer *buffer) {
+    AVAudioPCMBuffer *copy = [[AVAudioPCMBuffer alloc] initWithPCMFormat:buffer.format frameCapacity:buffer.frameLength];
+    copy.frameLength = buffer.frameLength;
+    const AudioBufferList *source = buffer.audioBufferList;
+    AudioBufferList *destination = copy.mutableAudioBufferList;
+    for (UInt32 index = 0; index < source->mNumberBuffers; index++) {
+        memcpy(destination->mBuffers[index].mData, source->mBuffers[index].mData, source->mBuffers[index].mDataByteSize);
+    }
+    return copy;
+}
+
 @implementation ORKSpeechInNoiseStepViewController
 
++ (void)prefetchResourcesForStep:(ORKStep *)step {
+    ORKSpeechInNoiseStep *speechInNoiseStep = ORKDynamicCast(step, ORKSpeechInNoiseStep);
+    ORKSpeechInNoiseDecodedAudioBuffer(speechInNoiseStep.speechFileNameWithExtension);
+    ORKSpeechInNoiseDecodedAudioBuffer(speechInNoiseStep.noiseFileNameWithExtension);
+    ORKSpeechInNoiseDecodedAudioBuffer(speechInNoiseStep.filterFileNameWithExtension);
+}
+
 - (void)viewDidLoad {
     [super viewDidLoad];
     
@@ -122,26 +176,19 @@
 }
 
 - (void)loadFileName: (NSString *)file intoBuffer: (AVAudioPCMBuffer * __strong *)buffer {
-    NSArray *fileComponents = [file componentsSeparatedByString:@"."];
-    NSString *fileName = fileComponents[0];
-    NSString *fileExtension = fileComponents[1];
-    
-    NSURL *fileURL = [[NSBundle bundleForClass:[self class]] URLForResource:fileName withExtension:fileExtension];
-    
-    AVAudioFile *audioFile = [[AVAudioFile alloc] initForReading:fileURL error:nil];
-    AVAudioFormat *audioFileFormat = audioFile.processingFormat;
-    AVAudioFrameCount audioFileCapacity = (AVAudioFrameCount)audioFile.length;
+    AVAudioPCMBuffer *decodedBuffer = ORKSpeechInNoiseDecodedAudioBuffer(file);
+    AVAudioFrameCount audioFileCapacity = decodedBuffer.frameLength;
     if (*buffer == _filterAudioBuffer) {
         _speechToneCapacity = audioFileCapacity;
+        *buffer = decodedBuffer;
     } else if (*buffer == _noiseAudioBuffer) {
         _noiseToneCapacity = audioFileCapacity;
+        *buffer = decodedBuffer;
     } else {
-        AVAsset *asset = [AVURLAsset URLAssetWithURL:fileURL options:nil];
-        CMTime audioDuration = asset.duration;
-        _toneDuration = CMTimeGetSeconds(audioDuration);
+        _toneDuration = decodedBuffer ? audioFileCapacity / decodedBuffer.format.sampleRate : 0;
+        // The speech samples are mixed with noise in place, so they get a private copy of the cached buffer.
+        *buffer = decodedBuffer ? ORKSpeechInNoiseCopyAudioBuffer(decodedBuffer) : nil;
     }
-    *buffer = [[AVAudioPCMBuffer alloc] initWithPCMFormat:audioFileFormat frameCapacity:audioFileCapacity];
-    [audioFile readIntoBuffer:*buffer error:nil];
 }
 
 - (void)installTap {
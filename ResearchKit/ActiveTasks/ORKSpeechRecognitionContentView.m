@@ -51,7 +51,6 @@
 
 
 @implementation ORKSpeechRecognitionContentView {
-    NSMutableArray *_samples;
     UIColor *_keyColor;
     UIImageView *_imageView;
     UILabel *_textLabel;
@@ -68,7 +67,6 @@
         [self setupRecordButton];
         [self setupImageView];
         [self setupTextLabel];
-        [self updateGraphSamples];
         [self applyKeyColor];
         [self setUpConstraints];
     }
@@ -221,21 +219,9 @@
     }
 }
 
-- (void)updateGraphSamples {
-    _graphView.values = _samples;
-}
-
 - (void)addSample:(NSNumber *)sample {
     NSAssert(sample != nil, @"Sample should be non-nil");
-    if (!_samples) {
-        _samples = [NSMutableArray array];
-    }
-    [_samples addObject:sample];
-    // Try to keep around 250 samples
-    if (_samples.count > 500) {
-        _samples = [[_samples subarrayWithRange:(NSRange){250, _samples.count - 250}] mutableCopy];
-    }
-    [self updateGraphSamples];
+    [_graphView appendValue:sample.doubleValue];
 }
 
 - (void)updateRecognitionText:(NSString *)recognitionText {
@@ -250,8 +236,7 @@
 }
 
 - (void)removeAllSamples {
-    _samples = nil;
-    [self updateGraphSamples];
+    [_graphView removeAllValues];
 }
 
 @end
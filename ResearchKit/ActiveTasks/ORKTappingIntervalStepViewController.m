@@ -38,6 +38,7 @@
 
 #import "ORKActiveStepViewController_Internal.h"
 #import "ORKStepViewController_Internal.h"
+#import "ORKTappingIntervalStepViewController_Internal.h"
 
 #import "ORKActiveStepView.h"
 #import "ORKCollectionResult_Private.h"
@@ -47,9 +48,10 @@
 #import "ORKHelpers_Internal.h"
 
 
-@interface ORKTappingIntervalStepViewController () <UIGestureRecognizerDelegate>
+static const NSUInteger ORKTappingSampleInitialCapacity = 256;
+
 
-@property (nonatomic, strong) NSMutableArray *samples;
+@interface ORKTappingIntervalStepViewController () <UIGestureRecognizerDelegate>
 
 @end
 
@@ -65,6 +67,22 @@
     
     NSUInteger _hitButtonCount;
     
+    /*
+     * Samples are stored as parallel arrays rather than as `ORKTappingSample` objects, so
+     * recording a tap does not allocate once the buffers have grown. The buffers are nil
+     * until the first tap on a button.
+     */
+    NSUInteger _sampleCount;
+    NSMutableData *_sampleTimestamps;
+    NSMutableData *_sampleDurations;
+    NSMutableData *_sampleLocations;
+    NSMutableData *_sampleButtonIdentifiers;
+    NSArray<ORKTappingSample *> *_samples;
+    
+    // Indexes of the samples still held down on each button, most recent last
+    NSMutableIndexSet *_pendingLeftSampleIndexes;
+    NSMutableIndexSet *_pendingRightSampleIndexes;
+    
     UIGestureRecognizer *_touchDownRecognizer;
 }
 
@@ -133,7 +151,7 @@
     tappingResult.buttonRect2 = _buttonRect2;
     tappingResult.stepViewSize = _viewSize;
     
-    tappingResult.samples = _samples;
+    tappingResult.samples = [self samples];
     
     [results addObject:tappingResult];
     sResult.results = [results copy];
@@ -141,8 +159,92 @@
     return sResult;
 }
 
+#pragma mark Sample buffers
+
+- (BOOL)isRecordingSamples {
+    return (_sampleTimestamps != nil);
+}
+
+- (void)resetSamples {
+    _sampleCount = 0;
+    _sampleTimestamps = [NSMutableData dataWithCapacity:ORKTappingSampleInitialCapacity * sizeof(NSTimeInterval)];
+    _sampleDurations = [NSMutableData dataWithCapacity:ORKTappingSampleInitialCapacity * sizeof(NSTimeInterval)];
+    _sampleLocations = [NSMutableData dataWithCapacity:ORKTappingSampleInitialCapacity * sizeof(CGPoint)];
+    _sampleButtonIdentifiers = [NSMutableData dataWithCapacity:ORKTappingSampleInitialCapacity * sizeof(ORKTappingButtonIdentifier)];
+    _pendingLeftSampleIndexes = [NSMutableIndexSet indexSet];
+    _pendingRightSampleIndexes = [NSMutableIndexSet indexSet];
+    _samples = nil;
+}
+
+- (NSMutableIndexSet *)pendingSampleIndexesForButton:(ORKTappingButtonIdentifier)buttonIdentifier {
+    switch (buttonIdentifier) {
+        case ORKTappingButtonIdentifierLeft:
+            return _pendingLeftSampleIndexes;
+        case ORKTappingButtonIdentifierRight:
+            return _pendingRightSampleIndexes;
+        case ORKTappingButtonIdentifierNone:
+            return nil;
+    }
+}
+
+- (void)appendSampleWithButton:(ORKTappingButtonIdentifier)buttonIdentifier location:(CGPoint)location timestamp:(NSTimeInterval)timestamp {
+    NSTimeInterval duration = 0;
+    [_sampleTimestamps appendBytes:&timestamp length:sizeof(timestamp)];
+    [_sampleDurations appendBytes:&duration length:sizeof(duration)];
+    [_sampleLocations appendBytes:&location length:sizeof(location)];
+    [_sampleButtonIdentifiers appendBytes:&buttonIdentifier length:sizeof(buttonIdentifier)];
+    [[self pendingSampleIndexesForButton:buttonIdentifier] addIndex:_sampleCount];
+    _sampleCount++;
+    _samples = nil;
+}
+
+/*
+ * Fills the duration of the most recent sample still held down on the button, which is the
+ * sample the release belongs to. `mediaTime` is in system uptime, like `UITouch` timestamps.
+ */
+- (void)completePendingSampleForButton:(ORKTappingButtonIdentifier)buttonIdentifier mediaTime:(NSTimeInterval)mediaTime {
+    NSMutableIndexSet *pendingIndexes = [self pendingSampleIndexesForButton:buttonIdentifier];
+    if (pendingIndexes == nil) {
+        // Taps outside the buttons are never held down
+        return;
+    }
+    NSUInteger index = pendingIndexes.lastIndex;
+    if (index == NSNotFound) {
+        return;
+    }
+    [pendingIndexes removeIndex:index];
+    
+    const NSTimeInterval *timestamps = _sampleTimestamps.bytes;
+    NSTimeInterval *durations = _sampleDurations.mutableBytes;
+    durations[index] = mediaTime - timestamps[index] - _tappingStart;
+    _samples = nil;
+}
+
+- (NSArray<ORKTappingSample *> *)samples {
+    if (!_samples && [self isRecordingSamples]) {
+        const NSTimeInterval *timestamps = _sampleTimestamps.bytes;
+        const NSTimeInterval *durations = _sampleDurations.bytes;
+        const CGPoint *locations = _sampleLocations.bytes;
+        const ORKTappingButtonIdentifier *buttonIdentifiers = _sampleButtonIdentifiers.bytes;
+        
+        NSMutableArray<ORKTappingSample *> *samples = [NSMutableArray arrayWithCapacity:_sampleCount];
+        for (NSUInteger i = 0; i < _sampleCount; i++) {
+            ORKTappingSample *sample = [[ORKTappingSample alloc] init];
+            sample.buttonIdentifier = buttonIdentifiers[i];
+            sample.location = locations[i];
+            sample.duration = durations[i];
+            sample.timestamp = timestamps[i];
+            [samples addObject:sample];
+        }
+        _samples = [samples copy];
+    }
+    return _samples;
+}
+
+#pragma mark Touches
+
 - (void)receiveTouch:(UITouch *)touch onButton:(ORKTappingButtonIdentifier)buttonIdentifier {
-    if (_expired || self.samples == nil) {
+    if (_expired || ![self isRecordingSamples]) {
         return;
     }
     
@@ -157,13 +259,7 @@
     // Add new sample
     mediaTime = mediaTime-_tappingStart;
     
-    ORKTappingSample *sample = [[ORKTappingSample alloc] init];
-    sample.buttonIdentifier = buttonIdentifier;
-    sample.location = location;
-    sample.duration = 0;
-    sample.timestamp = mediaTime;
-
-    [self.samples addObject:sample];
+    [self appendSampleWithButton:buttonIdentifier location:location timestamp:mediaTime];
     
     if (buttonIdentifier == ORKTappingButtonIdentifierLeft || buttonIdentifier == ORKTappingButtonIdentifierRight) {
         _hitButtonCount++;
@@ -181,24 +277,12 @@
 }
 
 - (void)releaseTouch:(UITouch *)touch onButton:(ORKTappingButtonIdentifier)buttonIdentifier {
-    if (self.samples == nil) {
+    if (![self isRecordingSamples]) {
         return;
     }
-    NSTimeInterval mediaTime = touch.timestamp;
     
     // Take last sample for buttonIdentifier, and fill duration
-    ORKTappingSample *sample = [self lastSampleWithEmptyDurationForButton:buttonIdentifier];
-    sample.duration = mediaTime - sample.timestamp - _tappingStart;
-}
-
-- (ORKTappingSample *)lastSampleWithEmptyDurationForButton:(ORKTappingButtonIdentifier)buttonIdentifier{
-    NSEnumerator *enumerator = [self.samples reverseObjectEnumerator];
-    for (ORKTappingSample *sample in enumerator) {
-        if (sample.buttonIdentifier == buttonIdentifier && sample.duration == 0) {
-            return sample;
-        }
-    }
-    return nil;
+    [self completePendingSampleForButton:buttonIdentifier mediaTime:touch.timestamp];
 }
 
 - (void)fillSampleDurationIfAnyButtonPressed {
@@ -210,15 +294,8 @@
      */
     NSTimeInterval mediaTime = [[NSProcessInfo processInfo] systemUptime];
     
-    ORKTappingSample *tapButton1LastSample = [self lastSampleWithEmptyDurationForButton:ORKTappingButtonIdentifierLeft];
-    if (tapButton1LastSample) {
-        tapButton1LastSample.duration = mediaTime - tapButton1LastSample.timestamp - _tappingStart;
-    }
-    
-    ORKTappingSample *tapButton2LastSample = [self lastSampleWithEmptyDurationForButton:ORKTappingButtonIdentifierRight];
-    if (tapButton2LastSample) {
-        tapButton2LastSample.duration = mediaTime - tapButton2LastSample.timestamp - _tappingStart;
-    }
+    [self completePendingSampleForButton:ORKTappingButtonIdentifierLeft mediaTime:mediaTime];
+    [self completePendingSampleForButton:ORKTappingButtonIdentifierRight mediaTime:mediaTime];
 }
 
 - (void)stepDidFinish {
@@ -265,9 +342,9 @@
         }
     }
     
-    if (self.samples == nil) {
+    if (![self isRecordingSamples]) {
         // Start timer on first touch event on button
-        _samples = [NSMutableArray array];
+        [self resetSamples];
         _hitButtonCount = 0;
         [self start];
     }
@@ -0,0 +1,53 @@
+/*
+ Copyright (c) 2026, CareEvolution, Inc.
+ 
+ Redistribution and use in source and binary forms, with or without modification,
+ are permitted provided that the following conditions are met:
+ 
+ 1.  Redistributions of source code must retain the above copyright notice, this
+ list of conditions and the following disclaimer.
+ 
+ 2.  Redistributions in binary form must reproduce the above copyright notice,
+ this list of conditions and the following disclaimer in the documentation and/or
+ other materials provided with the distribution.
+ 
+ 3.  Neither the name of the copyright holder(s) nor the names of any contributors
+ may be used to endorse or promote products derived from this software without
+ specific prior written permission. No license is granted to the trademarks of
+ the copyright holders even if such marks are included in this software.
+ 
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE
+ FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#import "ORKTappingIntervalStepViewController.h"
+#import "ORKTappingIntervalResult.h"
+
+
+NS_ASSUME_NONNULL_BEGIN
+
+@interface ORKTappingIntervalStepViewController ()
+
+// Empties the sample buffers and starts recording into them
+- (void)resetSamples;
+
+- (void)appendSampleWithButton:(ORKTappingButtonIdentifier)buttonIdentifier location:(CGPoint)location timestamp:(NSTimeInterval)timestamp;
+
+// Fills the duration of the most recent sample still held down on the button; does nothing for ORKTappingButtonIdentifierNone
+- (void)completePendingSampleForButton:(ORKTappingButtonIdentifier)buttonIdentifier mediaTime:(NSTimeInterval)mediaTime;
+
+// Materialized from the sample buffers on demand, and discarded whenever they change; nil until recording starts
+- (nullable NSArray<ORKTappingSample *> *)samples;
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -35,12 +35,14 @@
 
 #import "ORKRecorder_Internal.h"
 
+#import "ORKHelpers_Internal.h"
+#import "ORKJSONWriter.h"
 #import "UITouch+ORKJSONDictionary.h"
 
 
 @protocol ORKTouchRecordingDelegate <NSObject>
 
-- (void)view:(UIView *)view didDetectTouch:(UITouch *)touch;
+- (void)view:(UIView *)view didDetectTouches:(NSSet<UITouch *> *)touches;
 
 @end
 
@@ -55,10 +57,7 @@
 @implementation ORKTouchGestureRecognizer
 
 - (void)reportTouches:(NSSet *)touches {
-    
-    for (UITouch *touch in touches) {
-        [self.eventDelegate view:self.view didDetectTouch:touch];
-    }
+    [self.eventDelegate view:self.view didDetectTouches:touches];
 }
 
 - (void)touchesBegan:(NSSet *)touches withEvent:(UIEvent *)event {
@@ -89,11 +88,14 @@
 
 @interface ORKTouchRecorder () <ORKTouchRecordingDelegate> {
     ORKDataLogger *_logger;
+    ORKJSONWriter *_writer;
+    BOOL _flushScheduled;
 }
 
 @property (nonatomic, strong) ORKTouchGestureRecognizer *gestureRecognizer;
 
-@property (nonatomic, strong) NSMutableArray *touchArray;
+// Maps each touch seen during recording to its stable index, in order of first appearance
+@property (nonatomic, strong) NSMapTable<UITouch *, NSNumber *> *touchIndexes;
 
 @property (nonatomic) NSTimeInterval uptime;
 
@@ -129,7 +131,9 @@
         
         [super start];
         
-        self.touchArray = [NSMutableArray array];
+        self.touchIndexes = [NSMapTable mapTableWithKeyOptions:(NSPointerFunctionsStrongMemory | NSPointerFunctionsObjectPointerPersonality)
+                                                  valueOptions:NSPointerFunctionsStrongMemory];
+        _writer = [ORKJSONWriter new];
         _uptime = [NSProcessInfo processInfo].systemUptime;
     } else {
         @throw [NSException exceptionWithName:NSGenericException
@@ -148,9 +152,11 @@
 
 - (void)stop {
     [self doStopRecording];
-    [_logger finishCurrentLog];
     
     NSError *error = nil;
+    [self flushTouchesWithError:&error];
+    [_logger finishCurrentLog];
+    
     __block NSURL *fileUrl = nil;
     [_logger enumerateLogs:^(NSURL *logFileUrl, BOOL *stop) {
         fileUrl = logFileUrl;
@@ -185,21 +191,57 @@
     [super reset];
     
     _logger = nil;
+    _writer = nil;
+    self.touchIndexes = nil;
 }
 
 #pragma mark - ORKTouchRecordingDelegate
 
+- (void)view:(UIView *)view didDetectTouches:(NSSet<UITouch *> *)touches {
+    for (UITouch *touch in touches) {
+        [self view:view didDetectTouch:touch];
+    }
+}
+
 - (void)view:(UIView *)view didDetectTouch:(UITouch *)touch {
-    
-    if ([self.touchArray containsObject:touch] == NO) {
-        [self.touchArray addObject:touch];
+    NSNumber *index = [self.touchIndexes objectForKey:touch];
+    if (index == nil) {
+        index = @(self.touchIndexes.count);
+        [self.touchIndexes setObject:index forKey:touch];
     }
     
-    NSError *error = nil;
-    if (![_logger append:[touch ork_JSONDictionaryInView:view allTouches:self.touchArray] error:&error]) {
-        assert(error != nil);
-        [self finishRecordingWithError:error];
+    [touch ork_writeJSONToWriter:_writer inView:view index:index.unsignedIntegerValue];
+    [self scheduleFlush];
+}
+
+/*
+ * Touch events delivered during one pass of the main run loop (one frame) are
+ * buffered and written to the log together.
+ */
+- (void)scheduleFlush {
+    if (_flushScheduled) {
+        return;
+    }
+    _flushScheduled = YES;
+    ORKWeakTypeOf(self) weakSelf = self;
+    dispatch_async(dispatch_get_main_queue(), ^{
+        ORKStrongTypeOf(self) strongSelf = weakSelf;
+        NSError *error = nil;
+        if (strongSelf && ![strongSelf flushTouchesWithError:&error]) {
+            assert(error != nil);
+            [strongSelf finishRecordingWithError:error];
+        }
+    });
+}
+
+- (BOOL)flushTouchesWithError:(NSError **)error {
+    _flushScheduled = NO;
+    if (_writer.itemCount == 0) {
+        return YES;
     }
+    BOOL success = [_logger appendJSONWriter:_writer error:error];
+    [_writer reset];
+    return success;
 }
 
 @end
@@ -34,9 +34,11 @@
 
 NS_ASSUME_NONNULL_BEGIN
 
+@class ORKJSONWriter;
+
 @interface UITouch (ORKJSONDictionary)
 
-- (NSDictionary *)ork_JSONDictionaryInView:(UIView *)view allTouches:(NSArray *)allTouches;
+- (void)ork_writeJSONToWriter:(ORKJSONWriter *)writer inView:(UIView *)view index:(NSUInteger)index;
 
 @end
 
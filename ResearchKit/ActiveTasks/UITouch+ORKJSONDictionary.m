@@ -31,23 +31,24 @@
 
 #import "UITouch+ORKJSONDictionary.h"
 
+#import "ORKJSONWriter.h"
+
 
 @implementation UITouch (ORKJSONDictionary)
 
-- (NSDictionary *)ork_JSONDictionaryInView:(UIView *)view allTouches:(NSArray *)allTouches {
+- (void)ork_writeJSONToWriter:(ORKJSONWriter *)writer inView:(UIView *)view index:(NSUInteger)index {
     CGPoint point = [self locationInView:view];
-    
     CGRect touchViewBounds = view.bounds;
     
-    NSDictionary *dictionary = @{@"timestamp": [NSDecimalNumber numberWithDouble:self.timestamp],
-                                 @"phase": @(self.phase),
-                                 @"index": @([allTouches indexOfObject:self]),
-                                 @"x": @(point.x),
-                                 @"y": @(point.y),
-                                 @"width": @(touchViewBounds.size.width),
-                                 @"height": @(touchViewBounds.size.height)
-                                 };
-    return dictionary;
+    [writer beginObject];
+    [writer writeKey:"timestamp" double:self.timestamp];
+    [writer writeKey:"phase" integer:self.phase];
+    [writer writeKey:"index" integer:index];
+    [writer writeKey:"x" double:point.x];
+    [writer writeKey:"y" double:point.y];
+    [writer writeKey:"width" double:touchViewBounds.size.width];
+    [writer writeKey:"height" double:touchViewBounds.size.height];
+    [writer endObject];
 }
 
 @end
@@ -32,6 +32,7 @@
 
 #import "ORKBarGraphChartView.h"
 
+#import "ORKChartLayoutEngine.h"
 #import "ORKGraphChartView_Internal.h"
 
 #import "ORKHelpers_Internal.h"
@@ -102,7 +103,9 @@ static const CGFloat BarWidth = 10.0;
 @end
 
 
-@implementation ORKBarGraphChartView
+@implementation ORKBarGraphChartView {
+    NSMutableDictionary<NSNumber *, NSArray<NSIndexPath *> *> *_combinedColorRuns; // The color runs the combined layers were created for
+}
 
 @dynamic dataSource;
 @dynamic dataPoints;
@@ -129,25 +132,15 @@ static const CGFloat BarWidth = 10.0;
         NSUInteger pointCount = self.dataPoints[plotIndex].count;
         for (NSUInteger pointIndex = 0; pointIndex < pointCount; pointIndex++) {
             
-            NSMutableArray *normalizedDoubleStackValues = [NSMutableArray new];
+            NSArray<NSNumber *> *normalizedDoubleStackValues = @[];
             ORKValueStack *dataPointValue = self.dataPoints[plotIndex][pointIndex];
             
             if (!dataPointValue.isUnset) {
-                double range = self.maximumValue - self.minimumValue;
-                double sum = 0;
-                for (NSNumber *value in dataPointValue.stackedValues) {
-                    // normalizedDoubleStackValues holds absolute canvas y-positions corresponding to each point
-                    // (rather than incremental y-positions as the dataPoints valueStacks hold).
-                    // E.g. (canvas height = 100)
-                    //      dataPoint valueStack = {10, 10, 20}
-                    //        ->
-                    //      normalized valueStack = {25, 50, 100}
-                    sum += value.doubleValue;
-                    double normalizedValue = (sum - self.minimumValue) / range * viewHeight;
-                    normalizedValue = floor(viewHeight - normalizedValue);
-                    
-                    [normalizedDoubleStackValues addObject:@(normalizedValue)];
-                }
+                // Absolute canvas y-positions of the top of each value, rather than the incremental values the stack holds
+                normalizedDoubleStackValues = [ORKChartLayoutEngine normalizedStackedValues:dataPointValue.stackedValues
+                                                                               minimumValue:self.minimumValue
+                                                                               maximumValue:self.maximumValue
+                                                                               canvasHeight:viewHeight];
             }
             [normalizedDataPoints addObject:[[ORKValueStack alloc] initWithStackedValues:normalizedDoubleStackValues]];
         }
@@ -197,7 +190,62 @@ static const CGFloat BarWidth = 10.0;
     return ORKOpaqueColorWithReducedAlphaFromBaseColor([super colorForPlotIndex:plotIndex subpointIndex:subpointIndex totalSubpoints:(NSInteger)totalSubpoints], subpointIndex, totalSubpoints);
 }
 
+/*
+ * Bar segment colors depend on both the position of the value in its stack and the stack size,
+ * so combined paths are grouped by that pair. The groups are sorted to keep their order stable.
+ */
+- (NSArray<NSIndexPath *> *)colorRunsForPlotIndex:(NSInteger)plotIndex {
+    NSMutableSet<NSIndexPath *> *colorRuns = [NSMutableSet new];
+    for (ORKValueStack *dataPointValue in self.dataPoints[plotIndex]) {
+        if (!dataPointValue.isUnset) {
+            NSUInteger numberOfStackedValues = dataPointValue.stackedValues.count;
+            for (NSUInteger index = 0; index < numberOfStackedValues; index++) {
+                [colorRuns addObject:[NSIndexPath indexPathForRow:index inSection:numberOfStackedValues]];
+            }
+        }
+    }
+    return [colorRuns.allObjects sortedArrayUsingSelector:@selector(compare:)];
+}
+
+- (void)updatePlotColorsForPlotIndex:(NSInteger)plotIndex {
+    if (!self.drawsCombinedPlotPaths) {
+        [super updatePlotColorsForPlotIndex:plotIndex];
+        return;
+    }
+    NSArray<NSIndexPath *> *colorRuns = [self colorRunsForPlotIndex:plotIndex];
+    NSArray<CAShapeLayer *> *lineLayers = self.lineLayers[plotIndex].firstObject;
+    for (NSUInteger runIndex = 0; runIndex < MIN(colorRuns.count, lineLayers.count); runIndex++) {
+        NSIndexPath *colorRun = colorRuns[runIndex];
+        lineLayers[runIndex].strokeColor = [self colorForPlotIndex:plotIndex subpointIndex:colorRun.row totalSubpoints:colorRun.section].CGColor;
+    }
+}
+
+- (BOOL)lineLayersNeedUpdateForPlotIndex:(NSInteger)plotIndex {
+    // Appended or removed points can add or drop stack sizes, and with them combined layers
+    return [super lineLayersNeedUpdateForPlotIndex:plotIndex] ||
+        ![_combinedColorRuns[@(plotIndex)] isEqualToArray:[self colorRunsForPlotIndex:plotIndex]];
+}
+
 - (void)updateLineLayersForPlotIndex:(NSInteger)plotIndex {
+    if (self.drawsCombinedPlotPaths) {
+        NSArray<NSIndexPath *> *colorRuns = [self colorRunsForPlotIndex:plotIndex];
+        if (!_combinedColorRuns) {
+            _combinedColorRuns = [NSMutableDictionary new];
+        }
+        _combinedColorRuns[@(plotIndex)] = colorRuns;
+        
+        NSMutableArray<CAShapeLayer *> *lineLayers = [NSMutableArray new];
+        for (NSIndexPath *colorRun in colorRuns) {
+            CAShapeLayer *lineLayer = [CAShapeLayer layer];
+            lineLayer.strokeColor = [self colorForPlotIndex:plotIndex subpointIndex:colorRun.row totalSubpoints:colorRun.section].CGColor;
+            lineLayer.lineWidth = BarWidth;
+            [self.plotView.layer addSublayer:lineLayer];
+            [lineLayers addObject:lineLayer];
+        }
+        [self.lineLayers[plotIndex] addObject:lineLayers];
+        return;
+    }
+    
     NSUInteger pointCount = self.dataPoints[plotIndex].count;
     for (NSUInteger pointIndex = 0; pointIndex < pointCount; pointIndex++) {
         ORKValueStack *dataPointValue = self.dataPoints[plotIndex][pointIndex];
@@ -217,6 +265,13 @@ static const CGFloat BarWidth = 10.0;
 }
 
 - (void)layoutLineLayersForPlotIndex:(NSInteger)plotIndex {
+    BOOL drawsCombinedPlotPaths = self.drawsCombinedPlotPaths;
+    NSArray<NSIndexPath *> *colorRuns = drawsCombinedPlotPaths ? [self colorRunsForPlotIndex:plotIndex] : nil;
+    NSMutableDictionary<NSIndexPath *, UIBezierPath *> *combinedLinePaths = [NSMutableDictionary new];
+    for (NSIndexPath *colorRun in colorRuns) {
+        combinedLinePaths[colorRun] = [UIBezierPath bezierPath];
+    }
+    
     NSUInteger lineLayerIndex = 0;
     double positionOnXAxis = ORKDoubleInvalidValue;
     ORKValueStack *positionsOnYAxis = nil;
@@ -231,7 +286,12 @@ static const CGFloat BarWidth = 10.0;
             NSUInteger numberOfSubpoints = positionsOnYAxis.stackedValues.count;
             for (NSUInteger subpointIndex = 0; subpointIndex < numberOfSubpoints; subpointIndex++) {
                 double positionOnYAxis = positionsOnYAxis.stackedValues[subpointIndex].doubleValue;
-                UIBezierPath *linePath = [UIBezierPath bezierPath];
+                UIBezierPath *linePath = nil;
+                if (drawsCombinedPlotPaths) {
+                    linePath = combinedLinePaths[[NSIndexPath indexPathForRow:subpointIndex inSection:numberOfSubpoints]];
+                } else {
+                    linePath = [UIBezierPath bezierPath];
+                }
                 
                 double barHeight = fabs(positionOnYAxis - previousYValue);
 
@@ -243,12 +303,21 @@ static const CGFloat BarWidth = 10.0;
                 
                 previousYValue = positionOnYAxis;
                 
-                CAShapeLayer *lineLayer = self.lineLayers[plotIndex][pointIndex][subpointIndex];
-                lineLayer.path = linePath.CGPath;
-                lineLayerIndex++;
+                if (!drawsCombinedPlotPaths) {
+                    CAShapeLayer *lineLayer = self.lineLayers[plotIndex][pointIndex][subpointIndex];
+                    lineLayer.path = linePath.CGPath;
+                    lineLayerIndex++;
+                }
             }
         }
     }
+    
+    if (drawsCombinedPlotPaths) {
+        NSArray<CAShapeLayer *> *lineLayers = self.lineLayers[plotIndex].firstObject;
+        for (NSUInteger runIndex = 0; runIndex < MIN(colorRuns.count, lineLayers.count); runIndex++) {
+            lineLayers[runIndex].path = combinedLinePaths[colorRuns[runIndex]].CGPath;
+        }
+    }
 }
 
 #pragma mark - Scrubbing
@@ -0,0 +1,177 @@
+/*
+ Copyright (c) 2026, CareEvolution, Inc.
+ 
+ Redistribution and use in source and binary forms, with or without modification,
+ are permitted provided that the following conditions are met:
+ 
+ 1.  Redistributions of source code must retain the above copyright notice, this
+ list of conditions and the following disclaimer.
+ 
+ 2.  Redistributions in binary form must reproduce the above copyright notice,
+ this list of conditions and the following disclaimer in the documentation and/or
+ other materials provided with the distribution.
+ 
+ 3.  Neither the name of the copyright holder(s) nor the names of any contributors
+ may be used to endorse or promote products derived from this software without
+ specific prior written permission. No license is granted to the trademarks of
+ the copyright holders even if such marks are included in this software.
+ 
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE
+ FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+@import Foundation;
+@import CoreGraphics;
+
+
+NS_ASSUME_NONNULL_BEGIN
+
+typedef NS_ENUM(NSInteger, ORKChartPrimitiveType) {
+    ORKChartPrimitiveTypeLine,
+    ORKChartPrimitiveTypeArc,
+    ORKChartPrimitiveTypeLabel
+};
+
+typedef NS_ENUM(NSInteger, ORKChartLabelAnchor) {
+    ORKChartLabelAnchorCenter,
+    ORKChartLabelAnchorRight
+};
+
+/**
+ The `ORKChartPrimitive` class is an internal value class describing one element of a chart in
+ plot view coordinates: a stroked line, a stroked arc, or a text label.
+ 
+ The description of a primitive lists its type and geometry rounded to two decimal places, so
+ arrays of primitives can be compared against golden output.
+ */
+@interface ORKChartPrimitive : NSObject
+
++ (instancetype)lineFromPoint:(CGPoint)startPoint toPoint:(CGPoint)endPoint lineWidth:(CGFloat)lineWidth;
+
++ (instancetype)arcWithCenter:(CGPoint)center
+                       radius:(CGFloat)radius
+                   startAngle:(CGFloat)startAngle
+                     endAngle:(CGFloat)endAngle
+                    clockwise:(BOOL)clockwise
+                    lineWidth:(CGFloat)lineWidth;
+
++ (instancetype)labelWithText:(nullable NSString *)text position:(CGPoint)position anchor:(ORKChartLabelAnchor)anchor;
+
+@property (nonatomic, readonly) ORKChartPrimitiveType type;
+
+// Lines
+@property (nonatomic, readonly) CGPoint startPoint;
+@property (nonatomic, readonly) CGPoint endPoint;
+
+// Arcs
+@property (nonatomic, readonly) CGPoint center;
+@property (nonatomic, readonly) CGFloat radius;
+@property (nonatomic, readonly) CGFloat startAngle;
+@property (nonatomic, readonly) CGFloat endAngle;
+@property (nonatomic, readonly) BOOL clockwise;
+
+// Lines and arcs
+@property (nonatomic, readonly) CGFloat lineWidth;
+
+// Labels; the position is the label center, or the middle of its right edge
+@property (nonatomic, readonly, copy, nullable) NSString *text;
+@property (nonatomic, readonly) CGPoint position;
+@property (nonatomic, readonly) ORKChartLabelAnchor anchor;
+
+@end
+
+
+/**
+ The `ORKChartLayoutEngine` class computes chart geometry from data and bounds alone, without
+ creating views or layers, so that it can be measured and regression-tested headless.
+ 
+ The axis views get their tick and label geometry from this class, the graph chart views their
+ normalized values, and the pie chart view its circle, normalized values and label placement.
+ */
+@interface ORKChartLayoutEngine : NSObject
+
++ (instancetype)new NS_UNAVAILABLE;
+- (instancetype)init NS_UNAVAILABLE;
+
+#pragma mark Axes
+
+// The label factors used when the graph chart view does not set yAxisLabelFactors
++ (NSArray<NSNumber *> *)defaultYAxisLabelFactorsForMinimumValue:(double)minimumValue maximumValue:(double)maximumValue;
+
+// A tick line followed by its label for each factor; labels for a zero value have no text
++ (NSArray<ORKChartPrimitive *> *)yAxisPrimitivesWithLabelFactors:(NSArray<NSNumber *> *)labelFactors
+                                                     minimumValue:(double)minimumValue
+                                                     maximumValue:(double)maximumValue
+                                                    decimalPlaces:(NSUInteger)decimalPlaces
+                                                             size:(CGSize)size;
+
+// The axis line followed by one tick line per x axis point
++ (NSArray<ORKChartPrimitive *> *)xAxisPrimitivesWithNumberOfPoints:(NSInteger)numberOfPoints
+                                                               size:(CGSize)size
+                                                    pixelAdjustment:(CGFloat)pixelAdjustment;
+
+#pragma mark Graph plots
+
+/*
+ Maps values to canvas y positions, with the maximum value at the top. Every value maps to the
+ middle of the canvas when the minimum and maximum values are equal.
+ */
++ (void)normalizeValues:(const double *)values
+                  count:(NSUInteger)count
+           minimumValue:(double)minimumValue
+           maximumValue:(double)maximumValue
+           canvasHeight:(CGFloat)canvasHeight
+       normalizedValues:(double *)normalizedValues;
+
+// Canvas y positions of the top of each value of a stack, bottom value first
++ (NSArray<NSNumber *> *)normalizedStackedValues:(NSArray<NSNumber *> *)stackedValues
+                                    minimumValue:(double)minimumValue
+                                    maximumValue:(double)maximumValue
+                                    canvasHeight:(CGFloat)canvasHeight;
+
+#pragma mark Pie charts
+
+// Each value as a fraction of the sum of the values, or 0 when the sum is 0
++ (NSArray<NSNumber *> *)normalizedPieValues:(NSArray<NSNumber *> *)values;
+
++ (NSString *)piePercentageTextForNormalizedValue:(double)normalizedValue;
+
+// The radius the percentage labels are laid out around
++ (CGFloat)piePercentageLabelRadiusWithSize:(CGSize)size radiusScaleFactor:(CGFloat)radiusScaleFactor labelHeight:(CGFloat)labelHeight;
+
+// The full circle the segments are stroked along
++ (ORKChartPrimitive *)pieCirclePrimitiveWithSize:(CGSize)size
+                                radiusScaleFactor:(CGFloat)radiusScaleFactor
+                                        lineWidth:(CGFloat)lineWidth
+                                      labelHeight:(CGFloat)labelHeight
+                            showsPercentageLabels:(BOOL)showsPercentageLabels
+                                   drawsClockwise:(BOOL)drawsClockwise;
+
+// The angle from the top of the pie to the middle of each segment
++ (NSArray<NSNumber *> *)piePercentageLabelAnglesForNormalizedValues:(NSArray<NSNumber *> *)normalizedValues
+                                                      drawsClockwise:(BOOL)drawsClockwise;
+
++ (CGPoint)piePercentageLabelCenterForAngle:(CGFloat)angle labelSize:(CGSize)labelSize pieRadius:(CGFloat)pieRadius size:(CGSize)size;
+
+/*
+ One centered label per segment, placed outside the pie radius and shifted around it until the
+ labels no longer overlap. Label sizes depend on fonts, so they are provided by the caller.
+ */
++ (NSArray<ORKChartPrimitive *> *)piePercentageLabelPrimitivesForNormalizedValues:(NSArray<NSNumber *> *)normalizedValues
+                                                                        pieRadius:(CGFloat)pieRadius
+                                                                             size:(CGSize)size
+                                                                   drawsClockwise:(BOOL)drawsClockwise
+                                                                labelSizeProvider:(CGSize (^)(NSUInteger segmentIndex, NSString *text))labelSizeProvider;
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,341 @@
+/*
+ Copyright (c) 2026, CareEvolution, Inc.
+ 
+ Redistribution and use in source and binary forms, with or without modification,
+ are permitted provided that the following conditions are met:
+ 
+ 1.  Redistributions of source code must retain the above copyright notice, this
+ list of conditions and the following disclaimer.
+ 
+ 2.  Redistributions in binary form must reproduce the above copyright notice,
+ this list of conditions and the following disclaimer in the documentation and/or
+ other materials provided with the distribution.
+ 
+ 3.  Neither the name of the copyright holder(s) nor the names of any contributors
+ may be used to endorse or promote products derived from this software without
+ specific prior written permission. No license is granted to the trademarks of
+ the copyright holders even if such marks are included in this software.
+ 
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE
+ FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#import "ORKChartLayoutEngine.h"
+
+#import "ORKGraphChartView_Internal.h"
+
+#import "ORKHelpers_Internal.h"
+
+@import Accelerate;
+
+
+static const CGFloat PieOriginAngle = -M_PI_2;
+static const CGFloat PiePercentageLabelOffset = 10.0;
+static const CGFloat PiePercentageLabelShiftStep = 0.01;
+
+static NSString *ORKChartPointDescription(CGPoint point) {
+    return [NSString stringWithFormat:@"(%.2f, %.2f)", point.x, point.y];
+}
+
+
+@implementation ORKChartPrimitive
+
++ (instancetype)lineFromPoint:(CGPoint)startPoint toPoint:(CGPoint)endPoint lineWidth:(CGFloat)lineWidth {
+    ORKChartPrimitive *primitive = [self new];
+    primitive->_type = ORKChartPrimitiveTypeLine;
+    primitive->_startPoint = startPoint;
+    primitive->_endPoint = endPoint;
+    primitive->_lineWidth = lineWidth;
+    return primitive;
+}
+
++ (instancetype)arcWithCenter:(CGPoint)center
+                       radius:(CGFloat)radius
+                   startAngle:(CGFloat)startAngle
+                     endAngle:(CGFloat)endAngle
+                    clockwise:(BOOL)clockwise
+                    lineWidth:(CGFloat)lineWidth {
+    ORKChartPrimitive *primitive = [self new];
+    primitive->_type = ORKChartPrimitiveTypeArc;
+    primitive->_center = center;
+    primitive->_radius = radius;
+    primitive->_startAngle = startAngle;
+    primitive->_endAngle = endAngle;
+    primitive->_clockwise = clockwise;
+    primitive->_lineWidth = lineWidth;
+    return primitive;
+}
+
++ (instancetype)labelWithText:(NSString *)text position:(CGPoint)position anchor:(ORKChartLabelAnchor)anchor {
+    ORKChartPrimitive *primitive = [self new];
+    primitive->_type = ORKChartPrimitiveTypeLabel;
+    primitive->_text = [text copy];
+    primitive->_position = position;
+    primitive->_anchor = anchor;
+    return primitive;
+}
+
+- (NSString *)description {
+    switch (_type) {
+        case ORKChartPrimitiveTypeLine:
+            return [NSString stringWithFormat:@"line %@ %@ %.2f", ORKChartPointDescription(_startPoint), ORKChartPointDescription(_endPoint), _lineWidth];
+        case ORKChartPrimitiveTypeArc:
+            return [NSString stringWithFormat:@"arc %@ r=%.2f %.4f%@%.4f %.2f", ORKChartPointDescription(_center), _radius, _startAngle, _clockwise ? @">" : @"<", _endAngle, _lineWidth];
+        case ORKChartPrimitiveTypeLabel:
+            return [NSString stringWithFormat:@"label \"%@\" %@ %@", _text ? : @"", _anchor == ORKChartLabelAnchorRight ? @"right" : @"center", ORKChartPointDescription(_position)];
+    }
+}
+
+@end
+
+
+@implementation ORKChartLayoutEngine
+
++ (instancetype)new {
+    ORKThrowMethodUnavailableException();
+}
+
+- (instancetype)init {
+    ORKThrowMethodUnavailableException();
+}
+
+#pragma mark - Axes
+
++ (NSArray<NSNumber *> *)defaultYAxisLabelFactorsForMinimumValue:(double)minimumValue maximumValue:(double)maximumValue {
+    return (minimumValue == maximumValue) ? @[ @0.5f ] : @[ @0.2f, @1.0f ];
+}
+
++ (NSArray<ORKChartPrimitive *> *)yAxisPrimitivesWithLabelFactors:(NSArray<NSNumber *> *)labelFactors
+                                                     minimumValue:(double)minimumValue
+                                                     maximumValue:(double)maximumValue
+                                                    decimalPlaces:(NSUInteger)decimalPlaces
+                                                             size:(CGSize)size {
+    NSString *decimalFormat = [NSString stringWithFormat:@"%%.%luf", (unsigned long)decimalPlaces];
+    NSMutableArray<ORKChartPrimitive *> *primitives = [NSMutableArray new];
+    for (NSNumber *factorNumber in labelFactors) {
+        CGFloat factor = factorNumber.floatValue;
+        CGFloat tickYPosition = size.height * (1 - factor);
+        CGFloat tickXOrigin = size.width - ORKGraphChartViewAxisTickLength;
+        [primitives addObject:[ORKChartPrimitive lineFromPoint:CGPointMake(tickXOrigin, tickYPosition)
+                                                       toPoint:CGPointMake(size.width, tickYPosition)
+                                                     lineWidth:1]];
+        
+        double yValue = minimumValue + (maximumValue - minimumValue) * factor;
+        NSString *text = (yValue != 0) ? [NSString stringWithFormat:decimalFormat, yValue] : nil;
+        [primitives addObject:[ORKChartPrimitive labelWithText:text
+                                                      position:CGPointMake(tickXOrigin - ORKGraphChartViewYAxisTickPadding, tickYPosition)
+                                                        anchor:ORKChartLabelAnchorRight]];
+    }
+    return [primitives copy];
+}
+
++ (NSArray<ORKChartPrimitive *> *)xAxisPrimitivesWithNumberOfPoints:(NSInteger)numberOfPoints
+                                                               size:(CGSize)size
+                                                    pixelAdjustment:(CGFloat)pixelAdjustment {
+    NSMutableArray<ORKChartPrimitive *> *primitives = [NSMutableArray new];
+    [primitives addObject:[ORKChartPrimitive lineFromPoint:CGPointZero toPoint:CGPointMake(size.width, 0) lineWidth:1]];
+    for (NSInteger pointIndex = 0; pointIndex < numberOfPoints; pointIndex++) {
+        // Ticks are one point wide and end just below the axis line
+        CGFloat tickXPosition = xAxisPoint(pointIndex, numberOfPoints, size.width) - pixelAdjustment + 0.5;
+        [primitives addObject:[ORKChartPrimitive lineFromPoint:CGPointMake(tickXPosition, pixelAdjustment - ORKGraphChartViewAxisTickLength)
+                                                       toPoint:CGPointMake(tickXPosition, pixelAdjustment)
+                                                     lineWidth:1]];
+    }
+    return [primitives copy];
+}
+
+#pragma mark - Graph plots
+
++ (void)normalizeValues:(const double *)values
+                  count:(NSUInteger)count
+           minimumValue:(double)minimumValue
+           maximumValue:(double)maximumValue
+           canvasHeight:(CGFloat)canvasHeight
+       normalizedValues:(double *)normalizedValues {
+    if (minimumValue == maximumValue) {
+        double center = canvasHeight / 2;
+        vDSP_vfillD(&center, normalizedValues, 1, count);
+    } else {
+        // canvasHeight - (value - minimumValue) / range * canvasHeight, as one multiply-add pass
+        double range = maximumValue - minimumValue;
+        double scale = -canvasHeight / range;
+        double offset = canvasHeight + minimumValue * canvasHeight / range;
+        vDSP_vsmsaD(values, 1, &scale, &offset, normalizedValues, 1, count);
+    }
+}
+
++ (NSArray<NSNumber *> *)normalizedStackedValues:(NSArray<NSNumber *> *)stackedValues
+                                    minimumValue:(double)minimumValue
+                                    maximumValue:(double)maximumValue
+                                    canvasHeight:(CGFloat)canvasHeight {
+    // Each position is the top of the cumulative sum, e.g. {10, 10, 20} on a 100 point canvas
+    // from 0 to 40 gives {75, 50, 0}
+    NSMutableArray<NSNumber *> *normalizedValues = [NSMutableArray arrayWithCapacity:stackedValues.count];
+    double range = maximumValue - minimumValue;
+    double sum = 0;
+    for (NSNumber *value in stackedValues) {
+        sum += value.doubleValue;
+        double normalizedValue = (sum - minimumValue) / range * canvasHeight;
+        [normalizedValues addObject:@(floor(canvasHeight - normalizedValue))];
+    }
+    return [normalizedValues copy];
+}
+
+#pragma mark - Pie charts
+
++ (NSArray<NSNumber *> *)normalizedPieValues:(NSArray<NSNumber *> *)values {
+    CGFloat sumOfValues = 0;
+    for (NSNumber *value in values) {
+        sumOfValues += value.doubleValue;
+    }
+    NSMutableArray<NSNumber *> *normalizedValues = [NSMutableArray arrayWithCapacity:values.count];
+    for (NSNumber *value in values) {
+        [normalizedValues addObject:@((sumOfValues != 0) ? value.doubleValue / sumOfValues : 0)];
+    }
+    return [normalizedValues copy];
+}
+
++ (NSString *)piePercentageTextForNormalizedValue:(double)normalizedValue {
+    return [NSString stringWithFormat:@"%0.0f%%", normalizedValue * 100];
+}
+
++ (CGFloat)piePercentageLabelRadiusWithSize:(CGSize)size radiusScaleFactor:(CGFloat)radiusScaleFactor labelHeight:(CGFloat)labelHeight {
+    CGFloat outerRadius = size.height * radiusScaleFactor;
+    return outerRadius - (labelHeight + PiePercentageLabelOffset);
+}
+
++ (ORKChartPrimitive *)pieCirclePrimitiveWithSize:(CGSize)size
+                                radiusScaleFactor:(CGFloat)radiusScaleFactor
+                                        lineWidth:(CGFloat)lineWidth
+                                      labelHeight:(CGFloat)labelHeight
+                            showsPercentageLabels:(BOOL)showsPercentageLabels
+                                   drawsClockwise:(BOOL)drawsClockwise {
+    CGFloat outerRadius = size.height * radiusScaleFactor;
+    CGFloat innerRadius = [self piePercentageLabelRadiusWithSize:size radiusScaleFactor:radiusScaleFactor labelHeight:labelHeight];
+    CGFloat targetRadius = showsPercentageLabels ? innerRadius : outerRadius;
+    CGFloat circleLineWidth = MIN(lineWidth, targetRadius);
+    
+    CGFloat startAngle = drawsClockwise ? PieOriginAngle : 3 * M_PI_2;
+    CGFloat endAngle = drawsClockwise ? PieOriginAngle + (2 * M_PI) : -M_PI_2;
+    return [ORKChartPrimitive arcWithCenter:CGPointMake(size.width / 2, size.height / 2)
+                                     radius:targetRadius - (circleLineWidth * 0.5)
+                                 startAngle:startAngle
+                                   endAngle:endAngle
+                                  clockwise:drawsClockwise
+                                  lineWidth:circleLineWidth];
+}
+
++ (NSArray<NSNumber *> *)piePercentageLabelAnglesForNormalizedValues:(NSArray<NSNumber *> *)normalizedValues
+                                                      drawsClockwise:(BOOL)drawsClockwise {
+    NSMutableArray<NSNumber *> *angles = [NSMutableArray arrayWithCapacity:normalizedValues.count];
+    CGFloat direction = drawsClockwise ? 1 : -1;
+    CGFloat cumulativeValue = 0;
+    for (NSNumber *value in normalizedValues) {
+        [angles addObject:@((value.doubleValue / 2 + cumulativeValue) * direction * M_PI * 2)];
+        cumulativeValue += value.doubleValue;
+    }
+    return [angles copy];
+}
+
++ (CGPoint)piePercentageLabelCenterForAngle:(CGFloat)angle labelSize:(CGSize)labelSize pieRadius:(CGFloat)pieRadius size:(CGSize)size {
+    CGFloat length = pieRadius + PiePercentageLabelOffset;
+    CGFloat cosine = cos(angle + PieOriginAngle);
+    CGFloat sine = sin(angle + PieOriginAngle);
+    
+    // Offset the center so that the spacing is measured to the label's frame rather than its center
+    return CGPointMake(cosine * length + size.width / 2 + cosine * labelSize.width / 2,
+                       sine * length + size.height / 2 + sine * labelSize.height / 2);
+}
+
++ (NSArray<ORKChartPrimitive *> *)piePercentageLabelPrimitivesForNormalizedValues:(NSArray<NSNumber *> *)normalizedValues
+                                                                        pieRadius:(CGFloat)pieRadius
+                                                                             size:(CGSize)size
+                                                                   drawsClockwise:(BOOL)drawsClockwise
+                                                                labelSizeProvider:(CGSize (^)(NSUInteger, NSString *))labelSizeProvider {
+    NSUInteger numberOfSegments = normalizedValues.count;
+    if (numberOfSegments == 0) {
+        return @[];
+    }
+    
+    NSMutableArray<NSString *> *texts = [NSMutableArray arrayWithCapacity:numberOfSegments];
+    NSMutableData *sizesData = [NSMutableData dataWithLength:numberOfSegments * sizeof(CGSize)];
+    NSMutableData *centersData = [NSMutableData dataWithLength:numberOfSegments * sizeof(CGPoint)];
+    NSMutableData *anglesData = [NSMutableData dataWithLength:numberOfSegments * sizeof(CGFloat)];
+    CGSize *sizes = sizesData.mutableBytes;
+    CGPoint *centers = centersData.mutableBytes;
+    CGFloat *angles = anglesData.mutableBytes;
+    
+    NSArray<NSNumber *> *initialAngles = [self piePercentageLabelAnglesForNormalizedValues:normalizedValues drawsClockwise:drawsClockwise];
+    for (NSUInteger index = 0; index < numberOfSegments; index++) {
+        NSString *text = [self piePercentageTextForNormalizedValue:normalizedValues[index].doubleValue];
+        [texts addObject:text];
+        sizes[index] = labelSizeProvider(index, text);
+        angles[index] = initialAngles[index].doubleValue;
+        centers[index] = [self piePercentageLabelCenterForAngle:angles[index] labelSize:sizes[index] pieRadius:pieRadius size:size];
+    }
+    
+    CGRect (^labelFrame)(NSUInteger) = ^CGRect(NSUInteger index) {
+        return CGRectMake(centers[index].x - sizes[index].width / 2, centers[index].y - sizes[index].height / 2, sizes[index].width, sizes[index].height);
+    };
+    // Moves the next label away from the previous one when they overlap
+    BOOL (^shiftLabel)(NSUInteger, NSUInteger, CGFloat) = ^BOOL(NSUInteger nextIndex, NSUInteger index, CGFloat direction) {
+        if (!CGRectIntersectsRect(labelFrame(index), labelFrame(nextIndex))) {
+            return NO;
+        }
+        angles[nextIndex] += direction * PiePercentageLabelShiftStep;
+        centers[nextIndex] = [self piePercentageLabelCenterForAngle:angles[nextIndex] labelSize:sizes[nextIndex] pieRadius:pieRadius size:size];
+        return YES;
+    };
+    
+    // Shift labels in alternating directions while any of them overlap; totalAngle bounds the loop
+    BOOL intersections = YES;
+    BOOL shiftClockwise = NO;
+    CGFloat rotateDirection = drawsClockwise ? 1 : -1;
+    CGFloat totalAngle = 0;
+    while (intersections) {
+        intersections = NO;
+        shiftClockwise = !shiftClockwise;
+        
+        if (shiftClockwise) {
+            totalAngle += PiePercentageLabelShiftStep;
+            if (totalAngle >= 2 * M_PI) {
+                break;
+            }
+            for (NSUInteger index = 0; index < (numberOfSegments - 1); index++) {
+                if (shiftLabel(index + 1, index, rotateDirection)) {
+                    intersections = YES;
+                }
+            }
+        } else {
+            for (NSUInteger index = numberOfSegments - 1; index > 0; index--) {
+                if (shiftLabel(index - 1, index, -rotateDirection)) {
+                    intersections = YES;
+                }
+            }
+        }
+        
+        // Adjust space between last and first label
+        NSUInteger lastIndex = numberOfSegments - 1;
+        if (CGRectIntersectsRect(labelFrame(lastIndex), labelFrame(0))) {
+            angles[0] += rotateDirection * PiePercentageLabelShiftStep;
+            angles[lastIndex] -= rotateDirection * PiePercentageLabelShiftStep;
+        }
+    }
+    
+    NSMutableArray<ORKChartPrimitive *> *primitives = [NSMutableArray arrayWithCapacity:numberOfSegments];
+    for (NSUInteger index = 0; index < numberOfSegments; index++) {
+        [primitives addObject:[ORKChartPrimitive labelWithText:texts[index] position:centers[index] anchor:ORKChartLabelAnchorCenter]];
+    }
+    return [primitives copy];
+}
+
+@end
@@ -112,22 +112,34 @@
     return [self numberOfValidValuesForPlotIndex:plotIndex] > 0 && _drawsConnectedRanges;
 }
 
+- (CAShapeLayer *)lineLayerForPlotIndex:(NSInteger)plotIndex {
+    CAShapeLayer *lineLayer = graphLineLayer();
+    lineLayer.strokeColor = [self colorForPlotIndex:plotIndex].CGColor;
+    lineLayer.lineWidth = ORKGraphChartViewPointAndLineWidth;
+    [self.plotView.layer addSublayer:lineLayer];
+    return lineLayer;
+}
+
 - (void)updateLineLayersForPlotIndex:(NSInteger)plotIndex {
+    if (self.drawsCombinedPlotPaths) {
+        // All the ranges of the plot share a single layer
+        [self.lineLayers[plotIndex] addObject:[NSMutableArray arrayWithObject:[self lineLayerForPlotIndex:plotIndex]]];
+        return;
+    }
+    
     NSUInteger pointCount = self.dataPoints[plotIndex].count;
     for (NSUInteger pointIndex = 0; pointIndex < pointCount; pointIndex++) {
         ORKValueRange *dataPointValue = self.dataPoints[plotIndex][pointIndex];
         if (!dataPointValue.isUnset && !dataPointValue.isEmptyRange) {
-            CAShapeLayer *lineLayer = graphLineLayer();
-            lineLayer.strokeColor = [self colorForPlotIndex:plotIndex].CGColor;
-            lineLayer.lineWidth = ORKGraphChartViewPointAndLineWidth;
-            
-            [self.plotView.layer addSublayer:lineLayer];
+            CAShapeLayer *lineLayer = [self lineLayerForPlotIndex:plotIndex];
             [self.lineLayers[plotIndex] addObject:[NSMutableArray arrayWithObject:lineLayer]];
         }
     }
 }
 
 - (void)layoutLineLayersForPlotIndex:(NSInteger)plotIndex {
+    BOOL drawsCombinedPlotPaths = self.drawsCombinedPlotPaths;
+    UIBezierPath *combinedLinePath = [UIBezierPath bezierPath];
     NSUInteger lineLayerIndex = 0;
     CGFloat positionOnXAxis = ORKCGFloatInvalidValue;
     ORKValueRange *positionOnYAxis = nil;
@@ -138,7 +150,7 @@
         
         if (!dataPointValue.isUnset && !dataPointValue.isEmptyRange) {
             
-            UIBezierPath *linePath = [UIBezierPath bezierPath];
+            UIBezierPath *linePath = drawsCombinedPlotPaths ? combinedLinePath : [UIBezierPath bezierPath];
             
             positionOnXAxis = xAxisPoint(pointIndex, self.numberOfXAxisPoints, self.plotView.bounds.size.width);
             positionOnXAxis += [self xOffsetForPlotIndex:plotIndex];
@@ -147,11 +159,17 @@
             [linePath moveToPoint:CGPointMake(positionOnXAxis, positionOnYAxis.minimumValue)];
             [linePath addLineToPoint:CGPointMake(positionOnXAxis, positionOnYAxis.maximumValue)];
             
-            CAShapeLayer *lineLayer = self.lineLayers[plotIndex][lineLayerIndex][0];
-            lineLayer.path = linePath.CGPath;
-            lineLayerIndex++;
+            if (!drawsCombinedPlotPaths) {
+                CAShapeLayer *lineLayer = self.lineLayers[plotIndex][lineLayerIndex][0];
+                lineLayer.path = linePath.CGPath;
+                lineLayerIndex++;
+            }
         }
     }
+    
+    if (drawsCombinedPlotPaths) {
+        self.lineLayers[plotIndex].firstObject.firstObject.path = combinedLinePath.CGPath;
+    }
 }
 
 - (CGFloat)xOffsetForPlotIndex:(NSInteger)plotIndex {
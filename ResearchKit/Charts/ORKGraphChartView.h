@@ -298,6 +298,38 @@ ORK_AVAILABLE_DECL
  */
 - (ORKValueRange *)graphChartView:(ORKGraphChartView *)graphChartView dataPointForPointIndex:(NSInteger)pointIndex plotIndex:(NSInteger)plotIndex;
 
+@optional
+
+/**
+ Asks the data source for the value ranges of a contiguous range of points of the specified plot.
+ 
+ Implement this method when your data is already stored in contiguous arrays. When it is
+ implemented, the graph chart view calls it once per plot instead of calling
+ `graphChartView:dataPointForPointIndex:plotIndex:` for every point. A full reload asks for all the
+ points of the plot; `reloadDataAppendingPointCount:removingPointCount:` asks only for the appended
+ points.
+ 
+ Fill the first `range.length` elements of each buffer with the points at the indexes in `range`.
+ For points that model a single value, write the same value to both buffers. The maximum value of a
+ point cannot be lower than its minimum value.
+ 
+ @param graphChartView      The graph chart view that is asking for the values.
+ @param minimumValues       A buffer to fill with the minimum value of each point.
+ @param maximumValues       A buffer to fill with the maximum value of each point.
+ @param unsetMask           A buffer whose elements are initially `NO`. Set an element to `YES` to
+                                leave the corresponding point unset.
+ @param range               The indexes of the requested points, within the number of points
+                                returned by `graphChartView:numberOfDataPointsForPlotIndex:`.
+ @param plotIndex           An index number identifying the plot in the graph chart view. This index
+                                is 0 in a single-plot graph chart view.
+ */
+- (void)graphChartView:(ORKGraphChartView *)graphChartView
+      getMinimumValues:(double *)minimumValues
+         maximumValues:(double *)maximumValues
+             unsetMask:(BOOL *)unsetMask
+                 range:(NSRange)range
+             plotIndex:(NSInteger)plotIndex;
+
 @end
 
 
@@ -377,6 +409,19 @@ IB_DESIGNABLE
 */
 @property (nonatomic) IBInspectable BOOL showsVerticalReferenceLines;
 
+/**
+ A Boolean value indicating whether each plot is drawn with one combined path per color and line
+ style, rather than with one layer per segment, bar, or point.
+
+ Combined paths keep the number of layers independent of the number of data points, which makes
+ plots with thousands of points much cheaper to draw. When this property is YES, the
+ `animateWithDuration:` method strokes all combined paths of a plot at the same time, each over
+ the full duration, instead of animating the segments one after another.
+
+ The default value of this property is NO.
+ */
+@property (nonatomic) IBInspectable BOOL drawsCombinedPlotPaths;
+
 /**
  The delegate is notified of pan gesture events occuring within the bounds of the graph chart
  view.
@@ -500,6 +545,28 @@ IB_DESIGNABLE
 */
 - (void)reloadData;
 
+/**
+ Reloads the plotted data after points were added to the end of every plot and, optionally, the
+ oldest points were removed from its start.
+ 
+ Call this method instead of `reloadData` to scroll a live chart: update the data source first, so
+ that each plot lost its first `removedPointCount` points and gained `appendedPointCount` new
+ points at its end, then call this method. Only the new points are requested from the data
+ source, and the vertical axis is only updated when the plotted value range changes. If the
+ number of plots changed, or a plot has fewer points than these counts imply, this method
+ behaves like `reloadData`.
+ 
+ When the `drawsCombinedPlotPaths` property is YES the existing layers are kept and their paths
+ are rebuilt at the next layout pass, so the cost of each update only depends on the number of
+ points on screen. The layers of a plot are only recreated when the plot starts or stops drawing
+ lines, or when a bar graph plot gains or loses a stack size. Otherwise the per-segment layers are
+ recreated as in `reloadData`.
+ 
+ @param appendedPointCount      The number of points added to the end of each plot.
+ @param removedPointCount       The number of points removed from the start of each plot.
+ */
+- (void)reloadDataAppendingPointCount:(NSInteger)appendedPointCount removingPointCount:(NSInteger)removedPointCount;
+
 @end
 
 
@@ -35,6 +35,7 @@
 #import "ORKGraphChartView.h"
 #import "ORKGraphChartView_Internal.h"
 
+#import "ORKChartLayoutEngine.h"
 #import "ORKChartTypes.h"
 #import "ORKLineGraphChartView.h"
 #import "ORKXAxisView.h"
@@ -76,6 +77,7 @@
 
 const CGFloat ORKGraphChartViewLeftPadding = 10.0;
 const CGFloat ORKGraphChartViewPointAndLineWidth = 8.0;
+const CGFloat ORKGraphChartViewPointIndicatorLineWidth = 2.0;
 const CGFloat ORKGraphChartViewScrubberMoveAnimationDuration = 0.1;
 const CGFloat ORKGraphChartViewAxisTickLength = 12.0;
 const CGFloat ORKGraphChartViewYAxisTickPadding = 2.0;
@@ -94,6 +96,10 @@ static const CGFloat ScrubberLabelVerticalPadding = 4.0;
 
 @interface ORKGraphChartView () <UIGestureRecognizerDelegate>
 
+- (void)obtainDataPointsForPlotIndex:(NSInteger)plotIndex;
+
+- (void)updateDataPointsForPlotIndex:(NSInteger)plotIndex appendedPointCount:(NSInteger)appendedPointCount removedPointCount:(NSInteger)removedPointCount;
+
 @end
 
 
@@ -107,6 +113,11 @@ static const CGFloat ScrubberLabelVerticalPadding = 4.0;
     UILabel *_scrubberLabel;
     UIView *_scrubberThumbView;
     NSString *_decimalFormat;
+    CGFloat _lastPlotViewWidth;
+    NSMutableData *_xAxisPointPositions;
+    NSInteger _xAxisPointPositionsCount;
+    CGFloat _xAxisPointPositionsCanvasWidth;
+    NSMutableDictionary<NSNumber *, NSIndexSet *> *_validPointIndexes;
 }
 
 #pragma mark - Init
@@ -127,6 +138,7 @@ static const CGFloat ScrubberLabelVerticalPadding = 4.0;
 
 - (void)reloadData {
     _numberOfXAxisPoints = -1; // reset cached number of x axis points
+    [_validPointIndexes removeAllObjects];
     [self updateAndLayoutVerticalReferenceLineLayers];
     [self obtainDataPoints];
     [self calculateMinAndMaxValues];
@@ -140,6 +152,57 @@ static const CGFloat ScrubberLabelVerticalPadding = 4.0;
     [self setNeedsLayout];
 }
 
+- (void)reloadDataAppendingPointCount:(NSInteger)appendedPointCount removingPointCount:(NSInteger)removedPointCount {
+    if (appendedPointCount < 0 || removedPointCount < 0) {
+        @throw [NSException exceptionWithName:NSInvalidArgumentException reason:@"appendedPointCount and removedPointCount cannot be negative" userInfo:nil];
+    }
+    
+    // Fall back to a full reload when the counts do not describe how the data source changed
+    NSInteger numberOfPlots = [self numberOfPlots];
+    BOOL canUpdateIncrementally = (numberOfPlots == _dataPoints.count);
+    for (NSInteger plotIndex = 0; canUpdateIncrementally && plotIndex < numberOfPlots; plotIndex++) {
+        NSInteger numberOfPoints = [_dataSource graphChartView:self numberOfDataPointsForPlotIndex:plotIndex];
+        NSInteger previousNumberOfPoints = numberOfPoints - appendedPointCount + removedPointCount;
+        canUpdateIncrementally = (numberOfPoints >= appendedPointCount && previousNumberOfPoints <= (NSInteger)_dataPoints[plotIndex].count);
+    }
+    if (!canUpdateIncrementally) {
+        [self reloadData];
+        return;
+    }
+    
+    double previousMinimumValue = _minimumValue;
+    double previousMaximumValue = _maximumValue;
+    
+    _numberOfXAxisPoints = -1; // reset cached number of x axis points
+    [_validPointIndexes removeAllObjects];
+    [self updateAndLayoutVerticalReferenceLineLayers];
+    _hasDataPoints = NO;
+    for (NSInteger plotIndex = 0; plotIndex < numberOfPlots; plotIndex++) {
+        [self updateDataPointsForPlotIndex:plotIndex appendedPointCount:appendedPointCount removedPointCount:removedPointCount];
+        if (!_hasDataPoints) {
+            NSUInteger setPointIndex = [_dataPoints[plotIndex] indexOfObjectPassingTest:^BOOL(NSObject<ORKValueCollectionType> *dataPoint, NSUInteger index, BOOL *stop) {
+                return !dataPoint.isUnset;
+            }];
+            _hasDataPoints = (setPointIndex != NSNotFound);
+        }
+    }
+    [self calculateMinAndMaxValues];
+    [_xAxisView updateTitles];
+    if (_minimumValue != previousMinimumValue || _maximumValue != previousMaximumValue) {
+        [_yAxisView updateTicksAndLabels];
+    }
+    if (_drawsCombinedPlotPaths) {
+        [self updateLineLayersIfNeeded];
+    } else {
+        [self updateLineLayers];
+    }
+    [self updateNoDataLabel];
+    
+    [self _axCreateAccessibilityElementsIfNeeded];
+    
+    [self setNeedsLayout];
+}
+
 - (void)setDataSource:(id<ORKGraphChartViewDataSource>)dataSource {
     _dataSource = dataSource;
     [self reloadData];
@@ -231,6 +294,12 @@ static const CGFloat ScrubberLabelVerticalPadding = 4.0;
     [self updateAndLayoutVerticalReferenceLineLayers];
 }
 
+- (void)setDrawsCombinedPlotPaths:(BOOL)drawsCombinedPlotPaths {
+    _drawsCombinedPlotPaths = drawsCombinedPlotPaths;
+    [self updateLineLayers];
+    [self layoutLineLayers];
+}
+
 - (void)sharedInit {
     _numberOfXAxisPoints = -1;
     _showsHorizontalReferenceLines = NO;
@@ -239,6 +308,8 @@ static const CGFloat ScrubberLabelVerticalPadding = 4.0;
     _yAxisPoints = [NSMutableArray new];
     _lineLayers = [NSMutableArray new];
     _hasDataPoints = NO;
+    _xAxisPointPositions = [NSMutableData new];
+    _validPointIndexes = [NSMutableDictionary new];
     
     // init null resetable properties
     _axisColor =  ORKColor(ORKGraphAxisColorKey);
@@ -439,6 +510,24 @@ ORK_INLINE CALayer *graphVerticalReferenceLineLayerWithColor(UIColor *color, CGF
     }
 }
 
+- (void)updateDataPointsForPlotIndex:(NSInteger)plotIndex appendedPointCount:(NSInteger)appendedPointCount removedPointCount:(NSInteger)removedPointCount {
+    NSMutableArray<NSObject<ORKValueCollectionType> *> *dataPoints = self.dataPoints[plotIndex];
+    NSInteger numberOfPoints = [self.dataSource graphChartView:self numberOfDataPointsForPlotIndex:plotIndex];
+    NSInteger keptPointCount = numberOfPoints - appendedPointCount;
+    
+    // Drop the dummy padding and the oldest points, then only ask for the new points
+    NSInteger previousNumberOfPoints = keptPointCount + removedPointCount;
+    [dataPoints removeObjectsInRange:NSMakeRange(previousNumberOfPoints, dataPoints.count - previousNumberOfPoints)];
+    [dataPoints removeObjectsInRange:NSMakeRange(0, removedPointCount)];
+    for (NSInteger pointIndex = keptPointCount; pointIndex < numberOfPoints; pointIndex++) {
+        [dataPoints addObject:[self dataPointForPointIndex:pointIndex plotIndex:plotIndex]];
+    }
+    NSInteger emptyPointsCount = self.numberOfXAxisPoints - dataPoints.count;
+    for (NSInteger idx = 0; idx < emptyPointsCount; idx++) {
+        [dataPoints addObject:[self dummyPoint]];
+    }
+}
+
 #pragma mark - Layout & Drawing
 
 - (void)setBounds:(CGRect)bounds {
@@ -494,10 +583,19 @@ ORK_INLINE CALayer *graphVerticalReferenceLineLayerWithColor(UIColor *color, CGF
                                      1,
                                      CGRectGetHeight(_plotView.frame));
     
+    CGFloat plotViewWidth = CGRectGetWidth(_plotView.bounds);
+    if (plotViewWidth != _lastPlotViewWidth) {
+        _lastPlotViewWidth = plotViewWidth;
+        [self plotViewWidthDidChange];
+    }
+    
     [self updateYAxisPoints];
     [self layoutLineLayers];
 }
 
+- (void)plotViewWidthDidChange {
+}
+
 - (void)updateYAxisPoints {
     [_yAxisPoints removeAllObjects];
     NSInteger numberOfPlots = [self numberOfPlots];
@@ -541,7 +639,7 @@ ORK_INLINE CALayer *graphVerticalReferenceLineLayerWithColor(UIColor *color, CGF
 
 ORK_INLINE UIImage *graphPointLayerImageWithColor(UIColor *color) {
     const CGFloat pointSize = ORKGraphChartViewPointAndLineWidth;
-    const CGFloat pointLineWidth = 2.0;
+    const CGFloat pointLineWidth = ORKGraphChartViewPointIndicatorLineWidth;
     
     static UIImage *pointImage = nil;
     static UIColor *pointImageColor = nil;
@@ -608,6 +706,35 @@ ORK_INLINE CALayer *graphPointLayerWithColor(UIColor *color, BOOL drawPointIndic
     }
 }
 
+- (void)updateLineLayersIfNeeded {
+    NSInteger numberOfPlots = [self numberOfPlots];
+    if (_lineLayers.count != numberOfPlots) {
+        [self updateLineLayers];
+        return;
+    }
+    
+    for (NSInteger plotIndex = 0; plotIndex < numberOfPlots; plotIndex++) {
+        if ([self lineLayersNeedUpdateForPlotIndex:plotIndex]) {
+            [self removeLineLayersForPlotIndex:plotIndex];
+            if ([self shouldDrawLinesForPlotIndex:plotIndex]) {
+                [self updateLineLayersForPlotIndex:plotIndex];
+            }
+        }
+    }
+}
+
+- (BOOL)lineLayersNeedUpdateForPlotIndex:(NSInteger)plotIndex {
+    // A plot that started or stopped drawing lines since its layers were created
+    return [self shouldDrawLinesForPlotIndex:plotIndex] != (_lineLayers[plotIndex].count > 0);
+}
+
+- (void)removeLineLayersForPlotIndex:(NSInteger)plotIndex {
+    for (NSMutableArray <CAShapeLayer *> *sublineLayers in _lineLayers[plotIndex]) {
+        [sublineLayers makeObjectsPerformSelector:@selector(removeFromSuperlayer)];
+    }
+    [_lineLayers[plotIndex] removeAllObjects];
+}
+
 - (void)layoutLineLayers {
     
     NSInteger numberOfPlots = [self numberOfPlots];
@@ -804,61 +931,101 @@ ORK_INLINE CALayer *graphPointLayerWithColor(UIColor *color, BOOL drawPointIndic
     }
 }
 
-- (NSInteger)pointIndexForXPosition:(CGFloat)xPosition plotIndex:(NSInteger)plotIndex {
-    NSInteger pointIndex = 0;
+// Rebuilt only when the number of x axis points or the plot view width changes
+- (const CGFloat *)xAxisPointPositions {
     NSInteger numberOfXAxisPoints = self.numberOfXAxisPoints;
-    for (pointIndex = 0; pointIndex < (numberOfXAxisPoints - 1); pointIndex++) {
-        CGFloat xAxisPointValue = xAxisPoint(pointIndex, numberOfXAxisPoints, _plotView.bounds.size.width);
-        if (xAxisPointValue >= xPosition) {
-            break;
+    CGFloat canvasWidth = _plotView.bounds.size.width;
+    if (numberOfXAxisPoints != _xAxisPointPositionsCount || canvasWidth != _xAxisPointPositionsCanvasWidth) {
+        _xAxisPointPositions.length = numberOfXAxisPoints * sizeof(CGFloat);
+        CGFloat *positions = _xAxisPointPositions.mutableBytes;
+        for (NSInteger pointIndex = 0; pointIndex < numberOfXAxisPoints; pointIndex++) {
+            positions[pointIndex] = xAxisPoint(pointIndex, numberOfXAxisPoints, canvasWidth);
         }
+        _xAxisPointPositionsCount = numberOfXAxisPoints;
+        _xAxisPointPositionsCanvasWidth = canvasWidth;
     }
-    return pointIndex;
+    return _xAxisPointPositions.bytes;
 }
 
-- (NSInteger)numberOfValidValuesForPlotIndex:(NSInteger)plotIndex {
-    NSInteger count = 0;
-    
-    if (plotIndex < _dataPoints.count) {
-        for (ORKValueRange *rangePoint in _dataPoints[plotIndex]) {
-            if (!rangePoint.isUnset) {
-                count++;
-            }
+- (CGFloat)xAxisPointForPointIndex:(NSInteger)pointIndex {
+    return [self xAxisPointPositions][pointIndex];
+}
+
+- (NSInteger)xAxisPointIndexForXPosition:(CGFloat)xPosition strictlyAfter:(BOOL)strictlyAfter {
+    // x axis positions never decrease, so bisect; the last point index is returned when no other point qualifies
+    const CGFloat *positions = [self xAxisPointPositions];
+    NSInteger lowerIndex = 0;
+    NSInteger upperIndex = MAX(self.numberOfXAxisPoints - 1, 0);
+    while (lowerIndex < upperIndex) {
+        NSInteger middleIndex = lowerIndex + (upperIndex - lowerIndex) / 2;
+        BOOL isAfter = strictlyAfter ? (positions[middleIndex] > xPosition) : (positions[middleIndex] >= xPosition);
+        if (isAfter) {
+            upperIndex = middleIndex;
+        } else {
+            lowerIndex = middleIndex + 1;
         }
     }
-    return count;
+    return lowerIndex;
+}
+
+- (NSIndexSet *)validPointIndexesForPlotIndex:(NSInteger)plotIndex {
+    if (plotIndex >= _dataPoints.count) {
+        return [NSIndexSet indexSet];
+    }
+    NSIndexSet *validPointIndexes = _validPointIndexes[@(plotIndex)];
+    if (!validPointIndexes) {
+        validPointIndexes = [_dataPoints[plotIndex] indexesOfObjectsPassingTest:^BOOL(NSObject<ORKValueCollectionType> *dataPoint, NSUInteger index, BOOL *stop) {
+            return !dataPoint.isUnset;
+        }];
+        _validPointIndexes[@(plotIndex)] = validPointIndexes;
+    }
+    return validPointIndexes;
+}
+
+- (NSInteger)pointIndexForXPosition:(CGFloat)xPosition plotIndex:(NSInteger)plotIndex {
+    return [self xAxisPointIndexForXPosition:xPosition strictlyAfter:NO];
+}
+
+- (NSInteger)numberOfValidValuesForPlotIndex:(NSInteger)plotIndex {
+    return [self validPointIndexesForPlotIndex:plotIndex].count;
 }
 
 - (BOOL)isXPositionSnapped:(CGFloat)xPosition plotIndex:(NSInteger)plotIndex {
-    BOOL snapped = NO;
-    CGFloat viewWidth = _plotView.bounds.size.width;
-    NSInteger numberOfXAxisPoints = self.numberOfXAxisPoints;
-    for (NSInteger idx = 0; idx < numberOfXAxisPoints; idx++) {
-        if (xPosition == xAxisPoint(idx, numberOfXAxisPoints, viewWidth)) {
-            snapped = YES;
-            break;
-        }
+    if (self.numberOfXAxisPoints == 0) {
+        return NO;
     }
-    return snapped;
+    NSInteger pointIndex = [self xAxisPointIndexForXPosition:xPosition strictlyAfter:NO];
+    return (xPosition == [self xAxisPointForPointIndex:pointIndex]);
 }
 
 - (CGFloat)snappedXPosition:(CGFloat)xPosition plotIndex:(NSInteger)plotIndex {
     NSInteger numberOfXAxisPoints = self.numberOfXAxisPoints;
+    NSIndexSet *validPointIndexes = [self validPointIndexesForPlotIndex:plotIndex];
+    if (numberOfXAxisPoints == 0 || validPointIndexes.count == 0) {
+        return xPosition;
+    }
+    
+    // Only the closest valid point on either side of xPosition can be close enough to snap to
+    NSInteger pointIndex = [self xAxisPointIndexForXPosition:xPosition strictlyAfter:NO];
+    NSUInteger candidateIndexes[2] = {
+        [validPointIndexes indexLessThanIndex:pointIndex],
+        [validPointIndexes indexGreaterThanOrEqualToIndex:pointIndex]
+    };
     CGFloat widthBetweenPoints = CGRectGetWidth(self.plotView.frame) / numberOfXAxisPoints;
-    NSUInteger positionCount = self.dataPoints[plotIndex].count;
-    for (NSUInteger pointIndex = 0; pointIndex < positionCount; pointIndex++) {
-        
-        double scrubbingValue = [self scrubbingValueForPlotIndex:plotIndex pointIndex:pointIndex];
-        
-        if (scrubbingValue != ORKDoubleInvalidValue) {
-            CGFloat snappedXPosition = xAxisPoint(pointIndex, numberOfXAxisPoints, self.plotView.bounds.size.width);
-            
-            if (fabs(snappedXPosition - xPosition) < (widthBetweenPoints * SnappingClosenessFactor)) {
-                xPosition = snappedXPosition;
-            }
+    CGFloat snappedXPosition = xPosition;
+    CGFloat closestDistance = widthBetweenPoints * SnappingClosenessFactor;
+    for (NSUInteger candidate = 0; candidate < 2; candidate++) {
+        NSUInteger candidateIndex = candidateIndexes[candidate];
+        if (candidateIndex == NSNotFound || candidateIndex >= numberOfXAxisPoints) {
+            continue;
+        }
+        CGFloat candidateXPosition = [self xAxisPointForPointIndex:candidateIndex];
+        if (fabs(candidateXPosition - xPosition) < closestDistance) {
+            closestDistance = fabs(candidateXPosition - xPosition);
+            snappedXPosition = candidateXPosition;
         }
     }
-    return xPosition;
+    return snappedXPosition;
 }
 
 - (double)scrubbingLabelValueForCanvasXPosition:(CGFloat)xPosition plotIndex:(NSInteger)plotIndex {
@@ -903,6 +1070,16 @@ ORK_INLINE CALayer *graphPointLayerWithColor(UIColor *color, BOOL drawPointIndic
             }
 
 - (void)animateLayersSequentiallyWithDuration:(NSTimeInterval)duration plotIndex:(NSInteger)plotIndex {
+    if (_drawsCombinedPlotPaths) {
+        // Each combined path spans the whole plot, so every one is stroked over the full duration at once
+        for (NSMutableArray<CAShapeLayer *> *sublineLayers in self.lineLayers[plotIndex]) {
+            for (CAShapeLayer *layer in sublineLayers) {
+                [self animateLayer:layer keyPath:@"strokeEnd" duration:duration startDelay:0.0];
+            }
+        }
+        return;
+    }
+    
     NSUInteger numberOfLines = self.lineLayers[plotIndex].count;
         if (numberOfLines > 0) {
             CGFloat lineFadeDuration = duration / numberOfLines;
@@ -1062,8 +1239,148 @@ ORK_INLINE CALayer *graphPointLayerWithColor(UIColor *color, BOOL drawPointIndic
 @end
 
 
+/*
+ * Min/max bucketing: for every pixel column keeps the first, last, lowest and highest set point,
+ * which draws the same line as the full series at that resolution.
+ */
+NSIndexSet *ORKDecimatedPointIndexes(NSArray<ORKValueRange *> *points, NSInteger numberOfXAxisPoints, CGFloat canvasWidth, CGFloat pixelScale) {
+    NSMutableIndexSet *indexes = [NSMutableIndexSet indexSet];
+    
+    NSInteger column = NSNotFound;
+    NSUInteger firstIndex = NSNotFound;
+    NSUInteger lastIndex = NSNotFound;
+    NSUInteger lowestIndex = NSNotFound;
+    NSUInteger highestIndex = NSNotFound;
+    double lowestValue = 0;
+    double highestValue = 0;
+    
+    NSUInteger pointCount = points.count;
+    for (NSUInteger pointIndex = 0; pointIndex <= pointCount; pointIndex++) {
+        ORKValueRange *point = (pointIndex < pointCount) ? points[pointIndex] : nil;
+        if (point.isUnset) {
+            continue;
+        }
+        NSInteger pointColumn = point ? (NSInteger)floor(xAxisPoint(pointIndex, numberOfXAxisPoints, canvasWidth) * pixelScale) : NSNotFound;
+        if (pointColumn != column || !point) {
+            if (firstIndex != NSNotFound) {
+                [indexes addIndex:firstIndex];
+                [indexes addIndex:lowestIndex];
+                [indexes addIndex:highestIndex];
+                [indexes addIndex:lastIndex];
+            }
+            column = pointColumn;
+            firstIndex = lowestIndex = highestIndex = pointIndex;
+            lowestValue = point.minimumValue;
+            highestValue = point.maximumValue;
+        }
+        if (!point) {
+            break;
+        }
+        if (point.minimumValue < lowestValue) {
+            lowestValue = point.minimumValue;
+            lowestIndex = pointIndex;
+        }
+        if (point.maximumValue > highestValue) {
+            highestValue = point.maximumValue;
+            highestIndex = pointIndex;
+        }
+        lastIndex = pointIndex;
+    }
+    return indexes;
+}
+
+
+/*
+ * Columnar copy of the values of a plot, which normalization and min/max calculation run over
+ * instead of the ORKValueRange objects. Unset points hold ORKDoubleInvalidValue in both buffers.
+ */
+@interface ORKValueRangePlotBuffer : NSObject
+
+- (instancetype)initWithCount:(NSUInteger)count;
+
+- (instancetype)initWithValueRanges:(NSArray<ORKValueRange *> *)valueRanges;
+
+// Resizing keeps the leading points; added points are zeroed
+@property (nonatomic) NSUInteger count;
+
+@property (nonatomic, readonly) double *minimumValues;
+
+@property (nonatomic, readonly) double *maximumValues;
+
+@property (nonatomic, readonly) BOOL *unsetMask;
+
+- (void)removePointsInRange:(NSRange)range;
+
+@end
+
+
+@implementation ORKValueRangePlotBuffer {
+    NSMutableData *_minimumValuesData;
+    NSMutableData *_maximumValuesData;
+    NSMutableData *_unsetMaskData;
+}
+
+- (instancetype)initWithCount:(NSUInteger)count {
+    self = [super init];
+    if (self) {
+        _count = count;
+        _minimumValuesData = [NSMutableData dataWithLength:count * sizeof(double)];
+        _maximumValuesData = [NSMutableData dataWithLength:count * sizeof(double)];
+        _unsetMaskData = [NSMutableData dataWithLength:count * sizeof(BOOL)];
+    }
+    return self;
+}
+
+- (instancetype)initWithValueRanges:(NSArray<ORKValueRange *> *)valueRanges {
+    self = [self initWithCount:valueRanges.count];
+    if (self) {
+        double *minimumValues = self.minimumValues;
+        double *maximumValues = self.maximumValues;
+        BOOL *unsetMask = self.unsetMask;
+        NSUInteger pointIndex = 0;
+        for (ORKValueRange *valueRange in valueRanges) {
+            minimumValues[pointIndex] = valueRange.minimumValue;
+            maximumValues[pointIndex] = valueRange.maximumValue;
+            unsetMask[pointIndex] = valueRange.isUnset;
+            pointIndex++;
+        }
+    }
+    return self;
+}
+
+- (void)setCount:(NSUInteger)count {
+    _count = count;
+    _minimumValuesData.length = count * sizeof(double);
+    _maximumValuesData.length = count * sizeof(double);
+    _unsetMaskData.length = count * sizeof(BOOL);
+}
+
+- (void)removePointsInRange:(NSRange)range {
+    [_minimumValuesData replaceBytesInRange:NSMakeRange(range.location * sizeof(double), range.length * sizeof(double)) withBytes:NULL length:0];
+    [_maximumValuesData replaceBytesInRange:NSMakeRange(range.location * sizeof(double), range.length * sizeof(double)) withBytes:NULL length:0];
+    [_unsetMaskData replaceBytesInRange:NSMakeRange(range.location * sizeof(BOOL), range.length * sizeof(BOOL)) withBytes:NULL length:0];
+    _count -= range.length;
+}
+
+- (double *)minimumValues {
+    return _minimumValuesData.mutableBytes;
+}
+
+- (double *)maximumValues {
+    return _maximumValuesData.mutableBytes;
+}
+
+- (BOOL *)unsetMask {
+    return _unsetMaskData.mutableBytes;
+}
+
+@end
+
+
 @implementation ORKValueRangeGraphChartView {
     NSMutableArray<NSMutableArray<CALayer *> *> *_pointLayers;
+    NSMutableDictionary<NSNumber *, NSIndexSet *> *_renderedPointIndexes;
+    NSMutableArray<ORKValueRangePlotBuffer *> *_plotBuffers;
             }
 
 @dynamic dataSource;
@@ -1073,14 +1390,33 @@ ORK_INLINE CALayer *graphPointLayerWithColor(UIColor *color, BOOL drawPointIndic
 - (void)sharedInit {
     [super sharedInit];
     _pointLayers = [NSMutableArray new];
+    _renderedPointIndexes = [NSMutableDictionary new];
+    _plotBuffers = [NSMutableArray new];
             }
 
+- (void)setDrawsCombinedPlotPaths:(BOOL)drawsCombinedPlotPaths {
+    [super setDrawsCombinedPlotPaths:drawsCombinedPlotPaths];
+    [self updatePointLayers];
+    [self layoutPointLayers];
+}
+
 - (void)reloadData {
+    [_renderedPointIndexes removeAllObjects];
+    [_plotBuffers removeAllObjects];
     [super reloadData];
     [self updatePointLayers];
     [self setNeedsLayout];
         }
 
+- (void)reloadDataAppendingPointCount:(NSInteger)appendedPointCount removingPointCount:(NSInteger)removedPointCount {
+    [_renderedPointIndexes removeAllObjects];
+    [super reloadDataAppendingPointCount:appendedPointCount removingPointCount:removedPointCount];
+    if (!self.drawsCombinedPlotPaths || _pointLayers.count != [self numberOfPlots]) {
+        [self updatePointLayers];
+    }
+    [self setNeedsLayout];
+}
+
 - (ORKValueRange *)dataPointForPointIndex:(NSInteger)pointIndex plotIndex:(NSInteger)plotIndex {
     return [self.dataSource graphChartView:self dataPointForPointIndex:pointIndex plotIndex:plotIndex];
     }
@@ -1089,27 +1425,119 @@ ORK_INLINE CALayer *graphPointLayerWithColor(UIColor *color, BOOL drawPointIndic
     return [ORKValueRange new];
 }
 
+- (void)obtainDataPointsForPlotIndex:(NSInteger)plotIndex {
+    id<ORKValueRangeGraphChartViewDataSource> dataSource = self.dataSource;
+    if (![dataSource respondsToSelector:@selector(graphChartView:getMinimumValues:maximumValues:unsetMask:range:plotIndex:)]) {
+        [super obtainDataPointsForPlotIndex:plotIndex];
+        [_plotBuffers addObject:[[ORKValueRangePlotBuffer alloc] initWithValueRanges:self.dataPoints[plotIndex]]];
+        return;
+    }
+    
+    // Like the per-point path, pad the plot with unset points up to the number of x axis points
+    NSInteger numberOfPoints = [dataSource graphChartView:self numberOfDataPointsForPlotIndex:plotIndex];
+    ORKValueRangePlotBuffer *buffer = [[ORKValueRangePlotBuffer alloc] initWithCount:MAX(numberOfPoints, self.numberOfXAxisPoints)];
+    [dataSource graphChartView:self
+              getMinimumValues:buffer.minimumValues
+                 maximumValues:buffer.maximumValues
+                     unsetMask:buffer.unsetMask
+                         range:NSMakeRange(0, numberOfPoints)
+                     plotIndex:plotIndex];
+    
+    double *minimumValues = buffer.minimumValues;
+    double *maximumValues = buffer.maximumValues;
+    BOOL *unsetMask = buffer.unsetMask;
+    NSMutableArray<ORKValueRange *> *dataPoints = [NSMutableArray arrayWithCapacity:buffer.count];
+    for (NSUInteger pointIndex = 0; pointIndex < buffer.count; pointIndex++) {
+        if (pointIndex >= numberOfPoints || unsetMask[pointIndex]) {
+            unsetMask[pointIndex] = YES;
+            minimumValues[pointIndex] = maximumValues[pointIndex] = ORKDoubleInvalidValue;
+            [dataPoints addObject:[self dummyPoint]];
+        } else {
+            [dataPoints addObject:[[ORKValueRange alloc] initWithMinimumValue:minimumValues[pointIndex] maximumValue:maximumValues[pointIndex]]];
+            self.hasDataPoints = YES;
+        }
+    }
+    [self.dataPoints addObject:dataPoints];
+    [_plotBuffers addObject:buffer];
+}
+
+- (void)updateDataPointsForPlotIndex:(NSInteger)plotIndex appendedPointCount:(NSInteger)appendedPointCount removedPointCount:(NSInteger)removedPointCount {
+    NSMutableArray<ORKValueRange *> *dataPoints = self.dataPoints[plotIndex];
+    ORKValueRangePlotBuffer *buffer = _plotBuffers[plotIndex];
+    id<ORKValueRangeGraphChartViewDataSource> dataSource = self.dataSource;
+    NSInteger numberOfPoints = [dataSource graphChartView:self numberOfDataPointsForPlotIndex:plotIndex];
+    NSInteger keptPointCount = numberOfPoints - appendedPointCount;
+    
+    // Drop the dummy padding and the oldest points from both the objects and the buffer
+    NSInteger previousNumberOfPoints = keptPointCount + removedPointCount;
+    [dataPoints removeObjectsInRange:NSMakeRange(previousNumberOfPoints, dataPoints.count - previousNumberOfPoints)];
+    [dataPoints removeObjectsInRange:NSMakeRange(0, removedPointCount)];
+    buffer.count = previousNumberOfPoints;
+    [buffer removePointsInRange:NSMakeRange(0, removedPointCount)];
+    buffer.count = MAX(numberOfPoints, self.numberOfXAxisPoints);
+    
+    double *minimumValues = buffer.minimumValues;
+    double *maximumValues = buffer.maximumValues;
+    BOOL *unsetMask = buffer.unsetMask;
+    BOOL fetchesInBulk = [dataSource respondsToSelector:@selector(graphChartView:getMinimumValues:maximumValues:unsetMask:range:plotIndex:)];
+    if (fetchesInBulk) {
+        // Only the appended points are fetched, straight into their place in the buffer
+        [dataSource graphChartView:self
+                  getMinimumValues:minimumValues + keptPointCount
+                     maximumValues:maximumValues + keptPointCount
+                         unsetMask:unsetMask + keptPointCount
+                             range:NSMakeRange(keptPointCount, appendedPointCount)
+                         plotIndex:plotIndex];
+    }
+    
+    for (NSUInteger pointIndex = keptPointCount; pointIndex < buffer.count; pointIndex++) {
+        ORKValueRange *dataPoint = nil;
+        if (pointIndex >= numberOfPoints) {
+            dataPoint = [self dummyPoint];
+        } else if (fetchesInBulk) {
+            dataPoint = unsetMask[pointIndex] ? [self dummyPoint] : [[ORKValueRange alloc] initWithMinimumValue:minimumValues[pointIndex] maximumValue:maximumValues[pointIndex]];
+        } else {
+            dataPoint = [self dataPointForPointIndex:pointIndex plotIndex:plotIndex];
+        }
+        unsetMask[pointIndex] = dataPoint.isUnset;
+        minimumValues[pointIndex] = dataPoint.isUnset ? ORKDoubleInvalidValue : dataPoint.minimumValue;
+        maximumValues[pointIndex] = dataPoint.isUnset ? ORKDoubleInvalidValue : dataPoint.maximumValue;
+        [dataPoints addObject:dataPoint];
+    }
+}
+
 - (NSMutableArray<ORKValueRange *> *)normalizedCanvasDataPointsForPlotIndex:(NSInteger)plotIndex canvasHeight:(CGFloat)viewHeight {
     NSMutableArray<ORKValueRange *> *normalizedPoints = [NSMutableArray new];
     
-    if (plotIndex < self.dataPoints.count) {
-        NSUInteger pointCount = self.dataPoints[plotIndex].count;
+    if (plotIndex < _plotBuffers.count) {
+        ORKValueRangePlotBuffer *buffer = _plotBuffers[plotIndex];
+        NSUInteger pointCount = buffer.count;
+        NSMutableData *normalizedMinimumValuesData = [NSMutableData dataWithLength:pointCount * sizeof(double)];
+        NSMutableData *normalizedMaximumValuesData = [NSMutableData dataWithLength:pointCount * sizeof(double)];
+        double *normalizedMinimumValues = normalizedMinimumValuesData.mutableBytes;
+        double *normalizedMaximumValues = normalizedMaximumValuesData.mutableBytes;
+        
+        [ORKChartLayoutEngine normalizeValues:buffer.minimumValues
+                                        count:pointCount
+                                 minimumValue:self.minimumValue
+                                 maximumValue:self.maximumValue
+                                 canvasHeight:viewHeight
+                             normalizedValues:normalizedMinimumValues];
+        [ORKChartLayoutEngine normalizeValues:buffer.maximumValues
+                                        count:pointCount
+                                 minimumValue:self.minimumValue
+                                 maximumValue:self.maximumValue
+                                 canvasHeight:viewHeight
+                             normalizedValues:normalizedMaximumValues];
+        
+        const BOOL *unsetMask = buffer.unsetMask;
         for (NSUInteger pointIndex = 0; pointIndex < pointCount; pointIndex++) {
-            
             ORKValueRange *normalizedRangePoint = [ORKValueRange new];
-            ORKValueRange *dataPointValue = self.dataPoints[plotIndex][pointIndex];
-            
-            if (dataPointValue.isUnset) {
+            if (unsetMask[pointIndex]) {
                 normalizedRangePoint.minimumValue = normalizedRangePoint.maximumValue = viewHeight;
-            } else if (self.minimumValue == self.maximumValue) {
-                normalizedRangePoint.minimumValue = normalizedRangePoint.maximumValue = viewHeight / 2;
             } else {
-                double range = self.maximumValue - self.minimumValue;
-                double normalizedMinimumValue = (dataPointValue.minimumValue - self.minimumValue) / range * viewHeight;
-                double normalizedMaximumValue = (dataPointValue.maximumValue - self.minimumValue) / range * viewHeight;
-                
-                normalizedRangePoint.minimumValue = viewHeight - normalizedMinimumValue;
-                normalizedRangePoint.maximumValue = viewHeight - normalizedMaximumValue;
+                normalizedRangePoint.minimumValue = normalizedMinimumValues[pointIndex];
+                normalizedRangePoint.maximumValue = normalizedMaximumValues[pointIndex];
             }
             [normalizedPoints addObject:normalizedRangePoint];
         }
@@ -1136,23 +1564,31 @@ ORK_INLINE CALayer *graphPointLayerWithColor(UIColor *color, BOOL drawPointIndic
     }
     
     if (!minimumValueProvided || !maximumValueProvided) {
-        NSInteger numberOfPlots = [self numberOfPlots];
+        double minimumValue = self.minimumValue;
+        double maximumValue = self.maximumValue;
+        NSInteger numberOfPlots = MIN([self numberOfPlots], (NSInteger)_plotBuffers.count);
         for (NSInteger plotIndex = 0; plotIndex < numberOfPlots; plotIndex++) {
-            NSInteger numberOfPlotPoints = self.dataPoints[plotIndex].count;
-            for (NSInteger pointIndex = 0; pointIndex < numberOfPlotPoints; pointIndex++) {
-                ORKValueRange *point = self.dataPoints[plotIndex][pointIndex];
+            ORKValueRangePlotBuffer *buffer = _plotBuffers[plotIndex];
+            const double *minimumValues = buffer.minimumValues;
+            const double *maximumValues = buffer.maximumValues;
+            NSUInteger numberOfPlotPoints = buffer.count;
+            for (NSUInteger pointIndex = 0; pointIndex < numberOfPlotPoints; pointIndex++) {
+                double pointMinimumValue = minimumValues[pointIndex];
+                double pointMaximumValue = maximumValues[pointIndex];
                 if (!minimumValueProvided &&
-                    point.minimumValue != ORKDoubleInvalidValue &&
-                    ((self.minimumValue == ORKDoubleInvalidValue) || (point.minimumValue < self.minimumValue))) {
-                    self.minimumValue = point.minimumValue;
+                    pointMinimumValue != ORKDoubleInvalidValue &&
+                    ((minimumValue == ORKDoubleInvalidValue) || (pointMinimumValue < minimumValue))) {
+                    minimumValue = pointMinimumValue;
                 }
                 if (!maximumValueProvided &&
-                    point.maximumValue != ORKDoubleInvalidValue &&
-                    ((self.maximumValue == ORKDoubleInvalidValue) || (point.maximumValue > self.maximumValue))) {
-                    self.maximumValue = point.maximumValue;
+                    pointMaximumValue != ORKDoubleInvalidValue &&
+                    ((maximumValue == ORKDoubleInvalidValue) || (pointMaximumValue > maximumValue))) {
+                    maximumValue = pointMaximumValue;
                 }
             }
         }
+        self.minimumValue = minimumValue;
+        self.maximumValue = maximumValue;
     }
     
     if (self.minimumValue == ORKDoubleInvalidValue) {
@@ -1163,15 +1599,89 @@ ORK_INLINE CALayer *graphPointLayerWithColor(UIColor *color, BOOL drawPointIndic
     }
 }
 
+#pragma mark - Decimation
+
+- (BOOL)decimatesPointsForPlotIndex:(NSInteger)plotIndex {
+    return NO;
+}
+
+- (NSIndexSet *)computeRenderedPointIndexesForPlotIndex:(NSInteger)plotIndex {
+    if (plotIndex >= self.dataPoints.count || ![self decimatesPointsForPlotIndex:plotIndex]) {
+        return nil;
+    }
+    
+    // Before the first layout, assume the plot spans the screen
+    CGFloat canvasWidth = self.plotView.bounds.size.width;
+    if (canvasWidth <= 0) {
+        canvasWidth = [UIScreen mainScreen].bounds.size.width;
+    }
+    CGFloat pixelScale = [UIScreen mainScreen].scale;
+    
+    // Up to four points are kept per pixel column, so smaller plots are not worth decimating
+    NSArray<ORKValueRange *> *points = self.dataPoints[plotIndex];
+    if (points.count <= 4 * ceil(canvasWidth * pixelScale)) {
+        return nil;
+    }
+    return ORKDecimatedPointIndexes(points, self.numberOfXAxisPoints, canvasWidth, pixelScale);
+}
+
+- (NSIndexSet *)renderedPointIndexesForPlotIndex:(NSInteger)plotIndex {
+    id indexes = _renderedPointIndexes[@(plotIndex)];
+    if (!indexes) {
+        indexes = [self computeRenderedPointIndexesForPlotIndex:plotIndex] ? : [NSNull null];
+        _renderedPointIndexes[@(plotIndex)] = indexes;
+    }
+    return (indexes == [NSNull null]) ? nil : indexes;
+}
+
+- (BOOL)isPointIndexRendered:(NSInteger)pointIndex plotIndex:(NSInteger)plotIndex {
+    if (self.dataPoints[plotIndex][pointIndex].isUnset) {
+        return NO;
+    }
+    NSIndexSet *indexes = [self renderedPointIndexesForPlotIndex:plotIndex];
+    return (indexes == nil) || [indexes containsIndex:pointIndex];
+}
+
+- (void)plotViewWidthDidChange {
+    [super plotViewWidthDidChange];
+    
+    // Decimation depends on the number of pixel columns, so rebuild the layers if it changed
+    BOOL renderedPointsChanged = NO;
+    NSInteger numberOfPlots = MIN([self numberOfPlots], (NSInteger)self.dataPoints.count);
+    for (NSInteger plotIndex = 0; plotIndex < numberOfPlots; plotIndex++) {
+        if (![self decimatesPointsForPlotIndex:plotIndex]) {
+            continue;
+        }
+        NSIndexSet *indexes = [self computeRenderedPointIndexesForPlotIndex:plotIndex];
+        NSIndexSet *previousIndexes = [self renderedPointIndexesForPlotIndex:plotIndex];
+        if (indexes != previousIndexes && ![indexes isEqualToIndexSet:previousIndexes]) {
+            _renderedPointIndexes[@(plotIndex)] = indexes ? : [NSNull null];
+            renderedPointsChanged = YES;
+        }
+    }
+    if (renderedPointsChanged) {
+        [self updateLineLayers];
+        [self updatePointLayers];
+    }
+}
+
 #pragma mark - Layout & Drawing
 
 - (void)updatePointLayersForPlotIndex:(NSInteger)plotIndex {
-    if (plotIndex < self.dataPoints.count) {
+    if (plotIndex < self.dataPoints.count && self.drawsCombinedPlotPaths) {
+        // One layer draws the point indicators of the whole plot
+        CAShapeLayer *pointsLayer = [CAShapeLayer layer];
+        pointsLayer.fillColor = [UIColor whiteColor].CGColor;
+        pointsLayer.strokeColor = [self colorForPlotIndex:plotIndex].CGColor;
+        pointsLayer.lineWidth = ORKGraphChartViewPointIndicatorLineWidth;
+        [self.plotView.layer addSublayer:pointsLayer];
+        [_pointLayers[plotIndex] addObject:pointsLayer];
+    } else if (plotIndex < self.dataPoints.count) {
         UIColor *color = [self colorForPlotIndex:plotIndex];
         NSUInteger pointCount = self.dataPoints[plotIndex].count;
         for (NSUInteger pointIndex = 0; pointIndex < pointCount; pointIndex++) {
             ORKValueRange *dataPoint = self.dataPoints[plotIndex][pointIndex];
-            if (!dataPoint.isUnset) {
+            if ([self isPointIndexRendered:pointIndex plotIndex:plotIndex]) {
                 BOOL drawPointIndicator = [self shouldDrawPointIndicatorForPointWithIndex:pointIndex inPlotWithIndex:plotIndex];
                 CALayer *pointLayer = graphPointLayerWithColor(color, drawPointIndicator);
                 [self.plotView.layer addSublayer:pointLayer];
@@ -1190,6 +1700,12 @@ ORK_INLINE CALayer *graphPointLayerWithColor(UIColor *color, BOOL drawPointIndic
 - (void)updatePlotColorsForPlotIndex:(NSInteger)plotIndex {
     [super updatePlotColorsForPlotIndex:plotIndex];
     UIColor *color = [self colorForPlotIndex:plotIndex];
+    if (self.drawsCombinedPlotPaths) {
+        for (CAShapeLayer *pointsLayer in _pointLayers[plotIndex]) {
+            pointsLayer.strokeColor = color.CGColor;
+        }
+        return;
+    }
     for (NSUInteger pointIndex = 0; pointIndex < _pointLayers[plotIndex].count; pointIndex++) {
         CALayer *pointLayer = _pointLayers[plotIndex][pointIndex];
         if (pointLayer.contents) {
@@ -1230,12 +1746,41 @@ ORK_INLINE CALayer *graphPointLayerWithColor(UIColor *color, BOOL drawPointIndic
     }
 }
 
+- (void)layoutCombinedPointLayerForPlotIndex:(NSInteger)plotIndex {
+    const CGFloat indicatorSize = ORKGraphChartViewPointAndLineWidth - ORKGraphChartViewPointIndicatorLineWidth;
+    UIBezierPath *pointsPath = [UIBezierPath bezierPath];
+    CGFloat xOffset = [self xOffsetForPlotIndex:plotIndex];
+    CGFloat viewWidth = self.plotView.bounds.size.width;
+    NSUInteger pointCount = self.dataPoints[plotIndex].count;
+    for (NSUInteger pointIndex = 0; pointIndex < pointCount; pointIndex++) {
+        if (![self isPointIndexRendered:pointIndex plotIndex:plotIndex]
+            || ![self shouldDrawPointIndicatorForPointWithIndex:pointIndex inPlotWithIndex:plotIndex]) {
+            continue;
+        }
+        CGFloat positionOnXAxis = xAxisPoint(pointIndex, self.numberOfXAxisPoints, viewWidth) + xOffset;
+        ORKValueRange *yAxisValueRange = self.yAxisPoints[plotIndex][pointIndex];
+        [pointsPath appendPath:[UIBezierPath bezierPathWithOvalInRect:CGRectMake(positionOnXAxis - indicatorSize / 2,
+                                                                                 yAxisValueRange.minimumValue - indicatorSize / 2,
+                                                                                 indicatorSize,
+                                                                                 indicatorSize)]];
+        if (!yAxisValueRange.isEmptyRange) {
+            [pointsPath appendPath:[UIBezierPath bezierPathWithOvalInRect:CGRectMake(positionOnXAxis - indicatorSize / 2,
+                                                                                     yAxisValueRange.maximumValue - indicatorSize / 2,
+                                                                                     indicatorSize,
+                                                                                     indicatorSize)]];
+        }
+    }
+    CAShapeLayer *pointsLayer = (CAShapeLayer *)_pointLayers[plotIndex].firstObject;
+    pointsLayer.path = pointsPath.CGPath;
+}
+
 - (void)layoutPointLayersForPlotIndex:(NSInteger)plotIndex {
-    if (plotIndex < self.dataPoints.count) {
+    if (plotIndex < self.dataPoints.count && self.drawsCombinedPlotPaths) {
+        [self layoutCombinedPointLayerForPlotIndex:plotIndex];
+    } else if (plotIndex < self.dataPoints.count) {
         NSUInteger pointLayerIndex = 0;
         for (NSUInteger pointIndex = 0; pointIndex < self.dataPoints[plotIndex].count; pointIndex++) {
-            ORKValueRange *dataPointValue = self.dataPoints[plotIndex][pointIndex];
-            if (!dataPointValue.isUnset) {
+            if ([self isPointIndexRendered:pointIndex plotIndex:plotIndex]) {
                 CGFloat positionOnXAxis = xAxisPoint(pointIndex, self.numberOfXAxisPoints, self.plotView.bounds.size.width);
                 positionOnXAxis += [self xOffsetForPlotIndex:plotIndex];
                 ORKValueRange *yAxisValueRange = self.yAxisPoints[plotIndex][pointIndex];
@@ -64,6 +64,7 @@ typedef NS_ENUM(NSUInteger, ORKGraphAnimationType) {
 
 extern const CGFloat ORKGraphChartViewLeftPadding;
 extern const CGFloat ORKGraphChartViewPointAndLineWidth;
+extern const CGFloat ORKGraphChartViewPointIndicatorLineWidth;
 extern const CGFloat ORKGraphChartViewScrubberMoveAnimationDuration;
 extern const CGFloat ORKGraphChartViewAxisTickLength;
 extern const CGFloat ORKGraphChartViewYAxisTickPadding;
@@ -85,6 +86,9 @@ ORK_INLINE CGFloat xAxisPoint(NSInteger pointIndex, NSInteger numberOfXAxisPoint
     return floor((canvasWidth / MAX(1, numberOfXAxisPoints - 1)) * pointIndex);
 }
 
+// The indexes of the first, last, lowest and highest set point of each pixel column
+NSIndexSet *ORKDecimatedPointIndexes(NSArray<ORKValueRange *> *points, NSInteger numberOfXAxisPoints, CGFloat canvasWidth, CGFloat pixelScale);
+
 ORK_INLINE CGFloat xOffsetForPlotIndex(NSInteger plotIndex, NSInteger numberOfPlots, CGFloat plotWidth) {
     CGFloat offset = 0;
     if (numberOfPlots % 2 == 0) {
@@ -140,6 +144,15 @@ ORK_INLINE CGFloat xOffsetForPlotIndex(NSInteger plotIndex, NSInteger numberOfPl
 
 - (NSInteger)pointIndexForXPosition:(CGFloat)xPosition plotIndex:(NSInteger)plotIndex;
 
+// Looked up in a table of x axis positions that is rebuilt when the point count or plot view width changes
+- (CGFloat)xAxisPointForPointIndex:(NSInteger)pointIndex;
+
+// Bisects the x axis positions for the first point at (or strictly after) xPosition, falling back to the last point
+- (NSInteger)xAxisPointIndexForXPosition:(CGFloat)xPosition strictlyAfter:(BOOL)strictlyAfter;
+
+// The indexes of the points that are not unset, cached until the data changes
+- (NSIndexSet *)validPointIndexesForPlotIndex:(NSInteger)plotIndex;
+
 - (void)updateScrubberViewForXPosition:(CGFloat)xPosition plotIndex:(NSInteger)plotIndex;
 
 - (void)updateScrubberLineAccessories:(CGFloat)xPosition plotIndex:(NSInteger)plotIndex;
@@ -150,10 +163,26 @@ ORK_INLINE CGFloat xOffsetForPlotIndex(NSInteger plotIndex, NSInteger numberOfPl
 
 - (void)updatePlotColors;
 
+- (void)updatePlotColorsForPlotIndex:(NSInteger)plotIndex;
+
 - (void)updateLineLayers;
 
+/*
+ Recreates the line layers of the plots for which `lineLayersNeedUpdateForPlotIndex:` returns YES
+ and keeps the others. Used by incremental reloads in combined mode, where the layers of a plot do
+ not depend on its number of points.
+ */
+- (void)updateLineLayersIfNeeded;
+
+- (BOOL)lineLayersNeedUpdateForPlotIndex:(NSInteger)plotIndex;
+
+- (void)removeLineLayersForPlotIndex:(NSInteger)plotIndex;
+
 - (void)layoutLineLayers;
 
+// Called during layout, before the points are normalized, whenever the plot view width changes
+- (void)plotViewWidthDidChange;
+
 - (UIColor *)colorForPlotIndex:(NSInteger)plotIndex subpointIndex:(NSInteger)subpointIndex totalSubpoints:(NSInteger)totalSubpoints;
 
 - (UIColor *)colorForPlotIndex:(NSInteger)plotIndex;
@@ -182,6 +211,16 @@ ORK_INLINE CGFloat xOffsetForPlotIndex(NSInteger plotIndex, NSInteger numberOfPl
 
 - (void)layoutPointLayers;
 
+/*
+ Plots with many more points than the plot view has pixel columns can be decimated: only the first,
+ last, lowest and highest point of each pixel column get line and point layers, which bounds the
+ layer count by the view width while keeping peaks visible. Returns NO by default.
+ */
+- (BOOL)decimatesPointsForPlotIndex:(NSInteger)plotIndex;
+
+// Whether the point gets layers; always YES for set points of plots that are not decimated
+- (BOOL)isPointIndexRendered:(NSInteger)pointIndex plotIndex:(NSInteger)plotIndex;
+
 @end
 
 NS_ASSUME_NONNULL_END
@@ -114,6 +114,10 @@ const CGFloat FillColorAlpha = 0.4;
     return [self numberOfValidValuesForPlotIndex:plotIndex] > 1;
 }
 
+- (BOOL)decimatesPointsForPlotIndex:(NSInteger)plotIndex {
+    return YES;
+}
+
 #pragma mark - Drawing
 
 - (UIColor *)fillColorForPlotIndex:(NSInteger)plotIndex {
@@ -141,6 +145,12 @@ const CGFloat FillColorAlpha = 0.4;
     [super updateLineLayers];
 }
 
+- (void)removeLineLayersForPlotIndex:(NSInteger)plotIndex {
+    [_fillLayers[@(plotIndex)] removeFromSuperlayer];
+    [_fillLayers removeObjectForKey:@(plotIndex)];
+    [super removeLineLayersForPlotIndex:plotIndex];
+}
+
 - (void)updateLineLayersForPlotIndex:(NSInteger)plotIndex {
     // Fill
     CAShapeLayer *fillLayer = [CAShapeLayer layer];
@@ -150,6 +160,14 @@ const CGFloat FillColorAlpha = 0.4;
     _fillLayers[@(plotIndex)] = fillLayer;
 
     // Lines
+    if (self.drawsCombinedPlotPaths) {
+        // One solid and one dashed layer for the whole plot
+        CAShapeLayer *lineLayer = [self lineLayerForPlotIndex:plotIndex dashed:NO];
+        CAShapeLayer *dashedLineLayer = [self lineLayerForPlotIndex:plotIndex dashed:YES];
+        [self.lineLayers[plotIndex] addObject:[NSMutableArray arrayWithObjects:lineLayer, dashedLineLayer, nil]];
+        return;
+    }
+    
     BOOL previousPointExists = NO;
     BOOL emptyDataPresent = NO;
     NSUInteger pointCount = self.dataPoints[plotIndex].count;
@@ -159,6 +177,9 @@ const CGFloat FillColorAlpha = 0.4;
             emptyDataPresent = YES;
             continue;
         }
+        if (![self isPointIndexRendered:pointIndex plotIndex:plotIndex]) {
+            continue;
+        }
         
         if (!previousPointExists) {
             previousPointExists = YES;
@@ -166,20 +187,25 @@ const CGFloat FillColorAlpha = 0.4;
             continue;
         }
         
-        CAShapeLayer *lineLayer = graphLineLayer();
-        lineLayer.strokeColor = [self colorForPlotIndex:plotIndex].CGColor;
-        lineLayer.lineWidth = 2.0;
-        
-        if (emptyDataPresent) {
-            lineLayer.lineDashPattern = @[@12, @6];
-            emptyDataPresent = NO;
-        }
-        
-        [self.plotView.layer addSublayer:lineLayer];
+        CAShapeLayer *lineLayer = [self lineLayerForPlotIndex:plotIndex dashed:emptyDataPresent];
+        emptyDataPresent = NO;
         [self.lineLayers[plotIndex][pointIndex - 1] addObject:lineLayer];
     }
 }
 
+- (CAShapeLayer *)lineLayerForPlotIndex:(NSInteger)plotIndex dashed:(BOOL)dashed {
+    CAShapeLayer *lineLayer = graphLineLayer();
+    lineLayer.strokeColor = [self colorForPlotIndex:plotIndex].CGColor;
+    lineLayer.lineWidth = 2.0;
+    
+    if (dashed) {
+        lineLayer.lineDashPattern = @[@12, @6];
+    }
+    
+    [self.plotView.layer addSublayer:lineLayer];
+    return lineLayer;
+}
+
 - (void)layoutLineLayersForPlotIndex:(NSInteger)plotIndex {
     CAShapeLayer *fillLayer = _fillLayers[@(plotIndex)];
     
@@ -188,19 +214,38 @@ const CGFloat FillColorAlpha = 0.4;
         return;
     }
     
+    // Segments following unset points are dashed; in combined mode they go to their own path
+    BOOL drawsCombinedPlotPaths = self.drawsCombinedPlotPaths;
+    UIBezierPath *combinedLinePath = [UIBezierPath bezierPath];
+    UIBezierPath *combinedDashedLinePath = [UIBezierPath bezierPath];
+    
     UIBezierPath *fillPath = [UIBezierPath bezierPath];
     CGFloat positionOnXAxis = ORKCGFloatInvalidValue;
     ORKValueRange *positionOnYAxis = nil;
     BOOL previousPointExists = NO;
-    NSUInteger numberOfPoints = self.lineLayers[plotIndex].count;
+    BOOL emptyDataPresent = NO;
+    NSUInteger numberOfPoints = self.dataPoints[plotIndex].count;
     for (NSUInteger pointIndex = 0; pointIndex < numberOfPoints; pointIndex++) {
         if (self.dataPoints[plotIndex][pointIndex].isUnset) {
+            emptyDataPresent = YES;
+            continue;
+        }
+        if (![self isPointIndexRendered:pointIndex plotIndex:plotIndex]) {
             continue;
         }
-        UIBezierPath *linePath = [UIBezierPath bezierPath];
+        UIBezierPath *linePath = nil;
+        if (drawsCombinedPlotPaths) {
+            linePath = emptyDataPresent ? combinedDashedLinePath : combinedLinePath;
+        } else {
+            linePath = [UIBezierPath bezierPath];
+        }
+        emptyDataPresent = NO;
         
         if (positionOnXAxis != ORKCGFloatInvalidValue) {
-            [linePath moveToPoint:CGPointMake(positionOnXAxis, positionOnYAxis.minimumValue)];
+            CGPoint previousPoint = CGPointMake(positionOnXAxis, positionOnYAxis.minimumValue);
+            if (linePath.isEmpty || !CGPointEqualToPoint(linePath.currentPoint, previousPoint)) {
+                [linePath moveToPoint:previousPoint];
+            }
             if ([fillPath isEmpty]) {
                 // Substract scalePixelAdjustment() to the first horizontal position of the fillPath so if fully covers the start of the x axis
                 [fillPath moveToPoint:CGPointMake(positionOnXAxis - scalePixelAdjustment(),
@@ -227,8 +272,16 @@ const CGFloat FillColorAlpha = 0.4;
         [fillPath addLineToPoint:CGPointMake(positionOnXAxis + ( (pointIndex == (numberOfPoints - 1)) ? scalePixelAdjustment() : 0 ),
                                              positionOnYAxis.minimumValue)];
         
-        CAShapeLayer *lineLayer = self.lineLayers[plotIndex][pointIndex - 1][0];
-        lineLayer.path = linePath.CGPath;
+        if (!drawsCombinedPlotPaths) {
+            CAShapeLayer *lineLayer = self.lineLayers[plotIndex][pointIndex - 1][0];
+            lineLayer.path = linePath.CGPath;
+        }
+    }
+    
+    NSArray<CAShapeLayer *> *combinedLineLayers = self.lineLayers[plotIndex].firstObject;
+    if (drawsCombinedPlotPaths && combinedLineLayers.count == 2) {
+        combinedLineLayers[0].path = combinedLinePath.CGPath;
+        combinedLineLayers[1].path = combinedDashedLinePath.CGPath;
     }
     
     [fillPath addLineToPoint:CGPointMake(positionOnXAxis + scalePixelAdjustment(),
@@ -243,21 +296,13 @@ const CGFloat FillColorAlpha = 0.4;
     double value = [super scrubbingLabelValueForCanvasXPosition:xPosition plotIndex:plotIndex];
     
     if (value == ORKDoubleInvalidValue) {
-    CGFloat viewWidth = self.plotView.bounds.size.width;
-    NSInteger numberOfXAxisPoints = self.numberOfXAxisPoints;
-        NSInteger pointIndex = 0;
-        for (pointIndex = 0; pointIndex < (numberOfXAxisPoints - 1); pointIndex++) {
-            CGFloat xAxisPointValue = xAxisPoint(pointIndex, numberOfXAxisPoints, viewWidth);
-            if (xAxisPointValue > xPosition) {
-                break;
-            }
-        }
+        NSInteger pointIndex = [self xAxisPointIndexForXPosition:xPosition strictlyAfter:YES];
         
         NSInteger previousValidIndex = [self previousValidPointIndexForPointIndex:pointIndex plotIndex:plotIndex];
         NSInteger nextValidIndex = [self nextValidPointIndexForPointIndex:pointIndex plotIndex:plotIndex];
         
-        CGFloat x1 = xAxisPoint(previousValidIndex, numberOfXAxisPoints, viewWidth);
-        CGFloat x2 = xAxisPoint(nextValidIndex, numberOfXAxisPoints, viewWidth);
+        CGFloat x1 = [self xAxisPointForPointIndex:previousValidIndex];
+        CGFloat x2 = [self xAxisPointForPointIndex:nextValidIndex];
         
         double y1 = self.dataPoints[plotIndex][previousValidIndex].minimumValue;
         double y2 = self.dataPoints[plotIndex][nextValidIndex].minimumValue;
@@ -283,12 +328,9 @@ const CGFloat FillColorAlpha = 0.4;
     if (nextValidIndex == previousValidIndex) {
         canvasYPosition = self.yAxisPoints[plotIndex][previousValidIndex].minimumValue;
     } else {
-    CGFloat viewWidth = self.plotView.bounds.size.width;
-    NSInteger numberOfXAxisPoints = self.numberOfXAxisPoints;
-
-    CGFloat x1 = xAxisPoint(previousValidIndex, numberOfXAxisPoints, viewWidth);
-    CGFloat x2 = xAxisPoint(nextValidIndex, numberOfXAxisPoints, viewWidth);
-    
+        CGFloat x1 = [self xAxisPointForPointIndex:previousValidIndex];
+        CGFloat x2 = [self xAxisPointForPointIndex:nextValidIndex];
+        
         double y1 = self.yAxisPoints[plotIndex][previousValidIndex].minimumValue;
         double y2 = self.yAxisPoints[plotIndex][nextValidIndex].minimumValue;
         
@@ -301,31 +343,20 @@ const CGFloat FillColorAlpha = 0.4;
 }
 
 - (NSInteger)nextValidPointIndexForPointIndex:(NSInteger)pointIndex plotIndex:(NSInteger)plotIndex {
-    NSUInteger validPosition = pointIndex;
-    
-    NSUInteger pointCountMinusOne = (self.dataPoints[plotIndex].count - 1);
-    while (validPosition < pointCountMinusOne) {
-        if (self.dataPoints[plotIndex][validPosition].minimumValue != ORKDoubleInvalidValue) {
-            break;
-        }
-        validPosition++;
+    // Falls back to the last point when no later point is valid
+    NSInteger lastPointIndex = self.dataPoints[plotIndex].count - 1;
+    if (pointIndex >= lastPointIndex) {
+        return pointIndex;
     }
-    
-    return validPosition;
+    NSUInteger validPosition = [[self validPointIndexesForPlotIndex:plotIndex] indexGreaterThanOrEqualToIndex:pointIndex];
+    return (validPosition == NSNotFound) ? lastPointIndex : MIN((NSInteger)validPosition, lastPointIndex);
 }
 
 - (NSInteger)previousValidPointIndexForPointIndex:(NSInteger)pointIndex plotIndex:(NSInteger)plotIndex {
-    NSInteger validPosition = pointIndex - 1;
-    if (validPosition < 0) {
-        validPosition = 0;
-    }
-    while (validPosition > 0) {
-        if (self.dataPoints[plotIndex][validPosition].minimumValue != ORKDoubleInvalidValue) {
-            break;
-        }
-        validPosition--;
-    }
-    return validPosition;
+    // Falls back to the first point when no earlier point is valid
+    NSInteger startPosition = MAX(pointIndex - 1, 0);
+    NSUInteger validPosition = [[self validPointIndexesForPlotIndex:plotIndex] indexLessThanOrEqualToIndex:startPosition];
+    return (validPosition == NSNotFound) ? 0 : validPosition;
 }
 
 #pragma mark - Animations
@@ -33,13 +33,12 @@
 
 #import "ORKPieChartPieView.h"
 
+#import "ORKChartLayoutEngine.h"
 #import "ORKPieChartView_Internal.h"
 
 #import "ORKHelpers_Internal.h"
 
 
-static const CGFloat OriginAngle = -M_PI_2;
-static const CGFloat PercentageLabelOffset = 10.0;
 static const CGFloat InterAnimationDelay = 0.05;
 
 @implementation ORKPieChartPieView {
@@ -97,18 +96,14 @@ static const CGFloat InterAnimationDelay = 0.05;
     
     CGFloat sumOfValues = 0;
     NSInteger numberOfSegments = [_parentPieChartView.dataSource numberOfSegmentsInPieChartView:_parentPieChartView];
+    NSMutableArray<NSNumber *> *values = [NSMutableArray arrayWithCapacity:numberOfSegments];
     for (NSInteger idx = 0; idx < numberOfSegments; idx++) {
         CGFloat value = [_parentPieChartView.dataSource pieChartView:_parentPieChartView valueForSegmentAtIndex:idx];
+        [values addObject:@(value)];
         sumOfValues += value;
     }
     
-    for (NSInteger idx = 0; idx < numberOfSegments; idx++) {
-        CGFloat value = 0;
-        if (sumOfValues != 0) {
-            value = [_parentPieChartView.dataSource pieChartView:_parentPieChartView valueForSegmentAtIndex:idx] / sumOfValues;
-        }
-        [_normalizedValues addObject:@(value)];
-    }
+    [_normalizedValues addObjectsFromArray:[ORKChartLayoutEngine normalizedPieValues:values]];
     return sumOfValues;
 }
 
@@ -116,35 +111,27 @@ static const CGFloat InterAnimationDelay = 0.05;
 
 - (void)layoutSubviews {
     [super layoutSubviews];
-    CGRect bounds = self.bounds;
-    CGFloat startAngle = OriginAngle;
-    CGFloat endAngle = startAngle + (2 * M_PI);
-    CGFloat outerRadius = bounds.size.height * _radiusScaleFactor;
+    CGSize size = self.bounds.size;
     CGFloat labelHeight = [@"100%" boundingRectWithSize:CGRectInfinite.size
                                                 options:(NSStringDrawingOptions)0
                                              attributes:@{NSFontAttributeName : _percentageLabelFont}
                                                 context:nil].size.height;
-    CGFloat innerRadius = outerRadius - (labelHeight + PercentageLabelOffset);
-    CGFloat targetRadius = _parentPieChartView.showsPercentageLabels ? innerRadius : outerRadius;
-    CGFloat lineWidth = MIN(_parentPieChartView.lineWidth, targetRadius);
-    _circleLayer.lineWidth = lineWidth;
-    CGFloat drawingRadius = targetRadius - (lineWidth * 0.5);
-    
-    if (!_parentPieChartView.drawsClockwise) {
-        startAngle = 3 * M_PI_2;
-        endAngle = -M_PI_2;
-    }
-    UIBezierPath *circularArcBezierPath = [UIBezierPath bezierPathWithArcCenter:CGPointMake(CGRectGetMidX(bounds),
-                                                                                            CGRectGetMidY(bounds))
-                                                                         radius:drawingRadius
-                                                                     startAngle:startAngle
-                                                                       endAngle:endAngle
-                                                                      clockwise:_parentPieChartView.drawsClockwise];
-    
-    _circleLayer.path = circularArcBezierPath.CGPath;
+    ORKChartPrimitive *circle = [ORKChartLayoutEngine pieCirclePrimitiveWithSize:size
+                                                               radiusScaleFactor:_radiusScaleFactor
+                                                                       lineWidth:_parentPieChartView.lineWidth
+                                                                     labelHeight:labelHeight
+                                                           showsPercentageLabels:_parentPieChartView.showsPercentageLabels
+                                                                  drawsClockwise:_parentPieChartView.drawsClockwise];
+    _circleLayer.lineWidth = circle.lineWidth;
+    _circleLayer.path = [UIBezierPath bezierPathWithArcCenter:circle.center
+                                                       radius:circle.radius
+                                                   startAngle:circle.startAngle
+                                                     endAngle:circle.endAngle
+                                                    clockwise:circle.clockwise].CGPath;
     
     [self layoutPieChartLayers];
     if (_parentPieChartView.showsPercentageLabels) {
+        CGFloat innerRadius = [ORKChartLayoutEngine piePercentageLabelRadiusWithSize:size radiusScaleFactor:_radiusScaleFactor labelHeight:labelHeight];
         [self layoutPercentageLabelsWithRadius:innerRadius];
     }
 }
@@ -181,14 +168,15 @@ static const CGFloat InterAnimationDelay = 0.05;
     [_pieSections removeAllObjects];
     
     if (_parentPieChartView.showsPercentageLabels) {
-        CGFloat cumulativeValue = 0;
+        NSArray<NSNumber *> *angles = [ORKChartLayoutEngine piePercentageLabelAnglesForNormalizedValues:_normalizedValues
+                                                                                         drawsClockwise:_parentPieChartView.drawsClockwise];
         NSInteger numberOfSegments = [_parentPieChartView.dataSource numberOfSegmentsInPieChartView:_parentPieChartView];
         for (NSInteger idx = 0; idx < numberOfSegments; idx++) {
             CGFloat value = _normalizedValues[idx].floatValue;
             
             // Create a label
             UILabel *label = [UILabel new];
-            label.text = [NSString stringWithFormat:@"%0.0f%%", value * 100];
+            label.text = [ORKChartLayoutEngine piePercentageTextForNormalizedValue:value];
             label.font = _percentageLabelFont;
             label.textColor = [_parentPieChartView colorForSegmentAtIndex:idx];
             [label sizeToFit];
@@ -196,16 +184,7 @@ static const CGFloat InterAnimationDelay = 0.05;
             // Only if there are no legends
             label.isAccessibilityElement = ![_parentPieChartView.dataSource respondsToSelector:@selector(pieChartView:titleForSegmentAtIndex:)];
             
-            // Calculate the angle to the centre of this segment in radians
-            CGFloat angle = 0;
-            if (_parentPieChartView.drawsClockwise) {
-                angle = (value / 2 + cumulativeValue) * M_PI * 2;
-            } else {
-                angle = (value / 2 + cumulativeValue) * - M_PI * 2;
-            }
-            
-            cumulativeValue += value;
-            ORKPieChartSection *pieSection = [[ORKPieChartSection alloc] initWithLabel:label angle:angle];
+            ORKPieChartSection *pieSection = [[ORKPieChartSection alloc] initWithLabel:label angle:angles[idx].doubleValue];
             [_pieSections addObject:pieSection];
             [self addSubview:label];
         }
@@ -238,120 +217,19 @@ static const CGFloat InterAnimationDelay = 0.05;
 }
 
 - (void)layoutPercentageLabelsWithRadius:(CGFloat)pieRadius {
-    CGFloat cumulativeValue = 0;
-    NSInteger numberOfSegments = [_parentPieChartView.dataSource numberOfSegmentsInPieChartView:_parentPieChartView];
-    for (NSInteger idx = 0; idx < numberOfSegments; idx++) {
-        CGFloat value = _normalizedValues[idx].floatValue;
-
-        // Get a label
-        ORKPieChartSection *pieSection = _pieSections[idx];
-        UILabel *label = pieSection.label;
-        
-        // Calculate the angle to the centre of this segment in radians
-        CGFloat angle = (value / 2 + cumulativeValue) * M_PI * 2;
-        if (!_parentPieChartView.drawsClockwise) {
-            angle = (value / 2 + cumulativeValue) * - M_PI * 2;
-        }
-        
-        label.center = [self percentageLabel:label calculateCenterForAngle:angle pieRadius:pieRadius];
-        cumulativeValue += value;
-    }
-    [self adjustIntersectionsOfPercentageLabels:_pieSections pieRadius:pieRadius];
-}
-
-- (CGPoint)percentageLabel:(UILabel *)label calculateCenterForAngle:(CGFloat)angle pieRadius:(CGFloat)pieRadius {
-    // Calculate the desired distance from the circle's centre.
-    const CGFloat offset = 10;
-    CGFloat length = pieRadius + offset;
-    
-    // Calculate x and y coordinates for the point at this distance at the specified angle.
-    CGSize size = self.bounds.size;
-    CGFloat cosine = cos(angle + OriginAngle);
-    CGFloat sine = sin(angle + OriginAngle);
-    CGFloat x = cosine * length + size.width / 2;
-    CGFloat y = sine *  length + size.height / 2;
-    
-    // Offset (x,y) to normalise the spacing from the circle's centre to the intersection with the label's frame rather than its centre.
-    CGSize labelSize = [label systemLayoutSizeFittingSize:UILayoutFittingCompressedSize];
-    CGFloat xIn = cosine * labelSize.width / 2;
-    CGFloat yIn = sine * labelSize.height / 2;
-    x += xIn;
-    y += yIn;
-    
-    return  CGPointMake(x, y);
-}
-
-- (void)adjustIntersectionsOfPercentageLabels:(NSArray<ORKPieChartSection *> *)pieSections pieRadius:(CGFloat)pieRadius {
-    if (pieSections.count == 0) {
-        return;
-    }
-    // Adjust labels while we have intersections
-    BOOL intersections = YES;
-    // We alternate directions in each iteration
-    BOOL shiftClockwise = NO;
-    CGFloat rotateDirection = _parentPieChartView.drawsClockwise ? 1 : -1;
-    // We use totalAngle to prevent from infinite loop
-    CGFloat totalAngle = 0;
-    while (intersections) {
-        intersections = NO;
-        shiftClockwise = !shiftClockwise;
-        
-        if (shiftClockwise) {
-            for (NSUInteger idx = 0; idx < (pieSections.count - 1); idx++) {
-                // Prevent from infinite loop
-                if (!idx) {
-                    totalAngle += 0.01;
-                    if (totalAngle >= 2 * M_PI) {
-                        return;
-                    }
-                }
-                ORKPieChartSection *pieLabel  = pieSections[idx];
-                ORKPieChartSection *nextPieLabel = pieSections[(idx + 1)];
-                if ([self shiftSectionLabel:nextPieLabel fromSectionLabel:pieLabel direction:rotateDirection pieRadius:pieRadius]) {
-                    intersections = YES;
-                }
-            }
-        } else {
-            for (NSInteger idx = pieSections.count - 1; idx > 0; idx--) {
-                ORKPieChartSection *pieLabel = pieSections[idx];
-                ORKPieChartSection *nextPieLabel = pieSections[idx - 1];
-                if ([self shiftSectionLabel:nextPieLabel fromSectionLabel:pieLabel direction:-rotateDirection pieRadius:pieRadius]) {
-                    intersections = YES;
-                }
-            }
-        }
-        
-        // Adjust space between last and first element
-        ORKPieChartSection *firstPieLabel = pieSections.firstObject;
-        ORKPieChartSection *lastPieLabel = pieSections.lastObject;
-        UILabel *firstLabel = firstPieLabel.label;
-        UILabel *lastLabel = lastPieLabel.label;
-        if (CGRectIntersectsRect(lastLabel.frame, firstLabel.frame)) {
-            CGFloat firstLabelAngle = firstPieLabel.angle;
-            CGFloat lastLabelAngle = lastPieLabel.angle;
-            firstLabelAngle += rotateDirection * 0.01;
-            lastLabelAngle -= rotateDirection * 0.01;
-            firstPieLabel.angle = firstLabelAngle;
-            lastPieLabel.angle = lastLabelAngle;
-        }
-    }
-}
-
-- (BOOL)shiftSectionLabel:(ORKPieChartSection *)nextPieSection
-         fromSectionLabel:(ORKPieChartSection *)fromPieSection
-                direction:(CGFloat)direction
-                pieRadius:(CGFloat)pieRadius {
-    CGFloat shiftStep = 0.01;
-    UILabel *label = fromPieSection.label;
-    UILabel *nextLabel = nextPieSection.label;
-    if (CGRectIntersectsRect(label.frame, nextLabel.frame)) {
-        CGFloat nextLabelAngle = nextPieSection.angle;
-        nextLabelAngle += direction * shiftStep;
-        nextPieSection.angle = nextLabelAngle;
-        nextLabel.center = [self percentageLabel:nextLabel calculateCenterForAngle:nextLabelAngle pieRadius:pieRadius];
-        return YES;
+    // The engine places the labels around the pie and resolves their overlaps
+    NSArray<ORKPieChartSection *> *pieSections = _pieSections;
+    NSArray<ORKChartPrimitive *> *labelPrimitives = [ORKChartLayoutEngine piePercentageLabelPrimitivesForNormalizedValues:_normalizedValues
+                                                                                                                pieRadius:pieRadius
+                                                                                                                     size:self.bounds.size
+                                                                                                           drawsClockwise:_parentPieChartView.drawsClockwise
+                                                                                                        labelSizeProvider:^CGSize(NSUInteger segmentIndex, NSString *text) {
+        return [pieSections[segmentIndex].label systemLayoutSizeFittingSize:UILayoutFittingCompressedSize];
+    }];
+    NSUInteger numberOfLabels = MIN(labelPrimitives.count, pieSections.count);
+    for (NSUInteger idx = 0; idx < numberOfLabels; idx++) {
+        pieSections[idx].label.center = labelPrimitives[idx].position;
     }
-    return NO;
 }
 
 - (void)animateWithDuration:(NSTimeInterval)animationDuration {
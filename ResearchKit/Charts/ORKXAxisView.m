@@ -33,6 +33,7 @@
 
 #import "ORKXAxisView.h"
 
+#import "ORKChartLayoutEngine.h"
 #import "ORKGraphChartView_Internal.h"
 
 #import "ORKHelpers_Internal.h"
@@ -73,13 +74,16 @@ static const CGFloat LastLabelHeight = 20.0;
 
 - (void)layoutSubviews {
     [super layoutSubviews];
-    CGFloat width = self.bounds.size.width;
-    _lineLayer.frame = CGRectMake(0, -0.5, width, 1);
-    NSUInteger index = 0;
-    NSUInteger numberOfTitleLabels = _titleTickLayers.count;
+    // The axis line followed by one tick per title
+    NSArray<ORKChartPrimitive *> *primitives = [ORKChartLayoutEngine xAxisPrimitivesWithNumberOfPoints:_titleTickLayers.count
+                                                                                                  size:self.bounds.size
+                                                                                       pixelAdjustment:scalePixelAdjustment()];
+    ORKChartPrimitive *linePrimitive = primitives.firstObject;
+    _lineLayer.frame = CGRectMake(0, -0.5, linePrimitive.endPoint.x, 1);
+    NSUInteger index = 1;
     for (CALayer *titleTickLayer in _titleTickLayers) {
-        CGFloat positionOnXAxis = xAxisPoint(index, numberOfTitleLabels, width);
-        titleTickLayer.frame = CGRectMake(positionOnXAxis - scalePixelAdjustment(), -ORKGraphChartViewAxisTickLength + scalePixelAdjustment(), 1, ORKGraphChartViewAxisTickLength);
+        ORKChartPrimitive *tickPrimitive = primitives[index];
+        titleTickLayer.frame = CGRectMake(tickPrimitive.startPoint.x - 0.5, tickPrimitive.startPoint.y, 1, ORKGraphChartViewAxisTickLength);
         index++;
     }
     _titleLabels.lastObject.layer.cornerRadius = LastLabelHeight * 0.5;
@@ -32,6 +32,7 @@
 
 #import "ORKYAxisView.h"
 
+#import "ORKChartLayoutEngine.h"
 #import "ORKGraphChartView_Internal.h"
 
 #import "ORKHelpers_Internal.h"
@@ -39,6 +40,13 @@
 
 static const CGFloat ImageVerticalPadding = 3.0;
 
+static CGRect ORKYAxisTickFrame(ORKChartPrimitive *tickPrimitive) {
+    return CGRectMake(tickPrimitive.startPoint.x,
+                      tickPrimitive.startPoint.y - 0.5,
+                      tickPrimitive.endPoint.x - tickPrimitive.startPoint.x,
+                      1);
+}
+
 @implementation ORKYAxisView {
     __weak ORKGraphChartView *_parentGraphChartView;
     UIImageView *_maxImageView;
@@ -46,8 +54,6 @@ static const CGFloat ImageVerticalPadding = 3.0;
     
     NSMutableDictionary *_tickLayersByFactor;
     NSMutableDictionary *_tickLabelsByFactor;
-    
-    NSString *_decimalFormat;
 }
 
 - (instancetype)initWithFrame:(CGRect)frame {
@@ -117,40 +123,35 @@ static const CGFloat ImageVerticalPadding = 3.0;
         CGFloat minimumValue = _parentGraphChartView.minimumValue;
         CGFloat maximumValue = _parentGraphChartView.maximumValue;
         if (!_yAxisLabelFactors) {
-            if (minimumValue == maximumValue) {
-                _yAxisLabelFactors = @[ @0.5f ];
-            } else {
-                _yAxisLabelFactors = @[ @0.2f, @1.0f ];
-            }
+            _yAxisLabelFactors = [ORKChartLayoutEngine defaultYAxisLabelFactorsForMinimumValue:minimumValue maximumValue:maximumValue];
         }
         
+        // A tick followed by its label for each factor
+        NSArray<ORKChartPrimitive *> *primitives = [ORKChartLayoutEngine yAxisPrimitivesWithLabelFactors:_yAxisLabelFactors
+                                                                                            minimumValue:minimumValue
+                                                                                            maximumValue:maximumValue
+                                                                                           decimalPlaces:_decimalPlaces
+                                                                                                    size:bounds.size];
+        NSUInteger factorIndex = 0;
         for (NSNumber *factorNumber in _yAxisLabelFactors) {
-            
-            CGFloat factor = factorNumber.floatValue;
+            ORKChartPrimitive *tickPrimitive = primitives[factorIndex * 2];
+            ORKChartPrimitive *labelPrimitive = primitives[factorIndex * 2 + 1];
+            factorIndex++;
             
             CALayer *tickLayer = [CALayer layer];
-            CGFloat tickYPosition = CGRectGetHeight(self.bounds) * (1 - factor);
-            CGFloat tickXOrigin = CGRectGetWidth(self.bounds) - ORKGraphChartViewAxisTickLength;
-            tickLayer.frame = CGRectMake(tickXOrigin,
-                                         tickYPosition - 0.5,
-                                         ORKGraphChartViewAxisTickLength,
-                                         1);
+            tickLayer.frame = ORKYAxisTickFrame(tickPrimitive);
             tickLayer.backgroundColor = _parentGraphChartView.axisColor.CGColor;
 
             [self.layer addSublayer:tickLayer];
             _tickLayersByFactor[factorNumber] = tickLayer;
             
             CGFloat labelHeight = 20;
-            CGFloat labelYPosition = tickYPosition - labelHeight / 2;
+            CGFloat labelYPosition = labelPrimitive.position.y - labelHeight / 2;
             UILabel *tickLabel = [[UILabel alloc] initWithFrame:CGRectMake(0,
                                                                            labelYPosition,
                                                                            width - (ORKGraphChartViewAxisTickLength + ORKGraphChartViewYAxisTickPadding),
                                                                            labelHeight)];
-            
-            CGFloat yValue = minimumValue + (maximumValue - minimumValue) * factor;
-            if (yValue != 0) {
-                tickLabel.text = [NSString stringWithFormat:_decimalFormat, yValue];
-            }
+            tickLabel.text = labelPrimitive.text;
             tickLabel.backgroundColor = [UIColor clearColor];
             tickLabel.textColor = _titleColor;
             tickLabel.textAlignment = NSTextAlignmentRight;
@@ -176,18 +177,27 @@ static const CGFloat ImageVerticalPadding = 3.0;
                                      halfWidth,
                                      halfWidth);
     
-    for (NSNumber *factorNumber in _tickLayersByFactor.allKeys) {
-        CGFloat factor = factorNumber.floatValue;
+    if (_tickLayersByFactor.count == 0) {
+        return;
+    }
+    NSArray<NSNumber *> *factors = _tickLayersByFactor.allKeys;
+    NSArray<ORKChartPrimitive *> *primitives = [ORKChartLayoutEngine yAxisPrimitivesWithLabelFactors:factors
+                                                                                        minimumValue:_parentGraphChartView.minimumValue
+                                                                                        maximumValue:_parentGraphChartView.maximumValue
+                                                                                       decimalPlaces:_decimalPlaces
+                                                                                                size:bounds.size];
+    NSUInteger factorIndex = 0;
+    for (NSNumber *factorNumber in factors) {
+        ORKChartPrimitive *tickPrimitive = primitives[factorIndex * 2];
+        ORKChartPrimitive *labelPrimitive = primitives[factorIndex * 2 + 1];
+        factorIndex++;
+        
         CALayer *tickLayer = _tickLayersByFactor[factorNumber];
-        CGFloat tickYPosition = CGRectGetHeight(self.bounds) * (1 - factor);
-        CGFloat tickXOrigin = CGRectGetWidth(self.bounds) - ORKGraphChartViewAxisTickLength;
-        tickLayer.frame = CGRectMake(tickXOrigin,
-                                     tickYPosition - 0.5,
-                                     ORKGraphChartViewAxisTickLength,
-                                     1);
+        tickLayer.frame = ORKYAxisTickFrame(tickPrimitive);
         
+        // The label is right-aligned to the primitive's position
         UILabel *tickLabel = _tickLabelsByFactor[factorNumber];
-        tickLabel.center = CGPointMake(tickXOrigin - (ORKGraphChartViewYAxisTickPadding + tickLabel.bounds.size.width / 2), tickYPosition);
+        tickLabel.center = CGPointMake(labelPrimitive.position.x - tickLabel.bounds.size.width / 2, labelPrimitive.position.y);
     }
 }
 
@@ -213,9 +223,4 @@ static const CGFloat ImageVerticalPadding = 3.0;
     }
 }
 
-- (void)setDecimalPlaces:(NSUInteger)decimalPlaces {
-    _decimalPlaces = decimalPlaces;
-    _decimalFormat = [NSString stringWithFormat:@"%%.%luf", (unsigned long)_decimalPlaces];
-}
-
 @end
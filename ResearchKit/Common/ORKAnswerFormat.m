@@ -532,7 +532,7 @@ NSNumberFormatterStyle ORKNumberFormattingStyleConvert(ORKNumberFormattingStyle
      The fraction digits have to be taken into account in self.answer as well.
      */
     if ([self isKindOfClass:[ORKContinuousScaleAnswerFormat class]]) {
-        NSNumberFormatter* formatter = [(ORKContinuousScaleAnswerFormat*)self numberFormatter];
+        NSNumberFormatter* formatter = [(ORKContinuousScaleAnswerFormat*)self formatterForLocalizedStrings];
         answer = [formatter numberFromString:[formatter stringFromNumber:answer]];
     }
     
@@ -679,7 +679,15 @@ static NSArray *ork_processTextChoices(NSArray<ORKTextChoice *> *textChoices) {
 }
 
 - (NSString *)stringForAnswer:(id)answer {
-    return [_helper stringForChoiceAnswer:answer];
+    return [[self choiceAnswerFormatHelper] stringForChoiceAnswer:answer];
+}
+
+- (ORKChoiceAnswerFormatHelper *)choiceAnswerFormatHelper {
+    // Decoded answer formats create their helper on first use.
+    if (!_helper) {
+        _helper = [[ORKChoiceAnswerFormatHelper alloc] initWithAnswerFormat:self];
+    }
+    return _helper;
 }
 
 @end
@@ -898,7 +906,15 @@ static NSArray *ork_processTextChoices(NSArray<ORKTextChoice *> *textChoices) {
 }
 
 - (NSString *)stringForAnswer:(id)answer {
-    return [_helper stringForChoiceAnswer:answer];
+    return [[self choiceAnswerFormatHelper] stringForChoiceAnswer:answer];
+}
+
+- (ORKChoiceAnswerFormatHelper *)choiceAnswerFormatHelper {
+    // Decoded answer formats create their helper on first use.
+    if (!_helper) {
+        _helper = [[ORKChoiceAnswerFormatHelper alloc] initWithAnswerFormat:self];
+    }
+    return _helper;
 }
 
 @end
@@ -983,7 +999,15 @@ static NSArray *ork_processTextChoices(NSArray<ORKTextChoice *> *textChoices) {
 }
 
 - (NSString *)stringForAnswer:(id)answer {
-    return [_helper stringForChoiceAnswer:answer];
+    return [[self choiceAnswerFormatHelper] stringForChoiceAnswer:answer];
+}
+
+- (ORKChoiceAnswerFormatHelper *)choiceAnswerFormatHelper {
+    // Decoded answer formats create their helper on first use.
+    if (!_helper) {
+        _helper = [[ORKChoiceAnswerFormatHelper alloc] initWithAnswerFormat:self];
+    }
+    return _helper;
 }
 
 @end
@@ -1621,7 +1645,7 @@ static NSArray *ork_processTextChoices(NSArray<ORKTextChoice *> *textChoices) {
         return nil;
     }
     NSString *string = nil;
-    NSNumberFormatter *formatter = ORKDecimalNumberFormatter();
+    NSNumberFormatter *formatter = ORKSharedDecimalNumberFormatter();
     if (self.minimum && (self.minimum.doubleValue > num.doubleValue)) {
         string = [NSString localizedStringWithFormat:ORKLocalizedString(@"RANGE_ALERT_MESSAGE_BELOW_MAXIMUM", nil), text, [formatter stringFromNumber:self.minimum]];
     } else if (self.maximum && (self.maximum.doubleValue < num.doubleValue)) {
@@ -1635,7 +1659,7 @@ static NSArray *ork_processTextChoices(NSArray<ORKTextChoice *> *textChoices) {
 - (NSString *)stringForAnswer:(id)answer {
     NSString *answerString = nil;
     if ([self isAnswerValid:answer]) {
-        NSNumberFormatter *formatter = ORKDecimalNumberFormatter();
+        NSNumberFormatter *formatter = ORKSharedDecimalNumberFormatter();
         answerString = [formatter stringFromNumber:answer];
         if (self.unit && self.unit.length > 0) {
             answerString = [NSString stringWithFormat:@"%@ %@", answerString, self.unit];
@@ -1773,7 +1797,7 @@ static NSArray *ork_processTextChoices(NSArray<ORKTextChoice *> *textChoices) {
     return @(integer);
 }
 - (NSString *)localizedStringForNumber:(NSNumber *)number {
-    return [self.numberFormatter stringFromNumber:number];
+    return [[self formatterForLocalizedStrings] stringFromNumber:number];
 }
 
 - (NSArray<ORKTextChoice *> *)textChoices {
@@ -1790,6 +1814,17 @@ static NSArray *ork_processTextChoices(NSArray<ORKTextChoice *> *textChoices) {
     return _numberFormatter;
 }
 
+/*
+ * Slider labels are formatted with a formatter shared between answer formats, unless the instance
+ * formatter was requested, and so may have been customized, or a subclass overrides it.
+ */
+- (NSNumberFormatter *)formatterForLocalizedStrings {
+    if (_numberFormatter || [self methodForSelector:@selector(numberFormatter)] != [ORKScaleAnswerFormat instanceMethodForSelector:@selector(numberFormatter)]) {
+        return self.numberFormatter;
+    }
+    return ORKSharedNumberFormatter(NSNumberFormatterDecimalStyle, 0);
+}
+
 - (NSInteger)numberOfSteps {
     return (_maximum - _minimum) / _step;
 }
@@ -1988,7 +2023,7 @@ static NSArray *ork_processTextChoices(NSArray<ORKTextChoice *> *textChoices) {
     return @(_defaultValue);
 }
 - (NSString *)localizedStringForNumber:(NSNumber *)number {
-    return [self.numberFormatter stringFromNumber:number];
+    return [[self formatterForLocalizedStrings] stringFromNumber:number];
 }
 
 - (NSArray<ORKTextChoice *> *)textChoices {
@@ -2004,6 +2039,14 @@ static NSArray *ork_processTextChoices(NSArray<ORKTextChoice *> *textChoices) {
     return _numberFormatter;
 }
 
+// Like ORKScaleAnswerFormat, shares a formatter unless the instance formatter may have been customized
+- (NSNumberFormatter *)formatterForLocalizedStrings {
+    if (_numberFormatter || [self methodForSelector:@selector(numberFormatter)] != [ORKContinuousScaleAnswerFormat instanceMethodForSelector:@selector(numberFormatter)]) {
+        return self.numberFormatter;
+    }
+    return ORKSharedNumberFormatter(ORKNumberFormattingStyleConvert(_numberStyle), _maximumFractionDigits);
+}
+
 - (NSInteger)numberOfSteps {
     return 0;
 }
@@ -2121,9 +2164,7 @@ static NSArray *ork_processTextChoices(NSArray<ORKTextChoice *> *textChoices) {
 @end
 
 
-@implementation ORKTextScaleAnswerFormat {
-    NSNumberFormatter *_numberFormatter;
-}
+@implementation ORKTextScaleAnswerFormat
 
 - (Class)questionResultClass {
     return [ORKChoiceQuestionResult class];
@@ -2189,13 +2230,7 @@ static NSArray *ork_processTextChoices(NSArray<ORKTextChoice *> *textChoices) {
 }
 
 - (NSNumberFormatter *)numberFormatter {
-    if (!_numberFormatter) {
-        _numberFormatter = [[NSNumberFormatter alloc] init];
-        _numberFormatter.numberStyle = NSNumberFormatterDecimalStyle;
-        _numberFormatter.locale = [NSLocale autoupdatingCurrentLocale];
-        _numberFormatter.maximumFractionDigits = 0;
-    }
-    return _numberFormatter;
+    return ORKSharedNumberFormatter(NSNumberFormatterDecimalStyle, 0);
 }
 
 - (NSInteger)numberOfSteps {
@@ -2215,21 +2250,12 @@ static NSArray *ork_processTextChoices(NSArray<ORKTextChoice *> *textChoices) {
 }
 
 - (ORKTextChoice *)textChoiceForValue:(id<NSCopying, NSCoding, NSObject>)value {
-    __block ORKTextChoice *choice = nil;
-    
-    [_textChoices enumerateObjectsUsingBlock:^(ORKTextChoice * _Nonnull textChoice, NSUInteger idx, BOOL * _Nonnull stop) {
-        if ([textChoice.value isEqual:value]) {
-            choice = textChoice;
-            *stop = YES;
-        }
-    }];
-    
-    return choice;
+    NSUInteger index = [self textChoiceIndexForValue:value];
+    return index != NSNotFound ? _textChoices[index] : nil;
 }
 
 - (NSUInteger)textChoiceIndexForValue:(id<NSCopying, NSCoding, NSObject>)value {
-    ORKTextChoice *choice = [self textChoiceForValue:value];
-    return choice ? [_textChoices indexOfObject:choice] : NSNotFound;
+    return [[self choiceAnswerFormatHelper] indexForChoiceValue:value];
 }
 
 - (void)validateParameters {
@@ -2286,7 +2312,15 @@ static NSArray *ork_processTextChoices(NSArray<ORKTextChoice *> *textChoices) {
 }
 
 - (NSString *)stringForAnswer:(id)answer {
-    return [_helper stringForChoiceAnswer:answer];
+    return [[self choiceAnswerFormatHelper] stringForChoiceAnswer:answer];
+}
+
+- (ORKChoiceAnswerFormatHelper *)choiceAnswerFormatHelper {
+    // Decoded answer formats create their helper on first use.
+    if (!_helper) {
+        _helper = [[ORKChoiceAnswerFormatHelper alloc] initWithAnswerFormat:self];
+    }
+    return _helper;
 }
 
 @end
@@ -2321,7 +2355,7 @@ static NSArray *ork_processTextChoices(NSArray<ORKTextChoice *> *textChoices) {
                                      invalidMessage:(NSString *)invalidMessage {
     self = [super init];
     if (self) {
-        _validationRegularExpression = [validationRegularExpression copy];
+        _validationRegularExpression = ORKInternedRegularExpression(validationRegularExpression);
         _invalidMessage = [invalidMessage copy];
         _maximumLength = 0;
         [self commonInit];
@@ -2349,6 +2383,10 @@ static NSArray *ork_processTextChoices(NSArray<ORKTextChoice *> *textChoices) {
     }
 }
 
+- (void)setValidationRegularExpression:(NSRegularExpression *)validationRegularExpression {
+    _validationRegularExpression = ORKInternedRegularExpression(validationRegularExpression);
+}
+
 - (instancetype)copyWithZone:(NSZone *)zone {
     ORKTextAnswerFormat *answerFormat = [[[self class] allocWithZone:zone] init];
     answerFormat->_maximumLength = _maximumLength;
@@ -2387,10 +2425,11 @@ static NSArray *ork_processTextChoices(NSArray<ORKTextChoice *> *textChoices) {
 - (BOOL)isTextRegularExpressionValidWithString:(NSString *)text {
     BOOL isValid = YES;
     if (self.validationRegularExpression) {
-        NSUInteger regularExpressionMatches = [_validationRegularExpression numberOfMatchesInString:text
-                                                                                            options:(NSMatchingOptions)0
-                                                                                              range:NSMakeRange(0, [text length])];
-        isValid = (regularExpressionMatches != 0);
+        // A single match is enough, so stop at the first one rather than counting them all.
+        NSRange firstMatchRange = [_validationRegularExpression rangeOfFirstMatchInString:text
+                                                                                  options:(NSMatchingOptions)0
+                                                                                    range:NSMakeRange(0, [text length])];
+        isValid = (firstMatchRange.location != NSNotFound);
     }
     return isValid;
 }
@@ -2439,6 +2478,7 @@ static NSArray *ork_processTextChoices(NSArray<ORKTextChoice *> *textChoices) {
         _multipleLines = YES;
         ORK_DECODE_INTEGER(aDecoder, maximumLength);
         ORK_DECODE_OBJ_CLASS(aDecoder, validationRegularExpression, NSRegularExpression);
+        _validationRegularExpression = ORKInternedRegularExpression(_validationRegularExpression);
         ORK_DECODE_OBJ_CLASS(aDecoder, invalidMessage, NSString);
         ORK_DECODE_OBJ_CLASS(aDecoder, defaultTextAnswer, NSString);
         ORK_DECODE_ENUM(aDecoder, autocapitalizationType);
@@ -2516,9 +2556,7 @@ static NSString *const kSecureTextEntryEscapeString = @"*";
 - (ORKAnswerFormat *)impliedAnswerFormat {
     if (!_impliedAnswerFormat) {
         NSRegularExpression *validationRegularExpression =
-        [NSRegularExpression regularExpressionWithPattern:EmailValidationRegularExpressionPattern
-                                                  options:(NSRegularExpressionOptions)0
-                                                    error:nil];
+        ORKCachedRegularExpression(EmailValidationRegularExpressionPattern, (NSRegularExpressionOptions)0);
         NSString *invalidMessage = ORKLocalizedString(@"INVALID_EMAIL_ALERT_MESSAGE", nil);
         _impliedAnswerFormat = [ORKTextAnswerFormat textAnswerFormatWithValidationRegularExpression:validationRegularExpression
                                                                                      invalidMessage:invalidMessage];
@@ -2776,7 +2814,7 @@ static NSString *const kSecureTextEntryEscapeString = @"*";
     NSString *answerString = nil;
     
     if (!ORKIsAnswerEmpty(answer)) {
-        NSNumberFormatter *formatter = ORKDecimalNumberFormatter();
+        NSNumberFormatter *formatter = ORKSharedDecimalNumberFormatter();
         if (self.useMetricSystem) {
             answerString = [NSString stringWithFormat:@"%@ %@", [formatter stringFromNumber:answer], ORKLocalizedString(@"MEASURING_UNIT_CM", nil)];
         } else {
@@ -2914,7 +2952,7 @@ static NSString *const kSecureTextEntryEscapeString = @"*";
     NSString *answerString = nil;
     
     if (!ORKIsAnswerEmpty(answer)) {
-        NSNumberFormatter *formatter = ORKDecimalNumberFormatter();
+        NSNumberFormatter *formatter = ORKSharedDecimalNumberFormatter();
         if (self.useMetricSystem) {
             answerString = [NSString stringWithFormat:@"%@ %@", [formatter stringFromNumber:answer], ORKLocalizedString(@"MEASURING_UNIT_KG", nil)];
         } else {
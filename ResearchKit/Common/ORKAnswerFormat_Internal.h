@@ -166,10 +166,13 @@ ORK_DESIGNATE_CODING_AND_SERIALIZATION_INITIALIZERS(ORKWeightAnswerFormat)
 
 @interface ORKContinuousScaleAnswerFormat () <ORKScaleAnswerFormatProvider>
 
+// The formatter used for slider labels and result rounding; only returns the instance formatter if it may have been customized
+- (NSNumberFormatter *)formatterForLocalizedStrings;
+
 @end
 
 
-@interface ORKTextScaleAnswerFormat () <ORKTextScaleAnswerFormatProvider>
+@interface ORKTextScaleAnswerFormat () <ORKTextScaleAnswerFormatProvider, ORKChoiceAnswerFormatHelperProvider>
 
 @end
 
@@ -184,7 +187,7 @@ ORK_DESIGNATE_CODING_AND_SERIALIZATION_INITIALIZERS(ORKWeightAnswerFormat)
 
 @end
 
-@interface ORKValuePickerAnswerFormat ()
+@interface ORKValuePickerAnswerFormat () <ORKChoiceAnswerFormatHelperProvider>
 
 - (instancetype)initWithTextChoices:(NSArray<ORKTextChoice *> *)textChoices nullChoice:(ORKTextChoice *)nullChoice NS_DESIGNATED_INITIALIZER;
 
@@ -198,6 +201,16 @@ ORK_DESIGNATE_CODING_AND_SERIALIZATION_INITIALIZERS(ORKWeightAnswerFormat)
 @end
 
 
+@interface ORKTextChoiceAnswerFormat () <ORKChoiceAnswerFormatHelperProvider>
+
+@end
+
+
+@interface ORKImageChoiceAnswerFormat () <ORKChoiceAnswerFormatHelperProvider>
+
+@end
+
+
 @interface ORKTimeOfDayAnswerFormat ()
 
 - (NSDate *)pickerDefaultDate;
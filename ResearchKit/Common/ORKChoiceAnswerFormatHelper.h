@@ -41,6 +41,12 @@ NS_ASSUME_NONNULL_BEGIN
 
 @interface ORKChoiceAnswerFormatHelper : NSObject
 
+/**
+ Returns the helper owned by the answer format when it provides one, so that the value to index
+ table is built once per answer format rather than once per view.
+ */
++ (instancetype)helperForAnswerFormat:(ORKAnswerFormat *)answerFormat;
+
 - (instancetype)initWithAnswerFormat:(ORKAnswerFormat *)answerFormat;
 
 - (NSUInteger)choiceCount;
@@ -52,6 +58,8 @@ NS_ASSUME_NONNULL_BEGIN
 - (nullable id)answerForSelectedIndex:(NSUInteger)index;
 - (nullable id)answerForSelectedIndexes:(NSArray *)indexes;
 
+- (NSUInteger)indexForChoiceValue:(nullable id)value;
+
 - (nullable NSNumber *)selectedIndexForAnswer:(nullable id)answer;
 - (NSArray *)selectedIndexesForAnswer:(nullable id)answer;
 
@@ -60,4 +68,11 @@ NS_ASSUME_NONNULL_BEGIN
 
 @end
 
+
+@protocol ORKChoiceAnswerFormatHelperProvider <NSObject>
+
+- (ORKChoiceAnswerFormatHelper *)choiceAnswerFormatHelper;
+
+@end
+
 NS_ASSUME_NONNULL_END
@@ -40,9 +40,17 @@
 
 @implementation ORKChoiceAnswerFormatHelper {
     NSArray *_choices;
+    NSDictionary<id, NSNumber *> *_indexForValue;
     BOOL _isValuePicker;
 }
 
++ (instancetype)helperForAnswerFormat:(ORKAnswerFormat *)answerFormat {
+    if ([answerFormat conformsToProtocol:@protocol(ORKChoiceAnswerFormatHelperProvider)]) {
+        return [(id<ORKChoiceAnswerFormatHelperProvider>)answerFormat choiceAnswerFormatHelper];
+    }
+    return [[self alloc] initWithAnswerFormat:answerFormat];
+}
+
 - (instancetype)initWithAnswerFormat:(ORKAnswerFormat *)answerFormat {
     self = [super init];
     if (self) {
@@ -64,6 +72,17 @@
             NSString *exceptionReason = [NSString stringWithFormat:@"%@ is not a currently supported answer format for the choice answer format helper.", NSStringFromClass([answerFormat class])];
             @throw [NSException exceptionWithName:NSGenericException reason:exceptionReason userInfo:nil];
         }
+        
+        // Map each choice value to its index once, so answers map back to choices without scanning.
+        // The first choice with a given value wins, as it would in a linear search.
+        NSMutableDictionary<id, NSNumber *> *indexForValue = [[NSMutableDictionary alloc] initWithCapacity:_choices.count];
+        [_choices enumerateObjectsUsingBlock:^(id<ORKAnswerOption> choice, NSUInteger idx, BOOL *stop) {
+            id value = choice.value;
+            if (value != nil && indexForValue[value] == nil) {
+                indexForValue[value] = @(idx);
+            }
+        }];
+        _indexForValue = [indexForValue copy];
     }
     return self;
 }
@@ -121,6 +140,11 @@
     return array.count > 0 ? [array copy] : ORKNullAnswerValue();
 }
 
+- (NSUInteger)indexForChoiceValue:(id)value {
+    NSNumber *index = value ? _indexForValue[value] : nil;
+    return index ? index.unsignedIntegerValue : NSNotFound;
+}
+
 - (NSNumber *)selectedIndexForAnswer:(nullable id)answer {
     NSArray *indexes = [self selectedIndexesForAnswer:answer];
     return indexes.count > 0 ? indexes.firstObject : nil;
@@ -139,25 +163,20 @@
         NSAssert([answer isKindOfClass:[ORKChoiceQuestionResult answerClass] ], @"Wrong answer type");
         
         for (id answerValue in (NSArray *)answer) {
-            id<ORKAnswerOption> matchedChoice = nil;
-            for ( id<ORKAnswerOption> choice in _choices) {
-                if ([choice.value isEqual:answerValue]) {
-                    matchedChoice = choice;
-                    break;
-                }
-            }
+            NSNumber *matchedIndex = _indexForValue[answerValue];
             
-            if (nil == matchedChoice) {
-                NSAssert([answerValue isKindOfClass:[NSNumber class]], @"");
-                if (_isValuePicker) {
-                    matchedChoice = _choices[((NSNumber *)answerValue).unsignedIntegerValue + 1];
-                } else {
-                    matchedChoice = _choices[((NSNumber *)answerValue).unsignedIntegerValue];
+            if (nil == matchedIndex) {
+                // Choices without a value are answered with their index.
+                NSNumber *indexValue = ORKDynamicCast(answerValue, NSNumber);
+                NSAssert(indexValue != nil, @"");
+                NSUInteger index = indexValue.unsignedIntegerValue + (_isValuePicker ? 1 : 0);
+                if (indexValue && index < _choices.count) {
+                    matchedIndex = @(index);
                 }
             }
             
-            if (matchedChoice) {
-                [indexArray addObject:@([_choices indexOfObject:matchedChoice])];
+            if (matchedIndex) {
+                [indexArray addObject:matchedIndex];
             }
         }
     }
@@ -37,6 +37,7 @@ NS_ASSUME_NONNULL_BEGIN
 
 @class ORKAnswerFormat;
 @class ORKFormItem;
+@class ORKStepResult;
 
 /**
  The `ORKFormStep` class is a concrete subclass of `ORKStep`, used for presenting multiple questions
@@ -99,6 +100,28 @@ ORK_CLASS_AVAILABLE
  */
 @property (nonatomic) BOOL useCardView;
 
+/**
+ Validates all the answers in a dictionary in a single pass over the form items.
+ 
+ Empty answers are not validated. Each form item's answer format is resolved once, so this is
+ cheaper than validating form items one at a time when restoring or reviewing long forms.
+ 
+ @param answers       A dictionary of answers, keyed by form item identifier.
+ 
+ @return The identifiers of the form items whose answers are not valid.
+ */
+- (NSSet<NSString *> *)identifiersOfFormItemsWithInvalidAnswers:(nullable NSDictionary<NSString *, id> *)answers;
+
+/**
+ Validates all the question results in a step result in a single pass over the form items.
+ 
+ @param result        A step result produced by this form step, for example one restored from
+                        a previous run of the task.
+ 
+ @return The identifiers of the form items whose answers are not valid.
+ */
+- (NSSet<NSString *> *)identifiersOfFormItemsWithInvalidAnswersInResult:(nullable ORKStepResult *)result;
+
 @end
 
 
@@ -34,7 +34,9 @@
 #import "ORKFormStepViewController.h"
 
 #import "ORKAnswerFormat_Internal.h"
+#import "ORKCollectionResult.h"
 #import "ORKFormItem_Internal.h"
+#import "ORKQuestionResult.h"
 #import "ORKStep_Private.h"
 
 #import "ORKHelpers_Internal.h"
@@ -157,6 +159,37 @@
     return healthTypes.count ? healthTypes : nil;
 }
 
+- (NSSet<NSString *> *)identifiersOfFormItemsWithInvalidAnswers:(NSDictionary<NSString *, id> *)answers {
+    NSMutableSet<NSString *> *invalidIdentifiers = [NSMutableSet new];
+    if (answers.count == 0) {
+        return invalidIdentifiers;
+    }
+    for (ORKFormItem *item in self.formItems) {
+        if (item.answerFormat == nil || item.identifier == nil) {
+            continue;
+        }
+        id answer = answers[item.identifier];
+        if (ORKIsAnswerEmpty(answer)) {
+            continue;
+        }
+        if (![item.impliedAnswerFormat isAnswerValid:answer]) {
+            [invalidIdentifiers addObject:item.identifier];
+        }
+    }
+    return invalidIdentifiers;
+}
+
+- (NSSet<NSString *> *)identifiersOfFormItemsWithInvalidAnswersInResult:(ORKStepResult *)result {
+    NSMutableDictionary<NSString *, id> *answers = [NSMutableDictionary new];
+    for (ORKResult *childResult in result.results) {
+        ORKQuestionResult *questionResult = ORKDynamicCast(childResult, ORKQuestionResult);
+        if (questionResult.identifier && questionResult.answer) {
+            answers[questionResult.identifier] = questionResult.answer;
+        }
+    }
+    return [self identifiersOfFormItemsWithInvalidAnswers:answers];
+}
+
 @end
 
 
@@ -51,6 +51,7 @@
 #import "ORKResult_Private.h"
 #import "ORKStep_Private.h"
 #import "ORKResultPredicate.h"
+#import "ORKResultPredicate_Private.h"
 
 #import "ORKHelpers_Internal.h"
 #import "ORKSkin.h"
@@ -309,8 +310,18 @@
     NSMutableSet *_formItemCells;
     NSMutableArray<ORKTableSection *> *_sections;
     NSMutableArray<ORKTableSection *> *_allSections;
-    NSMutableArray<ORKFormItem *> *_hiddenFormItems;
-    NSMutableArray<ORKTableCellItem *> *_hiddenCellItems;
+    NSMutableSet<ORKFormItem *> *_hiddenFormItems;
+    NSMutableSet<ORKTableCellItem *> *_hiddenCellItems;
+    // Form items to re-evaluate when the answer with a given identifier changes, built once per step.
+    NSDictionary<NSString *, NSArray<ORKFormItem *> *> *_hidePredicateDependents;
+    // Form items whose hide predicate could not be analyzed; these are re-evaluated on every change.
+    NSArray<ORKFormItem *> *_unanalyzedHidePredicateItems;
+    NSMutableSet<NSString *> *_changedAnswerIdentifiers;
+    // Identifiers of answered form items whose answers are invalid; nil when every answer needs revalidating.
+    NSMutableSet<NSString *> *_invalidAnswerIdentifiers;
+    NSMutableSet<NSString *> *_answerIdentifiersPendingValidation;
+    BOOL _needsHidePredicateEvaluation;
+    BOOL _evaluatingHidePredicates;
     BOOL _skipped;
     ORKFormItemCell *_currentFirstResponderCell;
     NSArray<NSLayoutConstraint *> *_constraints;
@@ -476,6 +487,18 @@
     }
     [_savedAnswers removeObjectForKey:identifier];
     _savedAnswerDates[identifier] = [NSDate date];
+    [self noteAnswerChangeForIdentifier:identifier];
+}
+
+- (void)noteAnswerChangeForIdentifier:(NSString *)identifier {
+    if (_changedAnswerIdentifiers == nil) {
+        _changedAnswerIdentifiers = [NSMutableSet new];
+    }
+    [_changedAnswerIdentifiers addObject:identifier];
+    if (_answerIdentifiersPendingValidation == nil) {
+        _answerIdentifiersPendingValidation = [NSMutableSet new];
+    }
+    [_answerIdentifiersPendingValidation addObject:identifier];
 }
 
 - (void)setAnswer:(id)answer forIdentifier:(NSString *)identifier {
@@ -498,6 +521,7 @@
     _savedAnswerDates[identifier] = [NSDate date];
     _savedSystemCalendars[identifier] = [NSCalendar currentCalendar];
     _savedSystemTimeZones[identifier] = [NSTimeZone systemTimeZone];
+    [self noteAnswerChangeForIdentifier:identifier];
 }
 
 // Override to monitor button title change
@@ -715,6 +739,42 @@
             }
         }
     }
+    
+    [self buildHidePredicateDependents];
+}
+
+- (void)buildHidePredicateDependents {
+    NSMutableDictionary<NSString *, NSMutableArray<ORKFormItem *> *> *dependents = [NSMutableDictionary new];
+    NSMutableArray<ORKFormItem *> *unanalyzedItems = [NSMutableArray new];
+    
+    for (ORKTableSection *section in _allSections) {
+        for (ORKFormItem *formItem in section.formItems) {
+            if (formItem.hidePredicate == nil) {
+                continue;
+            }
+            NSSet<NSString *> *identifiers = [ORKResultPredicate resultIdentifiersReferencedByPredicate:formItem.hidePredicate];
+            if (identifiers == nil) {
+                [unanalyzedItems addObject:formItem];
+                continue;
+            }
+            for (NSString *identifier in identifiers) {
+                NSMutableArray<ORKFormItem *> *items = dependents[identifier];
+                if (items == nil) {
+                    items = [NSMutableArray new];
+                    dependents[identifier] = items;
+                }
+                [items addObject:formItem];
+            }
+        }
+    }
+    
+    _hidePredicateDependents = dependents;
+    _unanalyzedHidePredicateItems = unanalyzedItems;
+    _hiddenFormItems = [NSMutableSet new];
+    _hiddenCellItems = [NSMutableSet new];
+    _changedAnswerIdentifiers = nil;
+    _invalidAnswerIdentifiers = nil;
+    _needsHidePredicateEvaluation = YES;
 }
 
 - (NSInteger)numberOfAnsweredFormItemsInDictionary:(NSDictionary *)dictionary {
@@ -731,24 +791,38 @@
     return [self numberOfAnsweredFormItemsInDictionary:self.savedAnswers];
 }
 
-- (BOOL)allAnsweredFormItemsAreValid {
-    for (ORKFormItem *item in [self formItems]) {
-        id answer = _savedAnswers[item.identifier];
-        if (ORKIsAnswerEmpty(answer) == NO && ![item.impliedAnswerFormat isAnswerValid:answer]) {
-            return NO;
+- (NSSet<NSString *> *)invalidAnswerIdentifiers {
+    if (_invalidAnswerIdentifiers == nil) {
+        _invalidAnswerIdentifiers = [[[self formStep] identifiersOfFormItemsWithInvalidAnswers:_savedAnswers] mutableCopy];
+        [_answerIdentifiersPendingValidation removeAllObjects];
+    } else if (_answerIdentifiersPendingValidation.count > 0) {
+        // Only answers that changed since the last validation need to be validated again.
+        for (ORKFormItem *item in [self allFormItems]) {
+            if (item.answerFormat == nil || ![_answerIdentifiersPendingValidation containsObject:item.identifier]) {
+                continue;
+            }
+            id answer = _savedAnswers[item.identifier];
+            if (ORKIsAnswerEmpty(answer) == NO && ![item.impliedAnswerFormat isAnswerValid:answer]) {
+                [_invalidAnswerIdentifiers addObject:item.identifier];
+            } else {
+                [_invalidAnswerIdentifiers removeObject:item.identifier];
+            }
         }
+        [_answerIdentifiersPendingValidation removeAllObjects];
     }
-    return YES;
+    return _invalidAnswerIdentifiers;
+}
+
+- (BOOL)allAnsweredFormItemsAreValid {
+    return [self invalidAnswerIdentifiers].count == 0;
 }
 
 - (BOOL)allNonOptionalFormItemsHaveAnswers {
-    ORKTaskResult *taskResult = self.taskViewController.result;
+    NSSet<NSString *> *invalidAnswerIdentifiers = [self invalidAnswerIdentifiers];
     for (ORKFormItem *item in [self formItems]) {
-        BOOL hideFormItem = [item.hidePredicate evaluateWithObject:@[taskResult]
-                                             substitutionVariables:@{ORKResultPredicateTaskIdentifierVariableName : taskResult.identifier}];
-        if (!item.optional && !hideFormItem) {
+        if (!item.optional && ![_hiddenFormItems containsObject:item]) {
             id answer = _savedAnswers[item.identifier];
-            if (ORKIsAnswerEmpty(answer) || ![item.impliedAnswerFormat isAnswerValid:answer]) {
+            if (ORKIsAnswerEmpty(answer) || [invalidAnswerIdentifiers containsObject:item.identifier]) {
                 return NO;
             }
         }
@@ -781,9 +855,56 @@
 }
 
 - (void)hideSections {
+    BOOL evaluateAll = _needsHidePredicateEvaluation;
+    NSMutableSet<ORKFormItem *> *formItemsToEvaluate = [NSMutableSet new];
+    if (evaluateAll) {
+        for (NSArray<ORKFormItem *> *items in _hidePredicateDependents.objectEnumerator) {
+            [formItemsToEvaluate addObjectsFromArray:items];
+        }
+    } else {
+        for (NSString *identifier in _changedAnswerIdentifiers) {
+            NSArray<ORKFormItem *> *items = _hidePredicateDependents[identifier];
+            if (items) {
+                [formItemsToEvaluate addObjectsFromArray:items];
+            }
+        }
+    }
+    [formItemsToEvaluate addObjectsFromArray:_unanalyzedHidePredicateItems];
+    _needsHidePredicateEvaluation = NO;
+    [_changedAnswerIdentifiers removeAllObjects];
+    
+    BOOL visibilityChanged = NO;
+    if (formItemsToEvaluate.count > 0 && self.taskViewController != nil) {
+        // Hide predicates are evaluated against every answer on the form, as if no item were hidden.
+        _evaluatingHidePredicates = YES;
+        ORKTaskResult *taskResult = self.taskViewController.result;
+        _evaluatingHidePredicates = NO;
+        
+        NSDictionary *substitutionVariables = @{ORKResultPredicateTaskIdentifierVariableName : taskResult.identifier};
+        for (ORKFormItem *formItem in formItemsToEvaluate) {
+            BOOL formItemIsHidden = [formItem.hidePredicate evaluateWithObject:@[taskResult]
+                                                         substitutionVariables:substitutionVariables];
+            if (formItemIsHidden == [_hiddenFormItems containsObject:formItem]) {
+                continue;
+            }
+            if (formItemIsHidden) {
+                [_hiddenFormItems addObject:formItem];
+            } else {
+                [_hiddenFormItems removeObject:formItem];
+            }
+            visibilityChanged = YES;
+        }
+    }
+    
+    if (evaluateAll || visibilityChanged) {
+        [self updateSectionsForHiddenFormItems];
+        [self updateButtonStates];
+    }
+}
+
+- (void)updateSectionsForHiddenFormItems {
     NSMutableArray<ORKTableSection *> *newSections = [NSMutableArray new];
-    NSMutableArray<ORKTableCellItem *> *newHiddenCellItems = [NSMutableArray new];
-    _hiddenFormItems = [NSMutableArray new];
+    NSMutableSet<ORKTableCellItem *> *newHiddenCellItems = [NSMutableSet new];
     
     NSMutableArray *deleteRows = [NSMutableArray new];
     NSMutableArray *insertRows = [NSMutableArray new];
@@ -791,26 +912,27 @@
     NSMutableIndexSet *insertSections = [NSMutableIndexSet new];
     NSMutableIndexSet *sectionsToReload = [NSMutableIndexSet new];
     
-    ORKTaskResult *taskResult = self.taskViewController.result;
-    
+    // `_sections` is an ordered subset of `_allSections`, so both can be walked together.
+    NSUInteger nextShowingSectionIndex = 0;
     for (ORKTableSection *section in _allSections) {
         BOOL hideSection = YES;
         BOOL sectionHasChanges = NO;
-        NSUInteger currentSectionIndex = [_sections indexOfObject:section];
+        NSUInteger currentSectionIndex = NSNotFound;
+        if (nextShowingSectionIndex < _sections.count && _sections[nextShowingSectionIndex] == section) {
+            currentSectionIndex = nextShowingSectionIndex++;
+        }
+        NSMapTable<ORKTableCellItem *, NSNumber *> *currentRowIndexes = [self showingRowIndexesForSection:section];
+        NSUInteger newRowCount = 0;
         NSMutableArray *pendingRowInsertions = [NSMutableArray new];
         NSMutableArray *pendingRowDeletions = [NSMutableArray new];
         for (ORKFormItem *formItem in section.formItems) {
-            BOOL formItemIsHidden = [formItem.hidePredicate evaluateWithObject:@[taskResult]
-                                                         substitutionVariables:@{ORKResultPredicateTaskIdentifierVariableName : taskResult.identifier}];
+            BOOL formItemIsHidden = [_hiddenFormItems containsObject:formItem];
             ORKTableCellItem *cellItem = [section cellItemForFormItem:formItem];
-            NSArray *currentShowingCellItems = [self showingCellItemsForSection:section];
-            NSUInteger currentRowIndex = [currentShowingCellItems indexOfObject:cellItem];
-            NSMutableArray *newRows = [NSMutableArray new];
+            NSNumber *currentRowIndex = cellItem ? [currentRowIndexes objectForKey:cellItem] : nil;
             if (formItemIsHidden) {
-                if (currentRowIndex != NSNotFound && currentSectionIndex != NSNotFound) {
-                    [pendingRowDeletions addObject:[NSIndexPath indexPathForRow:currentRowIndex inSection:currentSectionIndex]];
+                if (currentRowIndex != nil && currentSectionIndex != NSNotFound) {
+                    [pendingRowDeletions addObject:[NSIndexPath indexPathForRow:currentRowIndex.unsignedIntegerValue inSection:currentSectionIndex]];
                 }
-                [_hiddenFormItems addObject:formItem];
                 if (cellItem) {
                     [newHiddenCellItems addObject:cellItem];
                     if (![_hiddenCellItems containsObject:cellItem]) {
@@ -818,11 +940,11 @@
                     }
                 }
             } else {
-                if (cellItem && currentRowIndex == NSNotFound) {
-                    [pendingRowInsertions addObject:[NSIndexPath indexPathForRow:newRows.count inSection:newSections.count]];
+                if (cellItem && currentRowIndex == nil) {
+                    [pendingRowInsertions addObject:[NSIndexPath indexPathForRow:newRowCount inSection:newSections.count]];
                 }
                 if (cellItem) {
-                    [newRows addObject:cellItem];
+                    newRowCount++;
                     if ([_hiddenCellItems containsObject:cellItem]) {
                         sectionHasChanges = YES;
                     }
@@ -880,6 +1002,17 @@
     }
 }
 
+- (NSMapTable<ORKTableCellItem *, NSNumber *> *)showingRowIndexesForSection:(ORKTableSection *)section {
+    NSMapTable<ORKTableCellItem *, NSNumber *> *rowIndexes = [NSMapTable strongToStrongObjectsMapTable];
+    NSUInteger row = 0;
+    for (ORKTableCellItem *cellItem in section.items) {
+        if (![_hiddenCellItems containsObject:cellItem]) {
+            [rowIndexes setObject:@(row++) forKey:cellItem];
+        }
+    }
+    return rowIndexes;
+}
+
 - (NSArray *)showingCellItemsForSection:(ORKTableSection *)section {
     NSMutableArray *showingCells = [NSMutableArray new];
     for (ORKTableCellItem *cellItem in section.items) {
@@ -942,7 +1075,7 @@
     NSMutableArray *qResults = [NSMutableArray new];
     for (ORKFormItem *item in items) {
         
-        if ([_hiddenFormItems containsObject:item]) {
+        if (!_evaluatingHidePredicates && [_hiddenFormItems containsObject:item]) {
             continue;
         }
         
@@ -1003,6 +1136,8 @@
 - (void)goBackward {
     if (self.isBeingReviewed) {
         self.savedAnswers = [[NSMutableDictionary alloc] initWithDictionary:self.originalAnswers];
+        _invalidAnswerIdentifiers = nil;
+        _needsHidePredicateEvaluation = YES;
     }
     [super goBackward];
 }
@@ -1330,6 +1465,8 @@ static NSString *const _ORKOriginalAnswersRestoreKey = @"originalAnswers";
     _savedSystemCalendars = [coder decodeObjectOfClass:[NSMutableDictionary class] forKey:_ORKSavedSystemCalendarsRestoreKey];
     _savedSystemTimeZones = [coder decodeObjectOfClass:[NSMutableDictionary class] forKey:_ORKSavedSystemTimeZonesRestoreKey];
     _originalAnswers = [coder decodeObjectOfClass:[NSMutableDictionary class] forKey:_ORKOriginalAnswersRestoreKey];
+    _invalidAnswerIdentifiers = nil;
+    _needsHidePredicateEvaluation = YES;
 }
 
 #pragma mark Rotate
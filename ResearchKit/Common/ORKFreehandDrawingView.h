@@ -38,6 +38,7 @@
 NS_ASSUME_NONNULL_BEGIN
 
 @class ORKFreehandDrawingView;
+@class ORKStroke;
 
 @protocol ORKFreehandDrawingViewDelegate <NSObject>
 
@@ -71,6 +72,12 @@ ORK_CLASS_AVAILABLE
 
 - (UIImage *)freehandDrawingImage;
 
+/**
+ The raw touch samples of each stroke, in the order they were drawn. Locations are in the view's
+ coordinate space, even when drawing over a PDF view.
+ */
+@property (nonatomic, copy, readonly, nullable) NSArray <ORKStroke *> *strokes;
+
 @property (nonatomic, readonly) BOOL freehandDrawingExists;
 
 - (void)clear;
@@ -31,6 +31,8 @@
 
 #import "ORKHelpers_Internal.h"
 #import "ORKFreehandDrawingView.h"
+#import "ORKStroke.h"
+#import "ORKStrokeCapture.h"
 #import <UIKit/UIGestureRecognizerSubclass.h>
 
 
@@ -122,6 +124,13 @@ static const CGFloat LineWidthStepValue = 0.25f;
 @implementation ORKFreehandDrawingView {
     NSLayoutConstraint *_heightConstraint;
     NSLayoutConstraint *_widthConstraint;
+    
+    // Committed paths, rasterized once; drawRect: only strokes the path in progress on top.
+    ORKStrokeCanvas *_canvas;
+    
+    ORKStrokeBuilder *_strokeBuilder;
+    NSMutableArray<ORKStroke *> *_strokes;
+    BOOL _currentStrokeCommitted; // Whether any path of the stroke in progress was committed
 }
 
 - (instancetype)init {
@@ -159,6 +168,26 @@ static const CGFloat LineWidthStepValue = 0.25f;
     }
 }
 
+- (void)setBounds:(CGRect)bounds {
+    if (!CGSizeEqualToSize(bounds.size, self.bounds.size)) {
+        _canvas = nil;
+    }
+    [super setBounds:bounds];
+}
+
+- (void)setFrame:(CGRect)frame {
+    if (!CGSizeEqualToSize(frame.size, self.frame.size)) {
+        _canvas = nil;
+    }
+    [super setFrame:frame];
+}
+
+- (void)setLineColor:(UIColor *)lineColor {
+    _lineColor = lineColor;
+    _canvas = nil;
+    [self setNeedsDisplay];
+}
+
 - (UIColor *)lineColor {
     if (_lineColor == nil) {
         _lineColor = [UIColor blackColor];
@@ -166,6 +195,24 @@ static const CGFloat LineWidthStepValue = 0.25f;
     return _lineColor;
 }
 
+- (ORKStrokeCanvas *)canvas {
+    if (_canvas == nil) {
+        CGFloat scale = self.window.screen.scale ? : [UIScreen mainScreen].scale;
+        _canvas = [[ORKStrokeCanvas alloc] initWithSize:self.bounds.size scale:scale];
+        for (UIBezierPath *path in self.pathArray) {
+            [_canvas strokePath:path color:self.lineColor];
+        }
+    }
+    return _canvas;
+}
+
+- (ORKStrokeBuilder *)strokeBuilder {
+    if (_strokeBuilder == nil) {
+        _strokeBuilder = [ORKStrokeBuilder new];
+    }
+    return _strokeBuilder;
+}
+
 - (NSMutableArray *)pathArray {
     if (_pathArray == nil) {
         _pathArray = [NSMutableArray new];
@@ -212,6 +259,9 @@ static const CGFloat LineWidthStepValue = 0.25f;
     UITouch *touch = [touches anyObject];
     CGPoint point = [touch locationInView:self];
     
+    // A cancelled touch never reports an end; keep its stroke if any of its paths were committed.
+    [self finishStroke];
+    
     if (_pdfView) {
         CGPoint pdfPoint = [_pdfView convertPoint:point toPage:_pdfView.currentPage];
         CGRect pageBounds = [_pdfView.currentPage boundsForBox:[_pdfView displayBox]];
@@ -240,6 +290,7 @@ static const CGFloat LineWidthStepValue = 0.25f;
                 previousTouchTime = touch.timestamp;
             }
             
+            [self.strokeBuilder addSamplesForTouch:touch event:event inView:self];
             [self.currentPath moveToPoint:currentPoint];
             
             [self.pdfCurrentPath moveToPoint:[_pdfView convertPoint:currentPoint toPage:_pdfView.currentPage]];
@@ -276,6 +327,7 @@ static const CGFloat LineWidthStepValue = 0.25f;
             previousTouchTime = touch.timestamp;
         }
         
+        [self.strokeBuilder addSamplesForTouch:touch event:event inView:self];
         [self.currentPath moveToPoint:currentPoint];
         [self.currentPath addArcWithCenter:currentPoint radius:0.1 startAngle:0.0 endAngle:2.0 * M_PI clockwise:YES];
         [self gestureTouchesMoved:touches withEvent:event];
@@ -296,6 +348,7 @@ static CGPoint mmid_Point(CGPoint p1, CGPoint p2) {
         CGRect pageBounds = [_pdfView.currentPage boundsForBox:[_pdfView displayBox]];
         if ( CGRectContainsPoint(pageBounds, pdfPoint) && !_touchedOutside) {
             // Point lies inside the bounds.
+            [self.strokeBuilder addSamplesForTouch:touch event:event inView:self];
             
             CGFloat proposedLineWidth = [self getProposedLineWidthWithTouch:touch WithEvent:event];
             if (proposedLineWidth == CGFLOAT_MIN) {
@@ -338,6 +391,7 @@ static CGPoint mmid_Point(CGPoint p1, CGPoint p2) {
         }
     }
     else {
+        [self.strokeBuilder addSamplesForTouch:touch event:event inView:self];
 
         CGFloat proposedLineWidth = [self getProposedLineWidthWithTouch:touch WithEvent:event];
         
@@ -434,6 +488,19 @@ static CGPoint mmid_Point(CGPoint p1, CGPoint p2) {
 
 - (void)gestureTouchesEnded:(NSSet *)touches withEvent:(UIEvent *)event {
     [self commitCurrentPath];
+    [self finishStroke];
+}
+
+- (void)finishStroke {
+    // Strokes whose paths were all discarded for being empty drew nothing, so they are dropped too
+    ORKStroke *stroke = [_strokeBuilder finishStroke];
+    if (stroke && _currentStrokeCommitted) {
+        if (_strokes == nil) {
+            _strokes = [NSMutableArray new];
+        }
+        [_strokes addObject:stroke];
+    }
+    _currentStrokeCommitted = NO;
 }
 
 - (void)commitCurrentPath {
@@ -443,6 +510,8 @@ static CGPoint mmid_Point(CGPoint p1, CGPoint p2) {
     }
     
     [self.pathArray addObject:self.currentPath];
+    [_canvas strokePath:self.currentPath color:self.lineColor];
+    _currentStrokeCommitted = YES;
     if (_pdfView) {
         [self.pdfPathArray addObject:self.pdfCurrentPath];
     }
@@ -456,9 +525,8 @@ static CGPoint mmid_Point(CGPoint p1, CGPoint p2) {
     [_backgroundColor setFill];
     CGContextFillRect(UIGraphicsGetCurrentContext(), rect);
     
-    for (UIBezierPath *path in self.pathArray) {
-        [self.lineColor setStroke];
-        [path stroke];
+    if (!CGRectIsEmpty(self.bounds)) {
+        [self.canvas drawInCurrentContext];
     }
     
     [self.lineColor setStroke];
@@ -486,6 +554,10 @@ static CGPoint mmid_Point(CGPoint p1, CGPoint p2) {
     return image;
 }
 
+- (NSArray<ORKStroke *> *)strokes {
+    return [_strokes copy];
+}
+
 - (BOOL)freehandDrawingExists {
     return self.pathArray.count > 0;
 }
@@ -497,6 +569,8 @@ static CGPoint mmid_Point(CGPoint p1, CGPoint p2) {
         }
         
         [self.pathArray removeAllObjects];
+        [_strokes removeAllObjects];
+        [_canvas clear];
         [self setNeedsDisplayInRect:self.bounds];
     }
     if (_pdfView) {
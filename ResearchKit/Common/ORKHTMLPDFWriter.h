@@ -39,6 +39,8 @@ NS_ASSUME_NONNULL_BEGIN
 
 @property (nonatomic, nullable) ORKHTMLPDFPageRenderer *printRenderer;
 
++ (CGSize)defaultPageSize;
+
 - (void)writePDFFromHTML:(NSString *)html completionBlock:(void (^)(NSData *data, NSError *error))completionBlock;
 
 @end
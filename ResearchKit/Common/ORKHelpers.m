@@ -37,6 +37,7 @@
 #import "ORKTypes.h"
 
 #import <CoreText/CoreText.h>
+#import <objc/runtime.h>
 
 
 NSURL *ORKCreateRandomBaseURL() {
@@ -193,6 +194,18 @@ UIImage *ORKImageWithColor(UIColor *color) {
     return image;
 }
 
+static const void *ORKImagePNGRepresentationKey = &ORKImagePNGRepresentationKey;
+
+NSData *ORKImagePNGRepresentation(UIImage *image) {
+    // UIImage is immutable, so the encoded bytes stay valid for the lifetime of the instance.
+    NSData *data = objc_getAssociatedObject(image, ORKImagePNGRepresentationKey);
+    if (data == nil) {
+        data = UIImagePNGRepresentation(image);
+        objc_setAssociatedObject(image, ORKImagePNGRepresentationKey, data, OBJC_ASSOCIATION_RETAIN);
+    }
+    return data;
+}
+
 void ORKEnableAutoLayoutForViews(NSArray *views) {
     [views enumerateObjectsUsingBlock:^(id obj, NSUInteger idx, BOOL *stop) {
         [(UIView *)obj setTranslatesAutoresizingMaskIntoConstraints:NO];
@@ -545,6 +558,68 @@ NSNumberFormatter *ORKDecimalNumberFormatter() {
     return numberFormatter;
 }
 
+static NSCache *ORKValidationObjectCache(void) {
+    static NSCache *cache;
+    static dispatch_once_t onceToken;
+    dispatch_once(&onceToken, ^{
+        cache = [NSCache new];
+        cache.name = @"ResearchKit.validation";
+    });
+    return cache;
+}
+
+NSNumberFormatter *ORKSharedNumberFormatter(NSNumberFormatterStyle style, NSUInteger maximumFractionDigits) {
+    // Formatters are keyed by the current locale so a locale change produces a fresh formatter.
+    NSLocale *locale = [NSLocale currentLocale];
+    NSString *key = [NSString stringWithFormat:@"formatter:%@:%lu:%lu", locale.localeIdentifier, (unsigned long)style, (unsigned long)maximumFractionDigits];
+    NSCache *cache = ORKValidationObjectCache();
+    NSNumberFormatter *formatter = [cache objectForKey:key];
+    if (!formatter) {
+        formatter = [NSNumberFormatter new];
+        formatter.locale = locale;
+        formatter.numberStyle = style;
+        formatter.maximumFractionDigits = maximumFractionDigits;
+        [cache setObject:formatter forKey:key];
+    }
+    return formatter;
+}
+
+NSNumberFormatter *ORKSharedDecimalNumberFormatter(void) {
+    NSLocale *locale = [NSLocale currentLocale];
+    NSString *key = [NSString stringWithFormat:@"decimalFormatter:%@", locale.localeIdentifier];
+    NSCache *cache = ORKValidationObjectCache();
+    NSNumberFormatter *formatter = [cache objectForKey:key];
+    if (!formatter) {
+        formatter = ORKDecimalNumberFormatter();
+        formatter.locale = locale;
+        [cache setObject:formatter forKey:key];
+    }
+    return formatter;
+}
+
+NSRegularExpression *ORKCachedRegularExpression(NSString *pattern, NSRegularExpressionOptions options) {
+    if (!pattern) {
+        return nil;
+    }
+    NSString *key = [NSString stringWithFormat:@"regex:%lu:%@", (unsigned long)options, pattern];
+    NSCache *cache = ORKValidationObjectCache();
+    NSRegularExpression *regularExpression = [cache objectForKey:key];
+    if (!regularExpression) {
+        regularExpression = [NSRegularExpression regularExpressionWithPattern:pattern options:options error:nil];
+        if (regularExpression) {
+            [cache setObject:regularExpression forKey:key];
+        }
+    }
+    return regularExpression;
+}
+
+NSRegularExpression *ORKInternedRegularExpression(NSRegularExpression *regularExpression) {
+    if (!regularExpression) {
+        return nil;
+    }
+    return ORKCachedRegularExpression(regularExpression.pattern, regularExpression.options) ?: regularExpression;
+}
+
 void ORKDisablePasswordAutofill(id<UITextInputTraits> input) {
     if (@available(iOS 12.0, *)) {
         input.textContentType = UITextContentTypeOneTimeCode;
@@ -171,6 +171,9 @@ void ORKAdjustHeightForLabel(UILabel *label);
 // build a image with color
 UIImage *ORKImageWithColor(UIColor *color);
 
+// PNG bytes of the image, encoded on first use and cached on the image instance
+NSData *ORKImagePNGRepresentation(UIImage *image);
+
 void ORKEnableAutoLayoutForViews(NSArray *views);
 
 NSDateComponentsFormatter *ORKTimeIntervalLabelFormatter(void);
@@ -271,6 +274,16 @@ NSString *ORKPaddingWithNumberOfSpaces(NSUInteger numberOfPaddingSpaces);
 
 NSNumberFormatter *ORKDecimalNumberFormatter(void);
 
+// Shared formatters are cached per locale and must not be modified by callers.
+NSNumberFormatter *ORKSharedNumberFormatter(NSNumberFormatterStyle style, NSUInteger maximumFractionDigits);
+
+NSNumberFormatter *ORKSharedDecimalNumberFormatter(void);
+
+// Compiled regular expressions are interned by pattern and options; NSRegularExpression is immutable and thread safe.
+NSRegularExpression *ORKCachedRegularExpression(NSString *pattern, NSRegularExpressionOptions options);
+
+NSRegularExpression *ORKInternedRegularExpression(NSRegularExpression *regularExpression);
+
 ORK_INLINE double ORKFeetAndInchesToInches(double feet, double inches) {
     return (feet * 12) + inches;
 }
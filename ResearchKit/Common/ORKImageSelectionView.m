@@ -155,7 +155,7 @@ static const CGFloat SpacerHeight = 5.0;
         
         NSAssert([answerFormat isKindOfClass:[ORKImageChoiceAnswerFormat class]], @"answerFormat should be an instance of ORKImageChoiceAnswerFormat");
         
-        _helper = [[ORKChoiceAnswerFormatHelper alloc] initWithAnswerFormat:answerFormat];
+        _helper = [ORKChoiceAnswerFormatHelper helperForAnswerFormat:answerFormat];
         
         _isVertical = answerFormat.isVertical;
         
@@ -0,0 +1,172 @@
+/*
+ Copyright (c) 2026, CareEvolution, Inc.
+ 
+ Redistribution and use in source and binary forms, with or without modification,
+ are permitted provided that the following conditions are met:
+ 
+ 1.  Redistributions of source code must retain the above copyright notice, this
+ list of conditions and the following disclaimer.
+ 
+ 2.  Redistributions in binary form must reproduce the above copyright notice,
+ this list of conditions and the following disclaimer in the documentation and/or
+ other materials provided with the distribution.
+ 
+ 3.  Neither the name of the copyright holder(s) nor the names of any contributors
+ may be used to endorse or promote products derived from this software without
+ specific prior written permission. No license is granted to the trademarks of
+ the copyright holders even if such marks are included in this software.
+ 
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE
+ FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+@import Foundation;
+#import <ResearchKit/ORKDefines.h>
+
+
+NS_ASSUME_NONNULL_BEGIN
+
+typedef _Nullable id (^ORKJSONSerializationPropertyGetter)(NSDictionary *dict, NSString *property);
+typedef _Nullable id (^ORKJSONSerializationInitBlock)(NSDictionary *dict, ORKJSONSerializationPropertyGetter getter);
+typedef _Nullable id (^ORKJSONSerializationObjectToJSONBlock)(id object);
+typedef _Nullable id (^ORKJSONSerializationJSONToObjectBlock)(id jsonObject);
+
+/**
+ The `ORKJSONSerializer` class converts ResearchKit model objects, such as tasks, steps, answer
+ formats, and results, to and from JSON.
+ 
+ Each encoded object is a dictionary whose `_class` key holds the class name, and whose other keys
+ hold the serialized properties. An `ORKOrderedTask` or `ORKTaskResult` written with this class can
+ be read back into an equal object graph, so surveys can be defined on a server and results can be
+ uploaded as JSON.
+ 
+ The first time a class is encoded or decoded, the serializer compiles a plan for it: the property
+ table of the class and all of its serializable superclasses, flattened, with the accessors to use
+ for each property. Later objects of the same class reuse the plan.
+ 
+ Objects that cannot be serialized are reported through the `error` parameter with the
+ `ORKErrorException` code. JSON that does not describe a serializable object is reported with the
+ `ORKErrorInvalidObject` code.
+ 
+ Classes can be registered while other threads are serializing objects.
+ 
+ `NSPredicate` properties are not serialized.
+ */
+ORK_CLASS_AVAILABLE
+@interface ORKJSONSerializer : NSObject
+
++ (instancetype)new NS_UNAVAILABLE;
+- (instancetype)init NS_UNAVAILABLE;
+
+/**
+ Returns a JSON object (a tree of dictionaries, arrays, strings, and numbers) representing `object`.
+ 
+ @param object      The object to serialize.
+ @param error       On failure, the error that occurred.
+ 
+ @return A JSON dictionary, or `nil` on failure.
+ */
++ (nullable NSDictionary *)JSONObjectForObject:(id)object error:(NSError * _Nullable *)error;
+
+/**
+ Returns UTF-8 JSON data representing `object`.
+ 
+ The data is written directly from the object graph, without building an intermediate JSON object.
+ 
+ @param object      The object to serialize.
+ @param error       On failure, the error that occurred.
+ 
+ @return JSON data, or `nil` on failure.
+ */
++ (nullable NSData *)JSONDataForObject:(id)object error:(NSError * _Nullable *)error;
+
+/**
+ Writes UTF-8 JSON representing `object` to an open output stream.
+ 
+ Output is written in chunks while the object graph is traversed, so large results do not need to
+ be held in memory as a single buffer.
+ 
+ @param object      The object to serialize.
+ @param stream      An open output stream.
+ @param error       On failure, the error that occurred.
+ 
+ @return `YES` if the whole object was written; otherwise, `NO`.
+ */
++ (BOOL)writeObject:(id)object toStream:(NSOutputStream *)stream error:(NSError * _Nullable *)error;
+
+/**
+ Returns the object described by a JSON object produced by `JSONObjectForObject:error:`.
+ 
+ @param object      The JSON dictionary to decode.
+ @param error       On failure, the error that occurred.
+ 
+ @return The decoded object, or `nil` on failure.
+ */
++ (nullable id)objectFromJSONObject:(NSDictionary *)object error:(NSError * _Nullable *)error;
+
+/**
+ Returns the object described by JSON data produced by `JSONDataForObject:error:`.
+ 
+ @param data        The JSON data to decode.
+ @param error       On failure, the error that occurred.
+ 
+ @return The decoded object, or `nil` on failure.
+ */
++ (nullable id)objectFromJSONData:(NSData *)data error:(NSError * _Nullable *)error;
+
+/// The classes that can be serialized.
++ (NSArray<Class> *)serializableClasses;
+
+@end
+
+
+/**
+ Registration lets an app serialize its own step, answer format, or result subclasses.
+ 
+ Register a class and each of its properties before serializing objects of that class. Registering
+ invalidates any compiled plans, so it is best done once at launch.
+ */
+@interface ORKJSONSerializer (Registration)
+
+/**
+ Registers a serializable class.
+ 
+ @param serializableClass   The class to register.
+ @param initBlock           A block that creates an instance from its JSON dictionary, reading
+                                properties with the getter it is passed. If `nil`, the instance is
+                                created with `init`, and every property is set after creation.
+ */
++ (void)registerSerializableClass:(Class)serializableClass
+                        initBlock:(nullable ORKJSONSerializationInitBlock)initBlock;
+
+/**
+ Registers a serializable property of a class.
+ 
+ @param propertyName        The key-value coding key of the property.
+ @param serializableClass   The class declaring the property.
+ @param valueClass          The class of the property value, or of its elements for containers.
+ @param containerClass      `NSArray` or `NSDictionary` for collection properties, otherwise `NSObject`.
+ @param writeAfterInit      `YES` if the property must be set after the init block has run.
+ @param objectToJSON        An optional block converting the value to a JSON object.
+ @param jsonToObjectBlock   An optional block converting a JSON object back to a value.
+ */
++ (void)registerSerializableClassPropertyName:(NSString *)propertyName
+                                     forClass:(Class)serializableClass
+                                   valueClass:(Class)valueClass
+                               containerClass:(nullable Class)containerClass
+                               writeAfterInit:(BOOL)writeAfterInit
+                            objectToJSONBlock:(nullable ORKJSONSerializationObjectToJSONBlock)objectToJSON
+                            jsonToObjectBlock:(nullable ORKJSONSerializationJSONToObjectBlock)jsonToObjectBlock;
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -30,35 +30,102 @@
  */
 
 
-#import "ORKESerialization.h"
-
-@import ResearchKit;
-@import ResearchKit.Private;
+#import "ORKJSONSerializer.h"
+
+#import "ORKActiveStep.h"
+#import "ORKAnswerFormat.h"
+#import "ORKAnswerFormat_Private.h"
+#import "ORKAudioLevelNavigationRule.h"
+#import "ORKAudioStep.h"
+#import "ORKCollectionResult.h"
+#import "ORKCollectionResult_Private.h"
+#import "ORKCompletionStep.h"
+#import "ORKConsentDocument.h"
+#import "ORKConsentReviewStep.h"
+#import "ORKConsentSection.h"
+#import "ORKConsentSharingStep.h"
+#import "ORKConsentSignature.h"
+#import "ORKConsentSignatureResult.h"
+#import "ORKCountdownStep.h"
+#import "ORKdBHLToneAudiometryResult.h"
+#import "ORKdBHLToneAudiometryStep.h"
+#import "ORKFileResult.h"
+#import "ORKFitnessStep.h"
+#import "ORKFormStep.h"
+#import "ORKHealthAnswerFormat.h"
+#import "ORKHolePegTestPlaceStep.h"
+#import "ORKHolePegTestRemoveStep.h"
+#import "ORKHolePegTestResult.h"
+#import "ORKImageCaptureStep.h"
+#import "ORKInstructionStep.h"
+#import "ORKJSONWriter.h"
+#import "ORKLoginStep.h"
+#import "ORKNavigableOrderedTask.h"
+#import "ORKNavigablePageStep.h"
+#import "ORKNormalizedReactionTimeResult.h"
+#import "ORKOrderedTask.h"
+#import "ORKOrderedTask_Private.h"
+#import "ORKPageStep.h"
+#import "ORKPageStep_Private.h"
+#import "ORKPasscodeResult.h"
+#import "ORKPasscodeStep.h"
+#import "ORKPSATResult.h"
+#import "ORKPSATStep.h"
+#import "ORKQuestionResult.h"
+#import "ORKQuestionResult_Private.h"
+#import "ORKQuestionStep.h"
+#import "ORKRangeOfMotionResult.h"
+#import "ORKRangeOfMotionStep.h"
+#import "ORKReactionTimeResult.h"
+#import "ORKReactionTimeStep.h"
+#import "ORKRecorder.h"
+#import "ORKRecorder_Private.h"
+#import "ORKRegistrationStep.h"
+#import "ORKResult.h"
+#import "ORKResult_Private.h"
+#import "ORKResultPredicate.h"
+#import "ORKReviewStep.h"
+#import "ORKShoulderRangeOfMotionStep.h"
+#import "ORKSignatureResult.h"
+#import "ORKSignatureResult_Private.h"
+#import "ORKSignatureStep.h"
+#import "ORKSpatialSpanMemoryResult.h"
+#import "ORKSpatialSpanMemoryStep.h"
+#import "ORKSpeechRecognitionResult.h"
+#import "ORKStep.h"
+#import "ORKStepNavigationRule.h"
+#import "ORKStepNavigationRule_Private.h"
+#import "ORKStroopResult.h"
+#import "ORKStroopStep.h"
+#import "ORKTableStep.h"
+#import "ORKTappingIntervalResult.h"
+#import "ORKTappingIntervalStep.h"
+#import "ORKTimedWalkResult.h"
+#import "ORKTimedWalkStep.h"
+#import "ORKToneAudiometryResult.h"
+#import "ORKToneAudiometryStep.h"
+#import "ORKTouchAnywhereStep.h"
+#import "ORKTowerOfHanoiResult.h"
+#import "ORKTowerOfHanoiStep.h"
+#import "ORKTrailmakingResult.h"
+#import "ORKTrailmakingStep.h"
+#import "ORKVerificationStep.h"
+#import "ORKVideoCaptureStep.h"
+#import "ORKVideoInstructionStep.h"
+#import "ORKVideoInstructionStepResult.h"
+#import "ORKVisualConsentStep.h"
+#import "ORKWaitStep.h"
+#import "ORKWalkingTaskStep.h"
+#import "ORKWebViewStep.h"
+#import "ORKWebViewStepResult.h"
+
+#import "ORKHelpers_Private.h"
+#import "ORKHelpers_Internal.h"
 
 @import MapKit;
 
-
-static NSString *ORKEStringFromDateISO8601(NSDate *date) {
-    static NSDateFormatter *formatter = nil;
-    static dispatch_once_t onceToken;
-    dispatch_once(&onceToken, ^{
-        formatter = [[NSDateFormatter alloc] init];
-        [formatter setDateFormat:@"yyyy-MM-dd'T'HH:mm:ssZ"];
-        [formatter setLocale:[NSLocale localeWithLocaleIdentifier:@"en_US_POSIX"]];
-    });
-    return [formatter stringFromDate:date];
-}
-
-static NSDate *ORKEDateFromStringISO8601(NSString *string) {
-    static NSDateFormatter *formatter = nil;
-    static dispatch_once_t onceToken;
-    dispatch_once(&onceToken, ^{
-        formatter = [[NSDateFormatter alloc] init];
-        [formatter setDateFormat:@"yyyy-MM-dd'T'HH:mm:ssZ"];
-        [formatter setLocale:[NSLocale localeWithLocaleIdentifier:@"en_US_POSIX"]];
-    });
-    return [formatter dateFromString:string];
-}
+#import <objc/message.h>
+#import <objc/runtime.h>
 
 static NSArray *ORKNumericAnswerStyleTable() {
     static NSArray *table = nil;
@@ -259,58 +326,55 @@ static NSRegularExpression *regularExpressionsFromDictionary(NSDictionary *dict)
     return regularExpression;
 }
 
-static NSMutableDictionary *ORKESerializationEncodingTable(void);
-static id propFromDict(NSDictionary *dict, NSString *propName);
-static NSArray *classEncodingsForClass(Class c) ;
-static id objectForJsonObject(id input, Class expectedClass, ORKESerializationJSONToObjectBlock converterBlock) ;
+static NSMutableDictionary *ORKJSONSerializationEncodingTable(void);
 
 #define ESTRINGIFY2( x) #x
 #define ESTRINGIFY(x) ESTRINGIFY2(x)
 
-#define ENTRY(entryName, bb, props) @ESTRINGIFY(entryName) : [[ORKESerializableTableEntry alloc] initWithClass:[entryName class] initBlock:bb properties: props]
+#define ENTRY(entryName, bb, props) @ESTRINGIFY(entryName) : [[ORKJSONSerializableTableEntry alloc] initWithClass:[entryName class] initBlock:bb properties: props]
 
-#define PROPERTY(x, vc, cc, ww, jb, ob) @ESTRINGIFY(x) : ([[ORKESerializableProperty alloc] initWithPropertyName:@ESTRINGIFY(x) valueClass:[vc class] containerClass:[cc class] writeAfterInit:ww objectToJSONBlock:jb jsonToObjectBlock:ob ])
+#define PROPERTY(x, vc, cc, ww, jb, ob) @ESTRINGIFY(x) : ([[ORKJSONSerializableProperty alloc] initWithPropertyName:@ESTRINGIFY(x) valueClass:[vc class] containerClass:[cc class] writeAfterInit:ww objectToJSONBlock:jb jsonToObjectBlock:ob ])
 
 
 #define DYNAMICCAST(x, c) ((c *) ([x isKindOfClass:[c class]] ? x : nil))
 
 
-@interface ORKESerializableTableEntry : NSObject
+@interface ORKJSONSerializableTableEntry : NSObject
 
 - (instancetype)initWithClass:(Class)class
-                    initBlock:(ORKESerializationInitBlock)initBlock
+                    initBlock:(ORKJSONSerializationInitBlock)initBlock
                    properties:(NSDictionary *)properties;
 
 @property (nonatomic) Class class;
-@property (nonatomic, copy) ORKESerializationInitBlock initBlock;
+@property (nonatomic, copy) ORKJSONSerializationInitBlock initBlock;
 @property (nonatomic, strong) NSMutableDictionary *properties;
 
 @end
 
 
-@interface ORKESerializableProperty : NSObject
+@interface ORKJSONSerializableProperty : NSObject
 
 - (instancetype)initWithPropertyName:(NSString *)propertyName
                           valueClass:(Class)valueClass
                       containerClass:(Class)containerClass
                       writeAfterInit:(BOOL)writeAfterInit
-                   objectToJSONBlock:(ORKESerializationObjectToJSONBlock)objectToJSON
-                   jsonToObjectBlock:(ORKESerializationJSONToObjectBlock)jsonToObjectBlock;
+                   objectToJSONBlock:(ORKJSONSerializationObjectToJSONBlock)objectToJSON
+                   jsonToObjectBlock:(ORKJSONSerializationJSONToObjectBlock)jsonToObjectBlock;
 
 @property (nonatomic, copy) NSString *propertyName;
 @property (nonatomic) Class valueClass;
 @property (nonatomic) Class containerClass;
 @property (nonatomic) BOOL writeAfterInit;
-@property (nonatomic, copy) ORKESerializationObjectToJSONBlock objectToJSONBlock;
-@property (nonatomic, copy) ORKESerializationJSONToObjectBlock jsonToObjectBlock;
+@property (nonatomic, copy) ORKJSONSerializationObjectToJSONBlock objectToJSONBlock;
+@property (nonatomic, copy) ORKJSONSerializationJSONToObjectBlock jsonToObjectBlock;
 
 @end
 
 
-@implementation ORKESerializableTableEntry
+@implementation ORKJSONSerializableTableEntry
 
 - (instancetype)initWithClass:(Class)class
-                    initBlock:(ORKESerializationInitBlock)initBlock
+                    initBlock:(ORKJSONSerializationInitBlock)initBlock
                    properties:(NSDictionary *)properties {
     self = [super init];
     if (self) {
@@ -324,14 +388,14 @@ static id objectForJsonObject(id input, Class expectedClass, ORKESerializationJS
 @end
 
 
-@implementation ORKESerializableProperty
+@implementation ORKJSONSerializableProperty
 
 - (instancetype)initWithPropertyName:(NSString *)propertyName
                           valueClass:(Class)valueClass
                       containerClass:(Class)containerClass
                       writeAfterInit:(BOOL)writeAfterInit
-                   objectToJSONBlock:(ORKESerializationObjectToJSONBlock)objectToJSON
-                   jsonToObjectBlock:(ORKESerializationJSONToObjectBlock)jsonToObjectBlock {
+                   objectToJSONBlock:(ORKJSONSerializationObjectToJSONBlock)objectToJSON
+                   jsonToObjectBlock:(ORKJSONSerializationJSONToObjectBlock)jsonToObjectBlock {
     self = [super init];
     if (self) {
         self.propertyName = propertyName;
@@ -347,62 +411,11 @@ static id objectForJsonObject(id input, Class expectedClass, ORKESerializationJS
 @end
 
 
-static NSString *_ClassKey = @"_class";
-
-static id propFromDict(NSDictionary *dict, NSString *propName) {
-    NSArray *classEncodings = classEncodingsForClass(NSClassFromString(dict[_ClassKey]));
-    ORKESerializableProperty *propertyEntry = nil;
-    for (ORKESerializableTableEntry *classEncoding in classEncodings) {
-        
-        NSDictionary *propertyEncoding = classEncoding.properties;
-        propertyEntry = propertyEncoding[propName];
-        if (propertyEntry != nil) {
-            break;
-        }
-    }
-    NSCAssert(propertyEntry != nil, @"Unexpected property %@ for class %@", propName, dict[_ClassKey]);
-    
-    Class containerClass = propertyEntry.containerClass;
-    Class propertyClass = propertyEntry.valueClass;
-    ORKESerializationJSONToObjectBlock converterBlock = propertyEntry.jsonToObjectBlock;
-    
-    id input = dict[propName];
-    id output = nil;
-    if (input != nil) {
-        if ([containerClass isSubclassOfClass:[NSArray class]]) {
-            NSMutableArray *outputArray = [NSMutableArray array];
-            for (id value in DYNAMICCAST(input, NSArray)) {
-                id convertedValue = objectForJsonObject(value, propertyClass, converterBlock);
-                NSCAssert(convertedValue != nil, @"Could not convert to object of class %@", propertyClass);
-                [outputArray addObject:convertedValue];
-            }
-            output = outputArray;
-        } else if ([containerClass isSubclassOfClass:[NSDictionary class]]) {
-            NSMutableDictionary *outputDictionary = [NSMutableDictionary dictionary];
-            for (NSString *key in [DYNAMICCAST(input, NSDictionary) allKeys]) {
-                id convertedValue = objectForJsonObject(DYNAMICCAST(input, NSDictionary)[key], propertyClass, converterBlock);
-                NSCAssert(convertedValue != nil, @"Could not convert to object of class %@", propertyClass);
-                outputDictionary[key] = convertedValue;
-            }
-            output = outputDictionary;
-        } else {
-            NSCAssert(containerClass == [NSObject class], @"Unexpected container class %@", containerClass);
-            
-            output = objectForJsonObject(input, propertyClass, converterBlock);
-        }
-    }
-    return output;
-}
-
-
 #define NUMTOSTRINGBLOCK(table) ^id(id num) { return table[((NSNumber *)num).integerValue]; }
 #define STRINGTONUMBLOCK(table) ^id(id string) { NSUInteger index = [table indexOfObject:string]; \
-    NSCAssert(index != NSNotFound, @"Expected valid entry from table %@", table); \
-    return @(index); \
+    return (index == NSNotFound) ? nil : @(index); \
 }
 
-@implementation ORKESerializer
-
 static NSArray *ORKChoiceAnswerStyleTable() {
     static NSArray *table;
     static dispatch_once_t onceToken;
@@ -450,14 +463,14 @@ static NSArray *numberFormattingStyleTable() {
 }
 
 #define GETPROP(d,x) getter(d, @ESTRINGIFY(x))
-static NSMutableDictionary *ORKESerializationEncodingTable() {
+static NSMutableDictionary *ORKJSONSerializationEncodingTable() {
     static dispatch_once_t onceToken;
     static NSMutableDictionary *encondingTable = nil;
     dispatch_once(&onceToken, ^{
 encondingTable =
 [@{
    ENTRY(ORKResultSelector,
-         ^id(NSDictionary *dict, ORKESerializationPropertyGetter getter) {
+         ^id(NSDictionary *dict, ORKJSONSerializationPropertyGetter getter) {
              ORKResultSelector *selector = [[ORKResultSelector alloc] initWithTaskIdentifier:GETPROP(dict, taskIdentifier)
                                                                           stepIdentifier:GETPROP(dict, stepIdentifier)
                                                                         resultIdentifier:GETPROP(dict, resultIdentifier)];
@@ -468,7 +481,7 @@ encondingTable =
             PROPERTY(resultIdentifier, NSString, NSObject, YES, nil, nil),
             })),
    ENTRY(ORKPredicateStepNavigationRule,
-         ^id(NSDictionary *dict, ORKESerializationPropertyGetter getter) {
+         ^id(NSDictionary *dict, ORKJSONSerializationPropertyGetter getter) {
              ORKPredicateStepNavigationRule *rule = [[ORKPredicateStepNavigationRule alloc] initWithResultPredicates:GETPROP(dict, resultPredicates)
                                                                                           destinationStepIdentifiers:GETPROP(dict, destinationStepIdentifiers)
                                                                                                defaultStepIdentifier:GETPROP(dict, defaultStepIdentifier)
@@ -481,14 +494,14 @@ encondingTable =
               PROPERTY(additionalTaskResults, ORKTaskResult, NSArray, YES, nil, nil)
               })),
    ENTRY(ORKDirectStepNavigationRule,
-         ^id(NSDictionary *dict, ORKESerializationPropertyGetter getter) {
+         ^id(NSDictionary *dict, ORKJSONSerializationPropertyGetter getter) {
              ORKDirectStepNavigationRule *rule = [[ORKDirectStepNavigationRule alloc] initWithDestinationStepIdentifier:GETPROP(dict, destinationStepIdentifier)];
              return rule;
          },(@{
               PROPERTY(destinationStepIdentifier, NSString, NSObject, NO, nil, nil),
               })),
    ENTRY(ORKAudioLevelNavigationRule,
-         ^id(NSDictionary *dict, ORKESerializationPropertyGetter getter) {
+         ^id(NSDictionary *dict, ORKJSONSerializationPropertyGetter getter) {
              ORKAudioLevelNavigationRule *rule = [[ORKAudioLevelNavigationRule alloc] initWithAudioLevelStepIdentifier:GETPROP(dict, audioLevelStepIdentifier)                                                                                             destinationStepIdentifier:GETPROP(dict, destinationStepIdentifier)
                                                                                                      recordingSettings:GETPROP(dict, recordingSettings)];
              return rule;
@@ -498,7 +511,7 @@ encondingTable =
               PROPERTY(recordingSettings, NSDictionary, NSObject, NO, nil, nil),
               })),
    ENTRY(ORKOrderedTask,
-         ^id(NSDictionary *dict, ORKESerializationPropertyGetter getter) {
+         ^id(NSDictionary *dict, ORKJSONSerializationPropertyGetter getter) {
              ORKOrderedTask *task = [[ORKOrderedTask alloc] initWithIdentifier:GETPROP(dict, identifier)
                                                                          steps:GETPROP(dict, steps)];
              return task;
@@ -507,7 +520,7 @@ encondingTable =
               PROPERTY(steps, ORKStep, NSArray, NO, nil, nil)
               })),
    ENTRY(ORKNavigableOrderedTask,
-         ^id(NSDictionary *dict, ORKESerializationPropertyGetter getter) {
+         ^id(NSDictionary *dict, ORKJSONSerializationPropertyGetter getter) {
              ORKNavigableOrderedTask *task = [[ORKNavigableOrderedTask alloc] initWithIdentifier:GETPROP(dict, identifier)
                                                                                            steps:GETPROP(dict, steps)];
              return task;
@@ -518,7 +531,7 @@ encondingTable =
               PROPERTY(shouldReportProgress, NSNumber, NSObject, YES, nil, nil),
               })),
    ENTRY(ORKStep,
-         ^id(NSDictionary *dict, ORKESerializationPropertyGetter getter) {
+         ^id(NSDictionary *dict, ORKJSONSerializationPropertyGetter getter) {
              ORKStep *step = [[ORKStep alloc] initWithIdentifier:GETPROP(dict, identifier)];
              return step;
          },
@@ -531,7 +544,7 @@ encondingTable =
             PROPERTY(useSurveyMode, NSNumber, NSObject, YES, nil, nil)
             })),
    ENTRY(ORKReviewStep,
-         ^id(NSDictionary *dict, ORKESerializationPropertyGetter getter) {
+         ^id(NSDictionary *dict, ORKJSONSerializationPropertyGetter getter) {
              ORKReviewStep *reviewStep = [ORKReviewStep standaloneReviewStepWithIdentifier:GETPROP(dict, identifier)
                                                                                      steps:GETPROP(dict, steps)
                                                                               resultSource:GETPROP(dict, resultSource)];
@@ -543,7 +556,7 @@ encondingTable =
             PROPERTY(excludeInstructionSteps, NSNumber, NSObject, YES, nil, nil)
             })),
    ENTRY(ORKVisualConsentStep,
-         ^id(NSDictionary *dict, ORKESerializationPropertyGetter getter) {
+         ^id(NSDictionary *dict, ORKJSONSerializationPropertyGetter getter) {
              return [[ORKVisualConsentStep alloc] initWithIdentifier:GETPROP(dict, identifier)
                                                             document:GETPROP(dict, consentDocument)];
          },
@@ -551,7 +564,7 @@ encondingTable =
            PROPERTY(consentDocument, ORKConsentDocument, NSObject, NO, nil, nil)
            }),
    ENTRY(ORKPasscodeStep,
-         ^id(NSDictionary *dict, ORKESerializationPropertyGetter getter) {
+         ^id(NSDictionary *dict, ORKJSONSerializationPropertyGetter getter) {
              return [[ORKPasscodeStep alloc] initWithIdentifier:GETPROP(dict, identifier)];
          },
          (@{
@@ -559,14 +572,14 @@ encondingTable =
            PROPERTY(passcodeFlow, NSNumber, NSObject, YES, nil, nil)
            })),
    ENTRY(ORKWaitStep,
-         ^id(NSDictionary *dict, ORKESerializationPropertyGetter getter) {
+         ^id(NSDictionary *dict, ORKJSONSerializationPropertyGetter getter) {
              return [[ORKWaitStep alloc] initWithIdentifier:GETPROP(dict, identifier)];
          },
          (@{
            PROPERTY(indicatorType, NSNumber, NSObject, YES, nil, nil)
            })),
    ENTRY(ORKRecorderConfiguration,
-         ^id(NSDictionary *dict, ORKESerializationPropertyGetter getter) {
+         ^id(NSDictionary *dict, ORKJSONSerializationPropertyGetter getter) {
              ORKRecorderConfiguration *recorderConfiguration = [[ORKRecorderConfiguration alloc] initWithIdentifier:GETPROP(dict, identifier)];
              return recorderConfiguration;
          },
@@ -574,7 +587,7 @@ encondingTable =
             PROPERTY(identifier, NSString, NSObject, NO, nil, nil),
             })),
    ENTRY(ORKQuestionStep,
-         ^id(NSDictionary *dict, ORKESerializationPropertyGetter getter) {
+         ^id(NSDictionary *dict, ORKJSONSerializationPropertyGetter getter) {
              return [[ORKQuestionStep alloc] initWithIdentifier:GETPROP(dict, identifier)];
          },
          (@{
@@ -582,7 +595,7 @@ encondingTable =
             PROPERTY(placeholder, NSString, NSObject, YES, nil, nil)
             })),
    ENTRY(ORKInstructionStep,
-         ^id(NSDictionary *dict, ORKESerializationPropertyGetter getter) {
+         ^id(NSDictionary *dict, ORKJSONSerializationPropertyGetter getter) {
              return [[ORKInstructionStep alloc] initWithIdentifier:GETPROP(dict, identifier)];
          },
          (@{
@@ -590,7 +603,7 @@ encondingTable =
             PROPERTY(footnote, NSString, NSObject, YES, nil, nil),
             })),
    ENTRY(ORKVideoInstructionStep,
-         ^id(NSDictionary *dict, ORKESerializationPropertyGetter getter) {
+         ^id(NSDictionary *dict, ORKJSONSerializationPropertyGetter getter) {
              return [[ORKVideoInstructionStep alloc] initWithIdentifier:GETPROP(dict, identifier)];
          },
          (@{
@@ -600,25 +613,25 @@ encondingTable =
             PROPERTY(thumbnailTime, NSNumber, NSObject, YES, nil, nil),
             })),
    ENTRY(ORKCompletionStep,
-         ^id(NSDictionary *dict, ORKESerializationPropertyGetter getter) {
+         ^id(NSDictionary *dict, ORKJSONSerializationPropertyGetter getter) {
              return [[ORKCompletionStep alloc] initWithIdentifier:GETPROP(dict, identifier)];
          },
          (@{
             })),
    ENTRY(ORKCountdownStep,
-         ^id(NSDictionary *dict, ORKESerializationPropertyGetter getter) {
+         ^id(NSDictionary *dict, ORKJSONSerializationPropertyGetter getter) {
              return [[ORKCountdownStep alloc] initWithIdentifier:GETPROP(dict, identifier)];
          },
          (@{
             })),
    ENTRY(ORKTouchAnywhereStep,
-         ^id(NSDictionary *dict, ORKESerializationPropertyGetter getter) {
+         ^id(NSDictionary *dict, ORKJSONSerializationPropertyGetter getter) {
              return [[ORKTouchAnywhereStep alloc] initWithIdentifier:GETPROP(dict, identifier)];
          },
          (@{
             })),
    ENTRY(ORKWebViewStep,
-         ^id(NSDictionary *dict, ORKESerializationPropertyGetter getter) {
+         ^id(NSDictionary *dict, ORKJSONSerializationPropertyGetter getter) {
              ORKWebViewStep *step = [[ORKWebViewStep alloc] initWithIdentifier:GETPROP(dict, identifier)];
              return step;
          },
@@ -626,7 +639,7 @@ encondingTable =
             PROPERTY(html, NSString, NSObject, YES, nil, nil),
             })),
    ENTRY(ORKWebViewStepResult,
-         ^id(NSDictionary *dict, ORKESerializationPropertyGetter getter) {
+         ^id(NSDictionary *dict, ORKJSONSerializationPropertyGetter getter) {
              ORKWebViewStepResult *result = [[ORKWebViewStepResult alloc] initWithIdentifier:GETPROP(dict, identifier)];
              return result;
          },
@@ -634,7 +647,7 @@ encondingTable =
             PROPERTY(result, NSString, NSObject, YES, nil, nil),
             })),
    ENTRY(ORKHealthQuantityTypeRecorderConfiguration,
-         ^id(NSDictionary *dict, ORKESerializationPropertyGetter getter) {
+         ^id(NSDictionary *dict, ORKJSONSerializationPropertyGetter getter) {
              return [[ORKHealthQuantityTypeRecorderConfiguration alloc] initWithIdentifier:GETPROP(dict, identifier) healthQuantityType:GETPROP(dict, quantityType) unit:GETPROP(dict, unit)];
          },
          (@{
@@ -646,7 +659,7 @@ encondingTable =
                      ^id(id string) { return [HKUnit unitFromString:string]; }),
             })),
    ENTRY(ORKActiveStep,
-         ^id(NSDictionary *dict, ORKESerializationPropertyGetter getter) {
+         ^id(NSDictionary *dict, ORKJSONSerializationPropertyGetter getter) {
              return [[ORKActiveStep alloc] initWithIdentifier:GETPROP(dict, identifier)];
          },
          (@{
@@ -666,20 +679,20 @@ encondingTable =
             PROPERTY(recorderConfigurations, ORKRecorderConfiguration, NSArray, YES, nil, nil),
             })),
    ENTRY(ORKAudioStep,
-         ^id(NSDictionary *dict, ORKESerializationPropertyGetter getter) {
+         ^id(NSDictionary *dict, ORKJSONSerializationPropertyGetter getter) {
              return [[ORKAudioStep alloc] initWithIdentifier:GETPROP(dict, identifier)];
          },
          (@{
             })),
   ENTRY(ORKToneAudiometryStep,
-        ^id(NSDictionary *dict, ORKESerializationPropertyGetter getter) {
+        ^id(NSDictionary *dict, ORKJSONSerializationPropertyGetter getter) {
             return [[ORKToneAudiometryStep alloc] initWithIdentifier:GETPROP(dict, identifier)];
         },
         (@{
            PROPERTY(toneDuration, NSNumber, NSObject, YES, nil, nil),
            })),
    ENTRY(ORKdBHLToneAudiometryStep,
-         ^id(NSDictionary *dict, ORKESerializationPropertyGetter getter) {
+         ^id(NSDictionary *dict, ORKJSONSerializationPropertyGetter getter) {
              return [[ORKdBHLToneAudiometryStep alloc] initWithIdentifier:GETPROP(dict, identifier)];
          },
          (@{
@@ -696,7 +709,7 @@ encondingTable =
             PROPERTY(frequencyList, NSArray, NSObject, YES, nil, nil)
             })),
    ENTRY(ORKHolePegTestPlaceStep,
-         ^id(NSDictionary *dict, ORKESerializationPropertyGetter getter) {
+         ^id(NSDictionary *dict, ORKJSONSerializationPropertyGetter getter) {
              return [[ORKHolePegTestPlaceStep alloc] initWithIdentifier:GETPROP(dict, identifier)];
          },
          (@{
@@ -707,7 +720,7 @@ encondingTable =
             PROPERTY(rotated, NSNumber, NSObject, YES, nil, nil)
             })),
    ENTRY(ORKHolePegTestRemoveStep,
-         ^id(NSDictionary *dict, ORKESerializationPropertyGetter getter) {
+         ^id(NSDictionary *dict, ORKJSONSerializationPropertyGetter getter) {
              return [[ORKHolePegTestRemoveStep alloc] initWithIdentifier:GETPROP(dict, identifier)];
          },
          (@{
@@ -717,7 +730,7 @@ encondingTable =
             PROPERTY(threshold, NSNumber, NSObject, YES, nil, nil)
             })),
    ENTRY(ORKImageCaptureStep,
-        ^id(NSDictionary *dict, ORKESerializationPropertyGetter getter) {
+        ^id(NSDictionary *dict, ORKJSONSerializationPropertyGetter getter) {
             return [[ORKImageCaptureStep alloc] initWithIdentifier:GETPROP(dict, identifier)];
         },
         (@{
@@ -728,7 +741,7 @@ encondingTable =
             PROPERTY(accessibilityInstructions, NSString, NSObject, YES, nil, nil),
             })),
    ENTRY(ORKVideoCaptureStep,
-         ^id(NSDictionary *dict, ORKESerializationPropertyGetter getter) {
+         ^id(NSDictionary *dict, ORKJSONSerializationPropertyGetter getter) {
              return [[ORKVideoCaptureStep alloc] initWithIdentifier:GETPROP(dict, identifier)];
          },
          (@{
@@ -743,13 +756,13 @@ encondingTable =
             PROPERTY(accessibilityInstructions, NSString, NSObject, YES, nil, nil),
             })),
   ENTRY(ORKSignatureStep,
-         ^id(NSDictionary *dict, ORKESerializationPropertyGetter getter) {
+         ^id(NSDictionary *dict, ORKJSONSerializationPropertyGetter getter) {
              return [[ORKSignatureStep alloc] initWithIdentifier:GETPROP(dict, identifier)];
          },
          (@{
             })),
   ENTRY(ORKSpatialSpanMemoryStep,
-        ^id(NSDictionary *dict, ORKESerializationPropertyGetter getter) {
+        ^id(NSDictionary *dict, ORKJSONSerializationPropertyGetter getter) {
             return [[ORKSpatialSpanMemoryStep alloc] initWithIdentifier:GETPROP(dict, identifier)];
         },
         (@{
@@ -763,28 +776,28 @@ encondingTable =
           PROPERTY(customTargetPluralName, NSString, NSObject, YES, nil, nil),
           })),
   ENTRY(ORKWalkingTaskStep,
-        ^id(NSDictionary *dict, ORKESerializationPropertyGetter getter) {
+        ^id(NSDictionary *dict, ORKJSONSerializationPropertyGetter getter) {
             return [[ORKWalkingTaskStep alloc] initWithIdentifier:GETPROP(dict, identifier)];
         },
         (@{
           PROPERTY(numberOfStepsPerLeg, NSNumber, NSObject, YES, nil, nil),
           })),
    ENTRY(ORKTableStep,
-         ^id(NSDictionary *dict, ORKESerializationPropertyGetter getter) {
+         ^id(NSDictionary *dict, ORKJSONSerializationPropertyGetter getter) {
              return [[ORKTableStep alloc] initWithIdentifier:GETPROP(dict, identifier)];
          },
          (@{
             PROPERTY(items, NSObject, NSArray, YES, nil, nil),
             })),
    ENTRY(ORKTimedWalkStep,
-         ^id(NSDictionary *dict, ORKESerializationPropertyGetter getter) {
+         ^id(NSDictionary *dict, ORKJSONSerializationPropertyGetter getter) {
              return [[ORKTimedWalkStep alloc] initWithIdentifier:GETPROP(dict, identifier)];
          },
          (@{
             PROPERTY(distanceInMeters, NSNumber, NSObject, YES, nil, nil),
             })),
    ENTRY(ORKPSATStep,
-         ^id(NSDictionary *dict, ORKESerializationPropertyGetter getter) {
+         ^id(NSDictionary *dict, ORKJSONSerializationPropertyGetter getter) {
              return [[ORKPSATStep alloc] initWithIdentifier:GETPROP(dict, identifier)];
          },
          (@{
@@ -794,21 +807,21 @@ encondingTable =
             PROPERTY(seriesLength, NSNumber, NSObject, YES, nil, nil),
             })),
    ENTRY(ORKRangeOfMotionStep,
-         ^id(NSDictionary *dict, ORKESerializationPropertyGetter getter) {
+         ^id(NSDictionary *dict, ORKJSONSerializationPropertyGetter getter) {
              return [[ORKRangeOfMotionStep alloc] initWithIdentifier:GETPROP(dict, identifier)];
          },
          (@{
             PROPERTY(limbOption, NSNumber, NSObject, YES, nil, nil),
             })),
    ENTRY(ORKShoulderRangeOfMotionStep,
-         ^id(NSDictionary *dict, ORKESerializationPropertyGetter getter) {
+         ^id(NSDictionary *dict, ORKJSONSerializationPropertyGetter getter) {
              return [[ORKShoulderRangeOfMotionStep alloc] initWithIdentifier:GETPROP(dict, identifier)];
          },
          (@{
             PROPERTY(limbOption, NSNumber, NSObject, YES, nil, nil),
             })),
    ENTRY(ORKReactionTimeStep,
-         ^id(NSDictionary *dict, ORKESerializationPropertyGetter getter) {
+         ^id(NSDictionary *dict, ORKJSONSerializationPropertyGetter getter) {
              return [[ORKReactionTimeStep alloc] initWithIdentifier:GETPROP(dict, identifier)];
          },
          (@{
@@ -822,40 +835,40 @@ encondingTable =
             PROPERTY(failureSound, NSNumber, NSObject, YES, nil, nil),
             })),
    ENTRY(ORKStroopStep,
-         ^id(NSDictionary *dict, ORKESerializationPropertyGetter getter) {
+         ^id(NSDictionary *dict, ORKJSONSerializationPropertyGetter getter) {
              return [[ORKStroopStep alloc] initWithIdentifier:GETPROP(dict, identifier)];
          },
          (@{
             PROPERTY(numberOfAttempts, NSNumber, NSObject, YES, nil, nil)})),
    ENTRY(ORKTappingIntervalStep,
-         ^id(NSDictionary *dict, ORKESerializationPropertyGetter getter) {
+         ^id(NSDictionary *dict, ORKJSONSerializationPropertyGetter getter) {
              return [[ORKTappingIntervalStep alloc] initWithIdentifier:GETPROP(dict, identifier)];
          },
          (@{
             })),
    ENTRY(ORKTrailmakingStep,
-         ^id(NSDictionary *dict, ORKESerializationPropertyGetter getter) {
+         ^id(NSDictionary *dict, ORKJSONSerializationPropertyGetter getter) {
              return [[ORKTrailmakingStep alloc] initWithIdentifier:GETPROP(dict, identifier)];
          },
          (@{
             PROPERTY(trailType, NSString, NSObject, YES, nil, nil),
             })),
    ENTRY(ORKTowerOfHanoiStep,
-         ^id(NSDictionary *dict, ORKESerializationPropertyGetter getter) {
+         ^id(NSDictionary *dict, ORKJSONSerializationPropertyGetter getter) {
              return [[ORKTowerOfHanoiStep alloc] initWithIdentifier:GETPROP(dict, identifier)];
          },
          (@{
             PROPERTY(numberOfDisks, NSNumber, NSObject, YES, nil, nil),
             })),
   ENTRY(ORKAccelerometerRecorderConfiguration,
-        ^id(NSDictionary *dict, ORKESerializationPropertyGetter getter) {
+        ^id(NSDictionary *dict, ORKJSONSerializationPropertyGetter getter) {
             return [[ORKAccelerometerRecorderConfiguration alloc] initWithIdentifier:GETPROP(dict, identifier) frequency:((NSNumber *)GETPROP(dict, frequency)).doubleValue];
         },
         (@{
           PROPERTY(frequency, NSNumber, NSObject, NO, nil, nil),
           })),
   ENTRY(ORKAudioRecorderConfiguration,
-        ^id(NSDictionary *dict, ORKESerializationPropertyGetter getter) {
+        ^id(NSDictionary *dict, ORKJSONSerializationPropertyGetter getter) {
             return [[ORKAudioRecorderConfiguration alloc] initWithIdentifier:GETPROP(dict, identifier) recorderSettings:GETPROP(dict, recorderSettings)];
         },
         (@{
@@ -872,14 +885,14 @@ encondingTable =
           PROPERTY(htmlReviewContent, NSString, NSObject, NO, nil, nil),
           })),
   ENTRY(ORKConsentSharingStep,
-        ^(NSDictionary *dict, ORKESerializationPropertyGetter getter) {
+        ^(NSDictionary *dict, ORKJSONSerializationPropertyGetter getter) {
             return [[ORKConsentSharingStep alloc] initWithIdentifier:GETPROP(dict, identifier)];
         },
         (@{
            PROPERTY(localizedLearnMoreHTMLContent, NSString, NSObject, YES, nil, nil),
            })),
   ENTRY(ORKConsentReviewStep,
-        ^id(NSDictionary *dict, ORKESerializationPropertyGetter getter) {
+        ^id(NSDictionary *dict, ORKJSONSerializationPropertyGetter getter) {
             return [[ORKConsentReviewStep alloc] initWithIdentifier:GETPROP(dict, identifier) signature:GETPROP(dict, signature) inDocument:GETPROP(dict,consentDocument)];
         },
         (@{
@@ -888,13 +901,13 @@ encondingTable =
           PROPERTY(signature, ORKConsentSignature, NSObject, NO, nil, nil),
           })),
   ENTRY(ORKFitnessStep,
-        ^id(NSDictionary *dict, ORKESerializationPropertyGetter getter) {
+        ^id(NSDictionary *dict, ORKJSONSerializationPropertyGetter getter) {
             return [[ORKFitnessStep alloc] initWithIdentifier:GETPROP(dict, identifier)];
         },
         (@{
            })),
   ENTRY(ORKConsentSection,
-        ^id(NSDictionary *dict, ORKESerializationPropertyGetter getter) {
+        ^id(NSDictionary *dict, ORKJSONSerializationPropertyGetter getter) {
             return [[ORKConsentSection alloc] initWithType:((NSNumber *)GETPROP(dict, type)).integerValue];
         },
         (@{
@@ -926,35 +939,35 @@ encondingTable =
           PROPERTY(signatureDateFormatString, NSString, NSObject, YES, nil, nil),
           })),
   ENTRY(ORKRegistrationStep,
-        ^id(NSDictionary *dict, ORKESerializationPropertyGetter getter) {
+        ^id(NSDictionary *dict, ORKJSONSerializationPropertyGetter getter) {
             return [[ORKRegistrationStep alloc] initWithIdentifier:GETPROP(dict, identifier) title:GETPROP(dict, title) text:GETPROP(dict, text) options:((NSNumber *)GETPROP(dict, options)).integerValue];
         },
         (@{
            PROPERTY(options, NSNumber, NSObject, NO, nil, nil)
            })),
    ENTRY(ORKVerificationStep,
-         ^id(NSDictionary *dict, ORKESerializationPropertyGetter getter) {
+         ^id(NSDictionary *dict, ORKJSONSerializationPropertyGetter getter) {
              return [[ORKVerificationStep alloc] initWithIdentifier:GETPROP(dict, identifier) text:GETPROP(dict, text) verificationViewControllerClass:NSClassFromString(GETPROP(dict, verificationViewControllerString))];
          },
          (@{
             PROPERTY(verificationViewControllerString, NSString, NSObject, NO, nil, nil)
             })),
    ENTRY(ORKLoginStep,
-         ^id(NSDictionary *dict, ORKESerializationPropertyGetter getter) {
+         ^id(NSDictionary *dict, ORKJSONSerializationPropertyGetter getter) {
              return [[ORKLoginStep alloc] initWithIdentifier:GETPROP(dict, identifier) title:GETPROP(dict, title) text:GETPROP(dict, text) loginViewControllerClass:NSClassFromString(GETPROP(dict, loginViewControllerString))];
          },
          (@{
             PROPERTY(loginViewControllerString, NSString, NSObject, NO, nil, nil)
             })),
   ENTRY(ORKDeviceMotionRecorderConfiguration,
-        ^id(NSDictionary *dict, ORKESerializationPropertyGetter getter) {
+        ^id(NSDictionary *dict, ORKJSONSerializationPropertyGetter getter) {
             return [[ORKDeviceMotionRecorderConfiguration alloc] initWithIdentifier:GETPROP(dict, identifier) frequency:((NSNumber *)GETPROP(dict, frequency)).doubleValue];
         },
         (@{
           PROPERTY(frequency, NSNumber, NSObject, NO, nil, nil),
           })),
   ENTRY(ORKFormStep,
-        ^id(NSDictionary *dict, ORKESerializationPropertyGetter getter) {
+        ^id(NSDictionary *dict, ORKJSONSerializationPropertyGetter getter) {
             return [[ORKFormStep alloc] initWithIdentifier:GETPROP(dict, identifier)];
         },
         (@{
@@ -962,7 +975,7 @@ encondingTable =
           PROPERTY(footnote, NSString, NSObject, YES, nil, nil),
           })),
   ENTRY(ORKFormItem,
-        ^id(NSDictionary *dict, ORKESerializationPropertyGetter getter) {
+        ^id(NSDictionary *dict, ORKJSONSerializationPropertyGetter getter) {
             return [[ORKFormItem alloc] initWithIdentifier:GETPROP(dict, identifier) text:GETPROP(dict, text) answerFormat:GETPROP(dict, answerFormat)];
         },
         (@{
@@ -973,7 +986,7 @@ encondingTable =
           PROPERTY(answerFormat, ORKAnswerFormat, NSObject, NO, nil, nil),
           })),
    ENTRY(ORKPageStep,
-         ^id(NSDictionary *dict, ORKESerializationPropertyGetter getter) {
+         ^id(NSDictionary *dict, ORKJSONSerializationPropertyGetter getter) {
              ORKPageStep *step = [[ORKPageStep alloc] initWithIdentifier:GETPROP(dict, identifier) pageTask:GETPROP(dict, pageTask)];
              return step;
          },
@@ -981,7 +994,7 @@ encondingTable =
             PROPERTY(pageTask, ORKOrderedTask, NSObject, NO, nil, nil),
             })),
    ENTRY(ORKNavigablePageStep,
-         ^id(NSDictionary *dict, ORKESerializationPropertyGetter getter) {
+         ^id(NSDictionary *dict, ORKJSONSerializationPropertyGetter getter) {
              ORKNavigablePageStep *step = [[ORKNavigablePageStep alloc] initWithIdentifier:GETPROP(dict, identifier) pageTask:GETPROP(dict, pageTask)];
              return step;
          },
@@ -989,7 +1002,7 @@ encondingTable =
             PROPERTY(pageTask, ORKOrderedTask, NSObject, NO, nil, nil),
             })),
   ENTRY(ORKHealthKitCharacteristicTypeAnswerFormat,
-        ^id(NSDictionary *dict, ORKESerializationPropertyGetter getter) {
+        ^id(NSDictionary *dict, ORKJSONSerializationPropertyGetter getter) {
             return [[ORKHealthKitCharacteristicTypeAnswerFormat alloc] initWithCharacteristicType:GETPROP(dict, characteristicType)];
         },
         (@{
@@ -1011,7 +1024,7 @@ encondingTable =
           PROPERTY(shouldRequestAuthorization, NSNumber, NSObject, YES, nil, nil),
           })),
   ENTRY(ORKHealthKitQuantityTypeAnswerFormat,
-        ^id(NSDictionary *dict, ORKESerializationPropertyGetter getter) {
+        ^id(NSDictionary *dict, ORKJSONSerializationPropertyGetter getter) {
             return [[ORKHealthKitQuantityTypeAnswerFormat alloc] initWithQuantityType:GETPROP(dict, quantityType) unit:GETPROP(dict, unit) style:((NSNumber *)GETPROP(dict, numericAnswerStyle)).integerValue];
         },
         (@{
@@ -1031,14 +1044,14 @@ encondingTable =
         (@{
           })),
   ENTRY(ORKValuePickerAnswerFormat,
-        ^id(NSDictionary *dict, ORKESerializationPropertyGetter getter) {
+        ^id(NSDictionary *dict, ORKJSONSerializationPropertyGetter getter) {
             return [[ORKValuePickerAnswerFormat alloc] initWithTextChoices:GETPROP(dict, textChoices)];
         },
         (@{
           PROPERTY(textChoices, ORKTextChoice, NSArray, NO, nil, nil),
           })),
    ENTRY(ORKMultipleValuePickerAnswerFormat,
-         ^id(NSDictionary *dict, ORKESerializationPropertyGetter getter) {
+         ^id(NSDictionary *dict, ORKJSONSerializationPropertyGetter getter) {
              return [[ORKMultipleValuePickerAnswerFormat alloc] initWithValuePickers:GETPROP(dict, valuePickers) separator:GETPROP(dict, separator)];
          },
          (@{
@@ -1046,7 +1059,7 @@ encondingTable =
             PROPERTY(separator, NSString, NSObject, NO, nil, nil),
             })),
   ENTRY(ORKImageChoiceAnswerFormat,
-        ^id(NSDictionary *dict, ORKESerializationPropertyGetter getter) {
+        ^id(NSDictionary *dict, ORKJSONSerializationPropertyGetter getter) {
             return [[ORKImageChoiceAnswerFormat alloc] initWithImageChoices:GETPROP(dict, imageChoices) style:((NSNumber *)GETPROP(dict, style)).integerValue vertical:((NSNumber *)GETPROP(dict, vertical)).boolValue];
         },
         (@{
@@ -1057,7 +1070,7 @@ encondingTable =
           PROPERTY(vertical, NSNumber, NSObject, NO, nil, nil),
           })),
   ENTRY(ORKTextChoiceAnswerFormat,
-        ^id(NSDictionary *dict, ORKESerializationPropertyGetter getter) {
+        ^id(NSDictionary *dict, ORKJSONSerializationPropertyGetter getter) {
             return [[ORKTextChoiceAnswerFormat alloc] initWithStyle:((NSNumber *)GETPROP(dict, style)).integerValue textChoices:GETPROP(dict, textChoices)];
         },
         (@{
@@ -1065,7 +1078,7 @@ encondingTable =
           PROPERTY(textChoices, ORKTextChoice, NSArray, NO, nil, nil),
           })),
   ENTRY(ORKTextChoice,
-        ^id(NSDictionary *dict, ORKESerializationPropertyGetter getter) {
+        ^id(NSDictionary *dict, ORKJSONSerializationPropertyGetter getter) {
             return [[ORKTextChoice alloc] initWithText:GETPROP(dict, text) detailText:GETPROP(dict, detailText) value:GETPROP(dict, value) exclusive:((NSNumber *)GETPROP(dict, exclusive)).boolValue];
         },
         (@{
@@ -1075,7 +1088,7 @@ encondingTable =
           PROPERTY(exclusive, NSNumber, NSObject, NO, nil, nil),
           })),
   ENTRY(ORKImageChoice,
-        ^id(NSDictionary *dict, ORKESerializationPropertyGetter getter) {
+        ^id(NSDictionary *dict, ORKJSONSerializationPropertyGetter getter) {
             return [[ORKImageChoice alloc] initWithNormalImage:nil selectedImage:nil text:GETPROP(dict, text) value:GETPROP(dict, value)];
         },
         (@{
@@ -1083,7 +1096,7 @@ encondingTable =
           PROPERTY(value, NSObject, NSObject, NO, nil, nil),
           })),
   ENTRY(ORKTimeOfDayAnswerFormat,
-        ^id(NSDictionary *dict, ORKESerializationPropertyGetter getter) {
+        ^id(NSDictionary *dict, ORKJSONSerializationPropertyGetter getter) {
             return [[ORKTimeOfDayAnswerFormat alloc] initWithDefaultComponents:GETPROP(dict, defaultComponents)];
         },
         (@{
@@ -1092,7 +1105,7 @@ encondingTable =
                    ^id(id string) { return ORKTimeOfDayComponentsFromString(string); })
           })),
   ENTRY(ORKDateAnswerFormat,
-        ^id(NSDictionary *dict, ORKESerializationPropertyGetter getter) {
+        ^id(NSDictionary *dict, ORKJSONSerializationPropertyGetter getter) {
             return [[ORKDateAnswerFormat alloc] initWithStyle:((NSNumber *)GETPROP(dict, style)).integerValue defaultDate:GETPROP(dict, defaultDate) minimumDate:GETPROP(dict, minimumDate) maximumDate:GETPROP(dict, maximumDate) calendar:GETPROP(dict, calendar)];
         },
         (@{
@@ -1113,7 +1126,7 @@ encondingTable =
                    ^id(id string) { return [ORKResultDateTimeFormatter() dateFromString:string]; }),
           })),
   ENTRY(ORKNumericAnswerFormat,
-        ^id(NSDictionary *dict, ORKESerializationPropertyGetter getter) {
+        ^id(NSDictionary *dict, ORKJSONSerializationPropertyGetter getter) {
             return [[ORKNumericAnswerFormat alloc] initWithStyle:((NSNumber *)GETPROP(dict, style)).integerValue unit:GETPROP(dict, unit) minimum:GETPROP(dict, minimum) maximum:GETPROP(dict, maximum) maximumFractionDigits:GETPROP(dict, maximumFractionDigits)];
         },
         (@{
@@ -1127,7 +1140,7 @@ encondingTable =
           PROPERTY(maximumFractionDigits, NSNumber, NSObject, NO, nil, nil),
           })),
   ENTRY(ORKScaleAnswerFormat,
-        ^id(NSDictionary *dict, ORKESerializationPropertyGetter getter) {
+        ^id(NSDictionary *dict, ORKJSONSerializationPropertyGetter getter) {
             return [[ORKScaleAnswerFormat alloc] initWithMaximumValue:((NSNumber *)GETPROP(dict, maximum)).integerValue minimumValue:((NSNumber *)GETPROP(dict, minimum)).integerValue defaultValue:((NSNumber *)GETPROP(dict, defaultValue)).integerValue step:((NSNumber *)GETPROP(dict, step)).integerValue vertical:((NSNumber *)GETPROP(dict, vertical)).boolValue maximumValueDescription:GETPROP(dict, maximumValueDescription) minimumValueDescription:GETPROP(dict, minimumValueDescription)];
         },
         (@{
@@ -1142,7 +1155,7 @@ encondingTable =
           PROPERTY(gradientLocations, NSNumber, NSArray, YES, nil, nil)
           })),
   ENTRY(ORKContinuousScaleAnswerFormat,
-        ^id(NSDictionary *dict, ORKESerializationPropertyGetter getter) {
+        ^id(NSDictionary *dict, ORKJSONSerializationPropertyGetter getter) {
             return [[ORKContinuousScaleAnswerFormat alloc] initWithMaximumValue:((NSNumber *)GETPROP(dict, maximum)).doubleValue minimumValue:((NSNumber *)GETPROP(dict, minimum)).doubleValue defaultValue:((NSNumber *)GETPROP(dict, defaultValue)).doubleValue maximumFractionDigits:((NSNumber *)GETPROP(dict, maximumFractionDigits)).integerValue vertical:((NSNumber *)GETPROP(dict, vertical)).boolValue maximumValueDescription:GETPROP(dict, maximumValueDescription) minimumValueDescription:GETPROP(dict, minimumValueDescription)];
         },
         (@{
@@ -1160,7 +1173,7 @@ encondingTable =
           PROPERTY(gradientLocations, NSNumber, NSArray, YES, nil, nil)
           })),
    ENTRY(ORKTextScaleAnswerFormat,
-         ^id(NSDictionary *dict, ORKESerializationPropertyGetter getter) {
+         ^id(NSDictionary *dict, ORKJSONSerializationPropertyGetter getter) {
              return [[ORKTextScaleAnswerFormat alloc] initWithTextChoices:GETPROP(dict, textChoices) defaultIndex:[GETPROP(dict, defaultIndex) doubleValue] vertical:[GETPROP(dict, vertical) boolValue]];
          },
          (@{
@@ -1171,7 +1184,7 @@ encondingTable =
             PROPERTY(gradientLocations, NSNumber, NSArray, YES, nil, nil)
             })),
   ENTRY(ORKTextAnswerFormat,
-        ^id(NSDictionary *dict, ORKESerializationPropertyGetter getter) {
+        ^id(NSDictionary *dict, ORKJSONSerializationPropertyGetter getter) {
             return [[ORKTextAnswerFormat alloc] initWithMaximumLength:((NSNumber *)GETPROP(dict, maximumLength)).integerValue];
         },
         (@{
@@ -1193,7 +1206,7 @@ encondingTable =
          (@{
             })),
    ENTRY(ORKConfirmTextAnswerFormat,
-         ^id(NSDictionary *dict, ORKESerializationPropertyGetter getter) {
+         ^id(NSDictionary *dict, ORKJSONSerializationPropertyGetter getter) {
              return [[ORKConfirmTextAnswerFormat alloc] initWithOriginalItemIdentifier:GETPROP(dict, originalItemIdentifier) errorMessage:GETPROP(dict, errorMessage)];
          },
          (@{
@@ -1202,7 +1215,7 @@ encondingTable =
             PROPERTY(maximumLength, NSNumber, NSObject, YES, nil, nil)
             })),
   ENTRY(ORKTimeIntervalAnswerFormat,
-        ^id(NSDictionary *dict, ORKESerializationPropertyGetter getter) {
+        ^id(NSDictionary *dict, ORKJSONSerializationPropertyGetter getter) {
             return [[ORKTimeIntervalAnswerFormat alloc] initWithDefaultInterval:((NSNumber *)GETPROP(dict, defaultInterval)).doubleValue step:((NSNumber *)GETPROP(dict, step)).integerValue];
         },
         (@{
@@ -1210,7 +1223,7 @@ encondingTable =
           PROPERTY(step, NSNumber, NSObject, NO, nil, nil),
           })),
   ENTRY(ORKBooleanAnswerFormat,
-        ^id(NSDictionary *dict, ORKESerializationPropertyGetter getter) {
+        ^id(NSDictionary *dict, ORKJSONSerializationPropertyGetter getter) {
             return [[ORKBooleanAnswerFormat alloc] initWithYesString:((NSString *)GETPROP(dict, yes)) noString:((NSString *)GETPROP(dict, no))];
         },
         (@{
@@ -1218,7 +1231,7 @@ encondingTable =
            PROPERTY(no, NSString, NSObject, NO, nil, nil)
           })),
    ENTRY(ORKHeightAnswerFormat,
-         ^id(NSDictionary *dict, ORKESerializationPropertyGetter getter) {
+         ^id(NSDictionary *dict, ORKJSONSerializationPropertyGetter getter) {
              return [[ORKHeightAnswerFormat alloc] initWithMeasurementSystem:((NSNumber *)GETPROP(dict, measurementSystem)).integerValue];
          },
          (@{
@@ -1227,7 +1240,7 @@ encondingTable =
                      ^id(id string) { return @(ORKMeasurementSystemFromString(string)); }),
             })),
    ENTRY(ORKWeightAnswerFormat,
-         ^id(NSDictionary *dict, ORKESerializationPropertyGetter getter) {
+         ^id(NSDictionary *dict, ORKJSONSerializationPropertyGetter getter) {
              return [[ORKWeightAnswerFormat alloc] initWithMeasurementSystem:((NSNumber *)GETPROP(dict, measurementSystem)).integerValue
                                                             numericPrecision:((NSNumber *)GETPROP(dict, numericPrecision)).integerValue
                                                                 minimumValue:((NSNumber *)GETPROP(dict, minimumValue)).doubleValue
@@ -1244,26 +1257,29 @@ encondingTable =
             PROPERTY(defaultValue, NSNumber, NSObject, NO, nil, nil),
             })),
    ENTRY(ORKLocationAnswerFormat,
-        ^id(NSDictionary *dict, ORKESerializationPropertyGetter getter) {
+        ^id(NSDictionary *dict, ORKJSONSerializationPropertyGetter getter) {
             return [[ORKLocationAnswerFormat alloc] init];
         },
         (@{
           PROPERTY(useCurrentLocation, NSNumber, NSObject, YES, nil, nil)
           })),
    ENTRY(ORKLocationRecorderConfiguration,
-        ^id(NSDictionary *dict, ORKESerializationPropertyGetter getter) {
+        ^id(NSDictionary *dict, ORKJSONSerializationPropertyGetter getter) {
             return [[ORKLocationRecorderConfiguration alloc] initWithIdentifier:GETPROP(dict,identifier)];
         },
         (@{
+          PROPERTY(minimumDistance, NSNumber, NSObject, YES, nil, nil),
+          PROPERTY(minimumTimeInterval, NSNumber, NSObject, YES, nil, nil),
+          PROPERTY(maximumHorizontalAccuracy, NSNumber, NSObject, YES, nil, nil),
           })),
    ENTRY(ORKPedometerRecorderConfiguration,
-         ^id(NSDictionary *dict, ORKESerializationPropertyGetter getter) {
+         ^id(NSDictionary *dict, ORKJSONSerializationPropertyGetter getter) {
              return [[ORKPedometerRecorderConfiguration alloc] initWithIdentifier:GETPROP(dict,identifier)];
          },
         (@{
           })),
    ENTRY(ORKTouchRecorderConfiguration,
-         ^id(NSDictionary *dict, ORKESerializationPropertyGetter getter) {
+         ^id(NSDictionary *dict, ORKJSONSerializationPropertyGetter getter) {
              return [[ORKTouchRecorderConfiguration alloc] initWithIdentifier:GETPROP(dict,identifier)];
          },
         (@{
@@ -1273,11 +1289,11 @@ encondingTable =
         (@{
            PROPERTY(identifier, NSString, NSObject, NO, nil, nil),
            PROPERTY(startDate, NSDate, NSObject, YES,
-                    ^id(id date) { return ORKEStringFromDateISO8601(date); },
-                    ^id(id string) { return ORKEDateFromStringISO8601(string); }),
+                    ^id(id date) { return ORKStringFromDateISO8601(date); },
+                    ^id(id string) { return ORKDateFromStringISO8601(string); }),
            PROPERTY(endDate, NSDate, NSObject, YES,
-                    ^id(id date) { return ORKEStringFromDateISO8601(date); },
-                    ^id(id string) { return ORKEDateFromStringISO8601(string); }),
+                    ^id(id date) { return ORKStringFromDateISO8601(date); },
+                    ^id(id string) { return ORKDateFromStringISO8601(string); }),
            PROPERTY(userInfo, NSDictionary, NSObject, YES, nil, nil)
            })),
   ENTRY(ORKTappingSample,
@@ -1567,8 +1583,8 @@ encondingTable =
          nil,
          (@{
             PROPERTY(dateAnswer, NSDate, NSObject, NO,
-                     ^id(id date) { return ORKEStringFromDateISO8601(date); },
-                     ^id(id string) { return ORKEDateFromStringISO8601(string); }),
+                     ^id(id date) { return ORKStringFromDateISO8601(date); },
+                     ^id(id string) { return ORKDateFromStringISO8601(string); }),
             PROPERTY(calendar, NSCalendar, NSObject, NO,
                      ^id(id calendar) { return [(NSCalendar *)calendar calendarIdentifier]; },
                      ^id(id string) { return [NSCalendar calendarWithIdentifier:string]; }),
@@ -1577,7 +1593,7 @@ encondingTable =
                      ^id(id number) { return [NSTimeZone timeZoneForSecondsFromGMT:((NSNumber *)number).doubleValue]; })
             })),
    ENTRY(ORKLocation,
-         ^id(NSDictionary *dict, ORKESerializationPropertyGetter getter) {
+         ^id(NSDictionary *dict, ORKJSONSerializationPropertyGetter getter) {
              CLLocationCoordinate2D coordinate = coordinateFromDictionary(dict[@ESTRINGIFY(coordinate)]);
              return [[ORKLocation alloc] initWithCoordinate:coordinate
                                                      region:GETPROP(dict, region)
@@ -1615,7 +1631,7 @@ encondingTable =
             PROPERTY(results, ORKResult, NSArray, YES, nil, nil)
             })),
    ENTRY(ORKTaskResult,
-         ^id(NSDictionary *dict, ORKESerializationPropertyGetter getter) {
+         ^id(NSDictionary *dict, ORKJSONSerializationPropertyGetter getter) {
              return [[ORKTaskResult alloc] initWithTaskIdentifier:GETPROP(dict, identifier) taskRunUUID:GETPROP(dict, taskRunUUID) outputDirectory:GETPROP(dict, outputDirectory)];
          },
          (@{
@@ -1649,14 +1665,187 @@ encondingTable =
 }
 #undef GETPROP
 
-static NSArray *classEncodingsForClass(Class c) {
-    NSDictionary *encodingTable = ORKESerializationEncodingTable();
+
+static NSString *const _ClassKey = @"_class";
+
+static const NSUInteger ORKJSONStreamChunkSize = 64 * 1024;
+
+#define ORKJSONThrowInvalid(...) @throw [NSException exceptionWithName:NSInvalidArgumentException reason:[NSString stringWithFormat:__VA_ARGS__] userInfo:nil]
+
+#define ORKJSONSetInvalidError(error, ...) (*(error) = [NSError errorWithDomain:ORKErrorDomain code:ORKErrorInvalidObject userInfo:@{NSLocalizedFailureReasonErrorKey: [NSString stringWithFormat:__VA_ARGS__]}])
+
+static BOOL isValid(id object) {
+    return [NSJSONSerialization isValidJSONObject:object] || [object isKindOfClass:[NSNumber class]] || [object isKindOfClass:[NSString class]] || [object isKindOfClass:[NSNull class]];
+}
+
+typedef NS_ENUM(NSInteger, ORKJSONContainer) {
+    ORKJSONContainerNone,
+    ORKJSONContainerArray,
+    ORKJSONContainerDictionary
+};
+
+
+/*
+ A serializable property resolved against a concrete class: its JSON key, container kind, and the
+ accessors used to read and write it. Object-typed properties with accessor methods are read and
+ written by sending the accessor directly; anything else goes through key-value coding.
+ */
+@interface ORKJSONPropertyPlan : NSObject
+
+- (instancetype)initWithProperty:(ORKJSONSerializableProperty *)property forClass:(Class)aClass;
+
+@property (nonatomic, readonly) ORKJSONSerializableProperty *property;
+@property (nonatomic, copy, readonly) NSString *name;
+@property (nonatomic, readonly) const char *key;
+@property (nonatomic, readonly) ORKJSONContainer container;
+
+- (id)valueForObject:(id)object;
+- (void)setValue:(id)value forObject:(id)object;
+
+@end
+
+
+@implementation ORKJSONPropertyPlan {
+    NSData *_keyData;
+    SEL _getter;
+    SEL _setter;
+}
+
+- (instancetype)initWithProperty:(ORKJSONSerializableProperty *)property forClass:(Class)aClass {
+    self = [super init];
+    if (self) {
+        _property = property;
+        _name = [property.propertyName copy];
+        
+        NSMutableData *keyData = [[_name dataUsingEncoding:NSUTF8StringEncoding] mutableCopy];
+        [keyData appendBytes:"" length:1];
+        _keyData = keyData;
+        
+        if ([property.containerClass isSubclassOfClass:[NSArray class]]) {
+            _container = ORKJSONContainerArray;
+        } else if ([property.containerClass isSubclassOfClass:[NSDictionary class]]) {
+            _container = ORKJSONContainerDictionary;
+        } else {
+            _container = ORKJSONContainerNone;
+        }
+        
+        objc_property_t runtimeProperty = class_getProperty(aClass, _name.UTF8String);
+        char *type = runtimeProperty ? property_copyAttributeValue(runtimeProperty, "T") : NULL;
+        BOOL isObjectType = (type != NULL && type[0] == '@');
+        free(type);
+        if (isObjectType) {
+            char *getterName = property_copyAttributeValue(runtimeProperty, "G");
+            SEL getter = getterName ? sel_registerName(getterName) : NSSelectorFromString(_name);
+            free(getterName);
+            
+            char *setterName = property_copyAttributeValue(runtimeProperty, "S");
+            SEL setter = setterName ? sel_registerName(setterName) : NSSelectorFromString([NSString stringWithFormat:@"set%@%@:", [[_name substringToIndex:1] uppercaseString], [_name substringFromIndex:1]]);
+            free(setterName);
+            
+            _getter = [aClass instancesRespondToSelector:getter] ? getter : NULL;
+            _setter = [aClass instancesRespondToSelector:setter] ? setter : NULL;
+        }
+    }
+    return self;
+}
+
+- (const char *)key {
+    return _keyData.bytes;
+}
+
+- (id)valueForObject:(id)object {
+    if (_getter) {
+        return ((id (*)(id, SEL))objc_msgSend)(object, _getter);
+    }
+    return [object valueForKey:_name];
+}
+
+- (void)setValue:(id)value forObject:(id)object {
+    if (_setter) {
+        ((void (*)(id, SEL, id))objc_msgSend)(object, _setter, value);
+        return;
+    }
+    [object setValue:value forKey:_name];
+}
+
+@end
+
+
+/*
+ Everything needed to encode or decode one class, compiled once from the encoding table: the init
+ block of the most derived registered class, and the properties of the class and all its registered
+ superclasses, flattened so that a subclass entry wins over a superclass entry with the same name.
+ */
+@interface ORKJSONClassPlan : NSObject
+
+- (instancetype)initWithClass:(Class)aClass encodings:(NSArray<ORKJSONSerializableTableEntry *> *)encodings;
+
+@property (nonatomic, readonly) Class planClass;
+@property (nonatomic, copy, readonly) NSString *className;
+@property (nonatomic, copy, readonly) ORKJSONSerializationInitBlock initBlock;
+@property (nonatomic, copy, readonly) NSArray<ORKJSONPropertyPlan *> *properties;
+@property (nonatomic, copy, readonly) NSDictionary<NSString *, ORKJSONPropertyPlan *> *propertiesByName;
+
+@end
+
+
+@implementation ORKJSONClassPlan
+
+- (instancetype)initWithClass:(Class)aClass encodings:(NSArray<ORKJSONSerializableTableEntry *> *)encodings {
+    self = [super init];
+    if (self) {
+        _planClass = aClass;
+        _className = [NSStringFromClass(aClass) copy];
+        _initBlock = [encodings.firstObject.initBlock copy];
+        
+        NSMutableArray<ORKJSONPropertyPlan *> *properties = [NSMutableArray new];
+        NSMutableDictionary<NSString *, ORKJSONPropertyPlan *> *propertiesByName = [NSMutableDictionary new];
+        for (ORKJSONSerializableTableEntry *encoding in encodings) {
+            for (ORKJSONSerializableProperty *property in encoding.properties.objectEnumerator) {
+                if (propertiesByName[property.propertyName] != nil) {
+                    continue;
+                }
+                ORKJSONPropertyPlan *propertyPlan = [[ORKJSONPropertyPlan alloc] initWithProperty:property forClass:aClass];
+                [properties addObject:propertyPlan];
+                propertiesByName[propertyPlan.name] = propertyPlan;
+            }
+        }
+        _properties = [properties copy];
+        _propertiesByName = [propertiesByName copy];
+    }
+    return self;
+}
+
+@end
+
+
+static NSCache *ORKJSONPlansByClass(void) {
+    static NSCache *cache;
+    static dispatch_once_t onceToken;
+    dispatch_once(&onceToken, ^{
+        cache = [NSCache new];
+    });
+    return cache;
+}
+
+static NSCache<NSString *, ORKJSONClassPlan *> *ORKJSONPlansByClassName(void) {
+    static NSCache<NSString *, ORKJSONClassPlan *> *cache;
+    static dispatch_once_t onceToken;
+    dispatch_once(&onceToken, ^{
+        cache = [NSCache new];
+    });
+    return cache;
+}
+
+// Must be called while synchronized on the encoding table.
+static NSArray<ORKJSONSerializableTableEntry *> *classEncodingsForClass(Class c) {
+    NSDictionary *encodingTable = ORKJSONSerializationEncodingTable();
     
     NSMutableArray *classEncodings = [NSMutableArray array];
     Class sc = c;
     while (sc != nil) {
         NSString *className = NSStringFromClass(sc);
-        ORKESerializableTableEntry *classEncoding = encodingTable[className];
+        ORKJSONSerializableTableEntry *classEncoding = encodingTable[className];
         if (classEncoding) {
             [classEncodings addObject:classEncoding];
         }
@@ -1665,65 +1854,218 @@ static NSArray *classEncodingsForClass(Class c) {
     return classEncodings;
 }
 
-static id objectForJsonObject(id input, Class expectedClass, ORKESerializationJSONToObjectBlock converterBlock) {
+// Returns nil for classes that have no registered encoding. Negative results are cached too, since
+// most leaf values (strings, numbers) are looked up on every encode.
+static ORKJSONClassPlan *ORKJSONPlanForClass(Class c) {
+    if (c == nil) {
+        return nil;
+    }
+    NSCache *cache = ORKJSONPlansByClass();
+    id plan = [cache objectForKey:c];
+    if (plan == nil) {
+        // Plans are compiled and cached under the table lock, so a plan built from the table as it
+        // was before a registration cannot be cached after that registration has invalidated the cache.
+        @synchronized (ORKJSONSerializationEncodingTable()) {
+            plan = [cache objectForKey:c];
+            if (plan == nil) {
+                NSArray *encodings = classEncodingsForClass(c);
+                plan = encodings.count > 0 ? [[ORKJSONClassPlan alloc] initWithClass:c encodings:encodings] : [NSNull null];
+                [cache setObject:plan forKey:c];
+            }
+        }
+    }
+    return (plan == [NSNull null]) ? nil : plan;
+}
+
+static ORKJSONClassPlan *ORKJSONPlanForClassName(NSString *className) {
+    NSCache<NSString *, ORKJSONClassPlan *> *cache = ORKJSONPlansByClassName();
+    ORKJSONClassPlan *plan = [cache objectForKey:className];
+    if (plan == nil) {
+        plan = ORKJSONPlanForClass(NSClassFromString(className));
+        @synchronized (ORKJSONSerializationEncodingTable()) {
+            // Skip caching if a registration replaced the plan while it was being looked up
+            if (plan && plan == [ORKJSONPlansByClass() objectForKey:plan.planClass]) {
+                [cache setObject:plan forKey:className];
+            }
+        }
+    }
+    return plan;
+}
+
+static void ORKJSONInvalidatePlans(void) {
+    [ORKJSONPlansByClass() removeAllObjects];
+    [ORKJSONPlansByClassName() removeAllObjects];
+}
+
+#pragma mark Decoding
+
+/*
+ The decoding functions report invalid input through `error`, which must not be `NULL`. They return
+ `nil` without setting `error` for values that a converter block left unset.
+ */
+static id objectForJsonObject(id input, Class expectedClass, ORKJSONSerializationJSONToObjectBlock converterBlock, NSError **error);
+
+static id propFromDict(NSDictionary *dict, ORKJSONPropertyPlan *propertyPlan, NSError **error) {
+    ORKJSONSerializableProperty *propertyEntry = propertyPlan.property;
+    Class propertyClass = propertyEntry.valueClass;
+    ORKJSONSerializationJSONToObjectBlock converterBlock = propertyEntry.jsonToObjectBlock;
+    
+    id input = dict[propertyPlan.name];
     id output = nil;
+    if (input != nil) {
+        switch (propertyPlan.container) {
+            case ORKJSONContainerArray: {
+                NSArray *inputArray = DYNAMICCAST(input, NSArray);
+                if (inputArray == nil) {
+                    ORKJSONSetInvalidError(error, @"Expected an array for property %@", propertyPlan.name);
+                    return nil;
+                }
+                NSMutableArray *outputArray = [NSMutableArray arrayWithCapacity:inputArray.count];
+                for (id value in inputArray) {
+                    id convertedValue = objectForJsonObject(value, propertyClass, converterBlock, error);
+                    if (convertedValue == nil) {
+                        if (*error == nil) {
+                            ORKJSONSetInvalidError(error, @"Could not convert to object of class %@", propertyClass);
+                        }
+                        return nil;
+                    }
+                    [outputArray addObject:convertedValue];
+                }
+                output = outputArray;
+                break;
+            }
+            case ORKJSONContainerDictionary: {
+                NSDictionary *inputDictionary = DYNAMICCAST(input, NSDictionary);
+                if (inputDictionary == nil) {
+                    ORKJSONSetInvalidError(error, @"Expected a dictionary for property %@", propertyPlan.name);
+                    return nil;
+                }
+                NSMutableDictionary *outputDictionary = [NSMutableDictionary dictionaryWithCapacity:inputDictionary.count];
+                for (NSString *key in [inputDictionary allKeys]) {
+                    id convertedValue = objectForJsonObject(inputDictionary[key], propertyClass, converterBlock, error);
+                    if (convertedValue == nil) {
+                        if (*error == nil) {
+                            ORKJSONSetInvalidError(error, @"Could not convert to object of class %@", propertyClass);
+                        }
+                        return nil;
+                    }
+                    outputDictionary[key] = convertedValue;
+                }
+                output = outputDictionary;
+                break;
+            }
+            case ORKJSONContainerNone:
+                output = objectForJsonObject(input, propertyClass, converterBlock, error);
+                break;
+        }
+    }
+    return output;
+}
+
+static id objectForJsonObject(id input, Class expectedClass, ORKJSONSerializationJSONToObjectBlock converterBlock, NSError **error) {
     if (converterBlock != nil) {
         input = converterBlock(input);
+        if (input == nil) {
+            // The converter rejected the value; leave the property unset
+            return nil;
+        }
     }
     
     if (expectedClass != nil && [input isKindOfClass:expectedClass]) {
         // Input is already of the expected class, do nothing
-        output = input;
-    } else if ([input isKindOfClass:[NSDictionary class]]) {
-        NSDictionary *dict = (NSDictionary *)input;
-        NSString *className = input[_ClassKey];
-        if (expectedClass != nil) {
-            NSCAssert([NSClassFromString(className) isSubclassOfClass:expectedClass], @"Expected subclass of %@ but got %@", expectedClass, className);
+        return input;
+    }
+    if (![input isKindOfClass:[NSDictionary class]]) {
+        ORKJSONSetInvalidError(error, @"Unexpected input of class %@ for %@", [input class], expectedClass);
+        return nil;
+    }
+    
+    NSDictionary *dict = (NSDictionary *)input;
+    NSString *className = DYNAMICCAST(dict[_ClassKey], NSString);
+    ORKJSONClassPlan *plan = className ? ORKJSONPlanForClassName(className) : nil;
+    if (plan == nil) {
+        ORKJSONSetInvalidError(error, @"Expected serializable class but got %@", className);
+        return nil;
+    }
+    if (expectedClass != nil && ![plan.planClass isSubclassOfClass:expectedClass]) {
+        ORKJSONSetInvalidError(error, @"Expected subclass of %@ but got %@", expectedClass, className);
+        return nil;
+    }
+    
+    // Decode every property before creating the instance, so invalid input is reported before any
+    // init block runs
+    NSMutableDictionary<NSString *, id> *values = [NSMutableDictionary dictionaryWithCapacity:dict.count];
+    for (NSString *key in dict) {
+        if ([key isEqualToString:_ClassKey]) {
+            continue;
         }
-        NSArray *classEncodings = classEncodingsForClass(NSClassFromString(className));
-        NSCAssert([classEncodings count] > 0, @"Expected serializable class but got %@", className);
-        
-        ORKESerializableTableEntry *leafClassEncoding = classEncodings.firstObject;
-        ORKESerializationInitBlock initBlock = leafClassEncoding.initBlock;
-        BOOL writeAllProperties = YES;
-        if (initBlock != nil) {
-            output = initBlock(dict,
-                               ^id(NSDictionary *dict, NSString *param) {
-                                   return propFromDict(dict, param); });
-            writeAllProperties = NO;
-        } else {
-            output = [[NSClassFromString(className) alloc] init];
+        ORKJSONPropertyPlan *propertyPlan = plan.propertiesByName[key];
+        if (propertyPlan == nil) {
+            ORKJSONSetInvalidError(error, @"Unexpected property on %@: %@", className, key);
+            return nil;
         }
-        
-        for (NSString *key in [dict allKeys]) {
-            if ([key isEqualToString:_ClassKey]) {
-                continue;
-            }
-            
-            BOOL haveSetProp = NO;
-            for (ORKESerializableTableEntry *encoding in classEncodings) {
-                NSDictionary *propertyTable = encoding.properties;
-                ORKESerializableProperty *propertyEntry = propertyTable[key];
-                if (propertyEntry != nil) {
-                    // Only write the property if it has not already been set during init
-                    if (writeAllProperties || propertyEntry.writeAfterInit) {
-                        [output setValue:propFromDict(dict,key) forKey:key];
-                    }
-                    haveSetProp = YES;
-                    break;
-                }
-            }
-            NSCAssert(haveSetProp, @"Unexpected property on %@: %@", className, key);
+        id value = propFromDict(dict, propertyPlan, error);
+        if (*error != nil) {
+            return nil;
         }
-        
+        if (value != nil) {
+            values[key] = value;
+        }
+    }
+    
+    id output = nil;
+    BOOL writeAllProperties = YES;
+    ORKJSONSerializationInitBlock initBlock = plan.initBlock;
+    if (initBlock != nil) {
+        output = initBlock(dict, ^id(__unused NSDictionary *propertyDict, NSString *propertyName) {
+            NSCAssert(plan.propertiesByName[propertyName] != nil, @"Unexpected property %@ for class %@", propertyName, plan.className);
+            return values[propertyName];
+        });
+        writeAllProperties = NO;
     } else {
-        NSCAssert(0, @"Unexpected input of class %@ for %@", [input class], expectedClass);
+        output = [[plan.planClass alloc] init];
     }
+    if (output == nil) {
+        ORKJSONSetInvalidError(error, @"Could not create an instance of %@", className);
+        return nil;
+    }
+    
+    [values enumerateKeysAndObjectsUsingBlock:^(NSString *key, id value, BOOL *stop) {
+        ORKJSONPropertyPlan *propertyPlan = plan.propertiesByName[key];
+        // Only write the property if it has not already been set during init
+        if (writeAllProperties || propertyPlan.property.writeAfterInit) {
+            [propertyPlan setValue:value forObject:output];
+        }
+    }];
     return output;
 }
 
-static BOOL isValid(id object) {
-    return [NSJSONSerialization isValidJSONObject:object] || [object isKindOfClass:[NSNumber class]] || [object isKindOfClass:[NSString class]] || [object isKindOfClass:[NSNull class]];
+#pragma mark Encoding
+
+static id jsonObjectForObject(id object);
+
+static id jsonObjectForPropertyValue(id value, ORKJSONPropertyPlan *propertyPlan) {
+    ORKJSONSerializationObjectToJSONBlock converter = propertyPlan.property.objectToJSONBlock;
+    if (propertyPlan.container == ORKJSONContainerArray) {
+        NSMutableArray *a = [NSMutableArray arrayWithCapacity:[value count]];
+        for (id valueItem in value) {
+            // Recurse for each element unless the property has a converter
+            id outputItem = converter ? converter(valueItem) : jsonObjectForObject(valueItem);
+            if (outputItem == nil || !isValid(outputItem)) {
+                ORKJSONThrowInvalid(@"Could not encode element of %@", propertyPlan.name);
+            }
+            [a addObject:outputItem];
+        }
+        return a;
+    }
+    if (converter != nil) {
+        id jsonValue = converter(value);
+        if (jsonValue != nil && !isValid(jsonValue)) {
+            ORKJSONThrowInvalid(@"Expected valid JSON object for %@", propertyPlan.name);
+        }
+        return jsonValue;
+    }
+    return jsonObjectForObject(value);
 }
 
 static id jsonObjectForObject(id object) {
@@ -1732,109 +2074,280 @@ static id jsonObjectForObject(id object) {
         return nil;
     }
     
-    id jsonOutput = nil;
-    Class c = [object class];
-    
-    NSArray *classEncodings = classEncodingsForClass(c);
-    
-    if ([classEncodings count]) {
-        NSMutableDictionary *encodedDict = [NSMutableDictionary dictionary];
-        encodedDict[_ClassKey] = NSStringFromClass(c);
-        
-        for (ORKESerializableTableEntry *encoding in classEncodings) {
-            NSDictionary *propertyTable = encoding.properties;
-            for (NSString *propertyName in [propertyTable allKeys]) {
-                ORKESerializableProperty *propertyEntry = propertyTable[propertyName];
-                ORKESerializationObjectToJSONBlock converter = propertyEntry.objectToJSONBlock;
-                Class containerClass = propertyEntry.containerClass;
-                id valueForKey = [object valueForKey:propertyName];
-                if (valueForKey != nil) {
-                    if ([containerClass isSubclassOfClass:[NSArray class]]) {
-                        NSMutableArray *a = [NSMutableArray array];
-                        for (id valueItem in valueForKey) {
-                            id outputItem;
-                            if (converter != nil) {
-                                outputItem = converter(valueItem);
-                                NSCAssert(isValid(valueItem), @"Expected valid JSON object");
-                            } else {
-                                // Recurse for each property
-                                outputItem = jsonObjectForObject(valueItem);
-                            }
-                            [a addObject:outputItem];
-                        }
-                        valueForKey = a;
-                    } else {
-                        if (converter != nil) {
-                            valueForKey = converter(valueForKey);
-                            NSCAssert((valueForKey == nil) || isValid(valueForKey), @"Expected valid JSON object");
-                        } else {
-                            // Recurse for each property
-                            valueForKey = jsonObjectForObject(valueForKey);
-                        }
-                    }
-                }
-                
-                if (valueForKey != nil) {
-                    encodedDict[propertyName] = valueForKey;
-                }
+    ORKJSONClassPlan *plan = ORKJSONPlanForClass([object class]);
+    if (plan) {
+        NSMutableDictionary *encodedDict = [NSMutableDictionary dictionaryWithCapacity:plan.properties.count + 1];
+        encodedDict[_ClassKey] = plan.className;
+        for (ORKJSONPropertyPlan *propertyPlan in plan.properties) {
+            id value = [propertyPlan valueForObject:object];
+            if (value != nil) {
+                encodedDict[propertyPlan.name] = jsonObjectForPropertyValue(value, propertyPlan);
             }
         }
-        
-        jsonOutput = encodedDict;
-    } else if ([c isSubclassOfClass:[NSArray class]]) {
+        return encodedDict;
+    }
+    
+    if ([object isKindOfClass:[NSArray class]]) {
         NSArray *inputArray = (NSArray *)object;
-        NSMutableArray *encodedArray = [NSMutableArray arrayWithCapacity:[inputArray count]];
+        NSMutableArray *encodedArray = [NSMutableArray arrayWithCapacity:inputArray.count];
         for (id input in inputArray) {
             // Recurse for each array element
-            [encodedArray addObject:jsonObjectForObject(input)];
+            id output = jsonObjectForObject(input);
+            if (output == nil) {
+                ORKJSONThrowInvalid(@"Could not encode array element of class %@", [input class]);
+            }
+            [encodedArray addObject:output];
         }
-        jsonOutput = encodedArray;
-    } else if ([c isSubclassOfClass:[NSDictionary class]]) {
+        return encodedArray;
+    }
+    if ([object isKindOfClass:[NSDictionary class]]) {
         NSDictionary *inputDict = (NSDictionary *)object;
-        NSMutableDictionary *encodedDictionary = [NSMutableDictionary dictionaryWithCapacity:[inputDict count]];
-        for (NSString *key in [inputDict allKeys] ) {
+        NSMutableDictionary *encodedDictionary = [NSMutableDictionary dictionaryWithCapacity:inputDict.count];
+        for (NSString *key in [inputDict allKeys]) {
             // Recurse for each dictionary value
             encodedDictionary[key] = jsonObjectForObject(inputDict[key]);
         }
-        jsonOutput = encodedDictionary;
-    } else if (![c isSubclassOfClass:[NSPredicate class]]) {  // Ignore NSPredicate which cannot be easily serialized for now
-        NSCAssert(isValid(object), @"Expected valid JSON object");
-        
-        // Leaf: native JSON object
-        jsonOutput = object;
+        return encodedDictionary;
+    }
+    if ([object isKindOfClass:[NSPredicate class]]) {
+        // Ignore NSPredicate which cannot be easily serialized for now
+        return nil;
+    }
+    if (!isValid(object)) {
+        ORKJSONThrowInvalid(@"Cannot encode object of class %@", [object class]);
+    }
+    // Leaf: native JSON object
+    return object;
+}
+
+
+/*
+ Writes the same JSON as `jsonObjectForObject`, straight into an `ORKJSONWriter`. When a stream is
+ set, the buffer is flushed to it whenever it grows past `ORKJSONStreamChunkSize`.
+ */
+@interface ORKJSONStreamEncoder : NSObject
+
+- (instancetype)initWithStream:(NSOutputStream *)stream;
+
+@property (nonatomic, readonly) ORKJSONWriter *writer;
+
+- (void)writeValue:(id)object;
+- (void)flush;
+
+@end
+
+
+@implementation ORKJSONStreamEncoder {
+    NSOutputStream *_stream;
+}
+
+- (instancetype)initWithStream:(NSOutputStream *)stream {
+    self = [super init];
+    if (self) {
+        _stream = stream;
+        _writer = [ORKJSONWriter new];
+    }
+    return self;
+}
+
+- (void)flush {
+    NSData *data = _writer.data;
+    const uint8_t *bytes = data.bytes;
+    NSUInteger remaining = data.length;
+    while (remaining > 0) {
+        NSInteger written = [_stream write:bytes maxLength:remaining];
+        if (written <= 0) {
+            @throw [NSException exceptionWithName:NSInternalInconsistencyException
+                                           reason:@"Could not write to the output stream"
+                                         userInfo:_stream.streamError ? @{NSUnderlyingErrorKey: _stream.streamError} : nil];
+        }
+        bytes += written;
+        remaining -= written;
+    }
+    [_writer discardBufferedBytes];
+}
+
+- (void)flushIfNeeded {
+    if (_stream != nil && _writer.data.length >= ORKJSONStreamChunkSize) {
+        [self flush];
     }
-    
-    return jsonOutput;
+}
+
+- (void)writeJSONValue:(id)jsonValue {
+    if (!isValid(jsonValue)) {
+        ORKJSONThrowInvalid(@"Expected valid JSON object but got %@", [jsonValue class]);
+    }
+    [_writer writeObject:jsonValue];
+}
+
+- (void)writeObject:(id)object plan:(ORKJSONClassPlan *)plan {
+    [_writer beginObject];
+    [_writer writeKey:"_class" string:plan.className];
+    for (ORKJSONPropertyPlan *propertyPlan in plan.properties) {
+        id value = [propertyPlan valueForObject:object];
+        if (value == nil) {
+            continue;
+        }
+        ORKJSONSerializationObjectToJSONBlock converter = propertyPlan.property.objectToJSONBlock;
+        if (propertyPlan.container == ORKJSONContainerArray) {
+            [_writer writeKey:propertyPlan.key];
+            [_writer beginArray];
+            for (id valueItem in value) {
+                if (converter != nil) {
+                    id jsonItem = converter(valueItem);
+                    if (jsonItem == nil) {
+                        ORKJSONThrowInvalid(@"Could not encode element of %@", propertyPlan.name);
+                    }
+                    [self writeJSONValue:jsonItem];
+                } else {
+                    [self writeValue:valueItem];
+                }
+            }
+            [_writer endArray];
+        } else if (converter != nil) {
+            id jsonValue = converter(value);
+            if (jsonValue == nil) {
+                continue;
+            }
+            [_writer writeKey:propertyPlan.key];
+            [self writeJSONValue:jsonValue];
+        } else {
+            if ([self shouldSkipValue:value]) {
+                continue;
+            }
+            [_writer writeKey:propertyPlan.key];
+            [self writeValue:value];
+        }
+        [self flushIfNeeded];
+    }
+    [_writer endObject];
+}
+
+- (BOOL)shouldSkipValue:(id)value {
+    return [value isKindOfClass:[NSPredicate class]] && ORKJSONPlanForClass([value class]) == nil;
+}
+
+- (void)writeValue:(id)object {
+    ORKJSONClassPlan *plan = ORKJSONPlanForClass([object class]);
+    if (plan) {
+        [self writeObject:object plan:plan];
+    } else if ([object isKindOfClass:[NSArray class]]) {
+        [_writer beginArray];
+        for (id element in (NSArray *)object) {
+            if ([self shouldSkipValue:element]) {
+                ORKJSONThrowInvalid(@"Could not encode array element of class %@", [element class]);
+            }
+            [self writeValue:element];
+        }
+        [_writer endArray];
+    } else if ([object isKindOfClass:[NSDictionary class]]) {
+        NSDictionary *dictionary = (NSDictionary *)object;
+        [_writer beginObject];
+        for (NSString *key in dictionary) {
+            id value = dictionary[key];
+            if ([self shouldSkipValue:value]) {
+                continue;
+            }
+            [_writer writeEscapedKey:key];
+            [self writeValue:value];
+        }
+        [_writer endObject];
+    } else {
+        [self writeJSONValue:object];
+    }
+}
+
+@end
+
+
+static BOOL ORKJSONPerform(NSError **error, void (^block)(void)) {
+    @try {
+        block();
+    }
+    @catch (NSException *exception) {
+        if (error) {
+            *error = [NSError errorWithDomain:ORKErrorDomain
+                                         code:ORKErrorException
+                                     userInfo:@{@"exception": exception,
+                                                NSLocalizedFailureReasonErrorKey: exception.reason ? : exception.name}];
+        }
+        return NO;
+    }
+    return YES;
+}
+
+
+@implementation ORKJSONSerializer
+
++ (instancetype)new {
+    ORKThrowMethodUnavailableException();
+}
+
+- (instancetype)init {
+    ORKThrowMethodUnavailableException();
 }
 
 + (NSDictionary *)JSONObjectForObject:(id)object error:(NSError **)error {
-    id json = jsonObjectForObject(object);
+    __block id json = nil;
+    if (!ORKJSONPerform(error, ^{
+        json = jsonObjectForObject(object);
+        if (![json isKindOfClass:[NSDictionary class]]) {
+            ORKJSONThrowInvalid(@"Expected serializable object but got %@", [object class]);
+        }
+    })) {
+        return nil;
+    }
     return json;
 }
 
-+ (id)objectFromJSONObject:(NSDictionary *)object error:(NSError **)error {
-    return objectForJsonObject(object, nil, nil);
++ (NSData *)JSONDataForObject:(id)object error:(NSError **)error {
+    ORKJSONStreamEncoder *encoder = [[ORKJSONStreamEncoder alloc] initWithStream:nil];
+    if (!ORKJSONPerform(error, ^{
+        [encoder writeValue:object];
+    })) {
+        return nil;
+    }
+    return [encoder.writer.data copy];
 }
 
-+ (NSData *)JSONDataForObject:(id)object error:(NSError **)error {
-    id json = jsonObjectForObject(object);
-    return [NSJSONSerialization dataWithJSONObject:json options:(NSJSONWritingOptions)0 error:error];
++ (BOOL)writeObject:(id)object toStream:(NSOutputStream *)stream error:(NSError **)error {
+    ORKThrowInvalidArgumentExceptionIfNil(stream);
+    
+    ORKJSONStreamEncoder *encoder = [[ORKJSONStreamEncoder alloc] initWithStream:stream];
+    return ORKJSONPerform(error, ^{
+        [encoder writeValue:object];
+        [encoder flush];
+    });
+}
+
++ (id)objectFromJSONObject:(NSDictionary *)object error:(NSError **)error {
+    NSError *decodeError = nil;
+    id output = objectForJsonObject(object, nil, nil, &decodeError);
+    if (decodeError != nil) {
+        if (error) {
+            *error = decodeError;
+        }
+        return nil;
+    }
+    return output;
 }
 
 + (id)objectFromJSONData:(NSData *)data error:(NSError **)error {
     id json = [NSJSONSerialization JSONObjectWithData:data options:(NSJSONReadingOptions)0 error:error];
     id ret = nil;
     if (json != nil) {
-        ret = objectForJsonObject(json, nil, nil);
+        ret = [self objectFromJSONObject:json error:error];
     }
     return ret;
 }
 
 + (NSArray *)serializableClasses {
     NSMutableArray *a = [NSMutableArray array];
-    NSDictionary *table = ORKESerializationEncodingTable();
-    for (NSString *key in [table allKeys]) {
-        [a addObject:NSClassFromString(key)];
+    NSDictionary *table = ORKJSONSerializationEncodingTable();
+    @synchronized (table) {
+        for (NSString *key in [table allKeys]) {
+            [a addObject:NSClassFromString(key)];
+        }
     }
     return a;
 }
@@ -1842,19 +2355,22 @@ static id jsonObjectForObject(id object) {
 @end
 
 
-@implementation ORKESerializer(Registration)
+@implementation ORKJSONSerializer(Registration)
 
 + (void)registerSerializableClass:(Class)serializableClass
-                        initBlock:(ORKESerializationInitBlock)initBlock {
-    NSMutableDictionary *encodingTable = ORKESerializationEncodingTable();
+                        initBlock:(ORKJSONSerializationInitBlock)initBlock {
+    NSMutableDictionary *encodingTable = ORKJSONSerializationEncodingTable();
     
-    ORKESerializableTableEntry *entry = encodingTable[NSStringFromClass(serializableClass)];
-    if (entry) {
-        entry.class = serializableClass;
-        entry.initBlock = initBlock;
-    } else {
-        entry = [[ORKESerializableTableEntry alloc] initWithClass:serializableClass initBlock:initBlock properties:@{}];
-        encodingTable[NSStringFromClass(serializableClass)] = entry;
+    @synchronized (encodingTable) {
+        ORKJSONSerializableTableEntry *entry = encodingTable[NSStringFromClass(serializableClass)];
+        if (entry) {
+            entry.class = serializableClass;
+            entry.initBlock = initBlock;
+        } else {
+            entry = [[ORKJSONSerializableTableEntry alloc] initWithClass:serializableClass initBlock:initBlock properties:@{}];
+            encodingTable[NSStringFromClass(serializableClass)] = entry;
+        }
+        ORKJSONInvalidatePlans();
     }
 }
 
@@ -1863,32 +2379,26 @@ static id jsonObjectForObject(id object) {
                                    valueClass:(Class)valueClass
                                containerClass:(Class)containerClass
                                writeAfterInit:(BOOL)writeAfterInit
-                            objectToJSONBlock:(ORKESerializationObjectToJSONBlock)objectToJSON
-                            jsonToObjectBlock:(ORKESerializationJSONToObjectBlock)jsonToObjectBlock {
-    NSMutableDictionary *encodingTable = ORKESerializationEncodingTable();
+                            objectToJSONBlock:(ORKJSONSerializationObjectToJSONBlock)objectToJSON
+                            jsonToObjectBlock:(ORKJSONSerializationJSONToObjectBlock)jsonToObjectBlock {
+    NSMutableDictionary *encodingTable = ORKJSONSerializationEncodingTable();
     
-    ORKESerializableTableEntry *entry = encodingTable[NSStringFromClass(serializableClass)];
-    if (!entry) {
-        entry = [[ORKESerializableTableEntry alloc] initWithClass:serializableClass initBlock:nil properties:@{}];
-        encodingTable[NSStringFromClass(serializableClass)] = entry;
-    }
-    
-    ORKESerializableProperty *property = entry.properties[propertyName];
-    if (property == nil) {
-        property = [[ORKESerializableProperty alloc] initWithPropertyName:propertyName
-                                                               valueClass:valueClass
-                                                           containerClass:containerClass
-                                                           writeAfterInit:writeAfterInit
-                                                        objectToJSONBlock:objectToJSON
-                                                        jsonToObjectBlock:jsonToObjectBlock];
-        entry.properties[propertyName] = property;
-    } else {
-        property.propertyName = propertyName;
-        property.valueClass = valueClass;
-        property.containerClass = containerClass;
-        property.writeAfterInit = writeAfterInit;
-        property.objectToJSONBlock = objectToJSON;
-        property.jsonToObjectBlock = jsonToObjectBlock;
+    @synchronized (encodingTable) {
+        ORKJSONSerializableTableEntry *entry = encodingTable[NSStringFromClass(serializableClass)];
+        if (!entry) {
+            entry = [[ORKJSONSerializableTableEntry alloc] initWithClass:serializableClass initBlock:nil properties:@{}];
+            encodingTable[NSStringFromClass(serializableClass)] = entry;
+        }
+        
+        // Replace rather than update an existing property, since compiled plans still in use on
+        // other threads hold on to it
+        entry.properties[propertyName] = [[ORKJSONSerializableProperty alloc] initWithPropertyName:propertyName
+                                                                                         valueClass:valueClass
+                                                                                     containerClass:containerClass
+                                                                                     writeAfterInit:writeAfterInit
+                                                                                  objectToJSONBlock:objectToJSON
+                                                                                  jsonToObjectBlock:jsonToObjectBlock];
+        ORKJSONInvalidatePlans();
     }
 }
 
@@ -65,7 +65,7 @@ static const CGFloat PickerMinimumHeight = 34.0;
         // setup the helpers
         NSMutableArray *helpers = [NSMutableArray new];
         for (ORKValuePickerAnswerFormat *valuePicker in answerFormat.valuePickers) {
-            [helpers addObject:[[ORKChoiceAnswerFormatHelper alloc] initWithAnswerFormat:valuePicker]];
+            [helpers addObject:[ORKChoiceAnswerFormatHelper helperForAnswerFormat:valuePicker]];
         }
         _helpers = [helpers copy];
 
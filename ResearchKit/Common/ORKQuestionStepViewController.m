@@ -64,8 +64,13 @@ typedef NS_ENUM(NSInteger, ORKQuestionSection) {
     ORKQuestionSection_COUNT
 };
 
+// Text choice lists at least this long get a search bar to filter the choices.
+static const NSUInteger ORKChoiceSearchMinimumChoiceCount = 50;
 
-@interface ORKQuestionStepViewController () <UITableViewDataSource,UITableViewDelegate, ORKSurveyAnswerCellDelegate> {
+static NSString *const ORKChoiceViewCellReuseIdentifier = @"ORKChoiceViewCell";
+
+
+@interface ORKQuestionStepViewController () <UITableViewDataSource,UITableViewDelegate, UISearchBarDelegate, ORKSurveyAnswerCellDelegate> {
     id _answer;
     
     ORKTableContainerView *_tableContainer;
@@ -77,6 +82,10 @@ typedef NS_ENUM(NSInteger, ORKQuestionSection) {
     NSTimeZone *_savedSystemTimeZone;
     
     ORKTextChoiceCellGroup *_choiceCellGroup;
+    UISearchBar *_choiceSearchBar;
+    // Choice cell heights by choice index, valid for the table width they were measured at.
+    NSMutableDictionary<NSNumber *, NSNumber *> *_choiceCellHeights;
+    CGFloat _choiceCellHeightsWidth;
     ORKQuestionStepCellHolderView *_cellHolderView;
     
     id _defaultAnswer;
@@ -144,6 +153,9 @@ typedef NS_ENUM(NSInteger, ORKQuestionSection) {
     _answerFormat = [self.questionStep impliedAnswerFormat];
     
     self.hasChangedAnswer = NO;
+    _choiceCellGroup = nil;
+    _choiceSearchBar = nil;
+    _choiceCellHeights = nil;
     
     if ([self isViewLoaded]) {
         BOOL neediPadDesign = ORKNeedWideScreenDesign(self.view);
@@ -478,8 +490,13 @@ typedef NS_ENUM(NSInteger, ORKQuestionSection) {
 }
 
 - (void)adjustUIforChangesToDetailTextAtIndexPath:(NSIndexPath *)indexPath {
+    NSUInteger choiceIndex = [_choiceCellGroup choiceIndexAtIndexPath:indexPath];
+    if (choiceIndex == NSNotFound) {
+        return;
+    }
+    [_choiceCellHeights removeObjectForKey:@(choiceIndex)];
     [self.tableView beginUpdates];
-    [_choiceCellGroup updateLabelsForCell:[self.tableView cellForRowAtIndexPath:indexPath] atIndex:indexPath.row];
+    [_choiceCellGroup updateLabelsForCell:[self.tableView cellForRowAtIndexPath:indexPath] atIndex:choiceIndex];
     [self.tableView endUpdates];
 }
 
@@ -678,25 +695,57 @@ typedef NS_ENUM(NSInteger, ORKQuestionSection) {
 }
 
 - (UIView *)tableView:(UITableView *)tableView viewForHeaderInSection:(NSInteger)section {
+    UIView *cardHeaderView = nil;
     if ([self questionStep].useCardView && [self questionStep].question) {
-        return [[ORKSurveyCardHeaderView alloc] initWithTitle:self.questionStep.question];
+        cardHeaderView = [[ORKSurveyCardHeaderView alloc] initWithTitle:self.questionStep.question];
     }
-    return nil;
+    
+    if (section != ORKQuestionSectionAnswer || ![self isChoiceListSearchable]) {
+        return cardHeaderView;
+    }
+    
+    NSArray<UIView *> *arrangedSubviews = cardHeaderView ? @[cardHeaderView, [self choiceSearchBar]] : @[[self choiceSearchBar]];
+    UIStackView *headerView = [[UIStackView alloc] initWithArrangedSubviews:arrangedSubviews];
+    headerView.axis = UILayoutConstraintAxisVertical;
+    return headerView;
 }
 
 - (NSInteger)tableView:(UITableView *)tableView numberOfRowsInSection:(NSInteger)section {
     ORKAnswerFormat *impliedAnswerFormat = [_answerFormat impliedAnswerFormat];
     
     if (section == ORKQuestionSectionAnswer) {
-        _choiceCellGroup = [[ORKTextChoiceCellGroup alloc] initWithTextChoiceAnswerFormat:(ORKTextChoiceAnswerFormat *)impliedAnswerFormat
-                                                                                   answer:self.answer
-                                                                       beginningIndexPath:[NSIndexPath indexPathForRow:0 inSection:section]
-                                                                      immediateNavigation:[self isStepImmediateNavigation]];
+        BOOL immediateNavigation = [self isStepImmediateNavigation];
+        if (_choiceCellGroup == nil || _choiceCellGroup.immediateNavigation != immediateNavigation) {
+            _choiceCellGroup = [[ORKTextChoiceCellGroup alloc] initWithTextChoiceAnswerFormat:(ORKTextChoiceAnswerFormat *)impliedAnswerFormat
+                                                                                       answer:self.answer
+                                                                           beginningIndexPath:[NSIndexPath indexPathForRow:0 inSection:section]
+                                                                          immediateNavigation:immediateNavigation];
+            _choiceCellGroup.filterQuery = _choiceSearchBar.text;
+        } else {
+            _choiceCellGroup.answer = self.answer;
+        }
         return _choiceCellGroup.size;
     }
     return 0;
 }
 
+- (BOOL)isChoiceListSearchable {
+    ORKTextChoiceAnswerFormat *textChoiceAnswerFormat = ORKDynamicCast(_answerFormat, ORKTextChoiceAnswerFormat);
+    return textChoiceAnswerFormat.textChoices.count >= ORKChoiceSearchMinimumChoiceCount;
+}
+
+- (UISearchBar *)choiceSearchBar {
+    if (!_choiceSearchBar) {
+        _choiceSearchBar = [UISearchBar new];
+        _choiceSearchBar.searchBarStyle = UISearchBarStyleMinimal;
+        _choiceSearchBar.placeholder = ORKLocalizedString(@"PLACEHOLDER_SEARCH_CHOICES", nil);
+        _choiceSearchBar.autocapitalizationType = UITextAutocapitalizationTypeNone;
+        _choiceSearchBar.autocorrectionType = UITextAutocorrectionTypeNo;
+        _choiceSearchBar.delegate = self;
+    }
+    return _choiceSearchBar;
+}
+
 - (ORKSurveyAnswerCell *)answerCellForTableView:(UITableView *)tableView {
     static NSDictionary *typeAndCellMapping = nil;
     static NSString *identifier = nil;
@@ -767,11 +816,12 @@ typedef NS_ENUM(NSInteger, ORKQuestionSection) {
 
     assert (self.questionStep.isFormatFitsChoiceCells);
     
-    identifier = [NSStringFromClass([self class]) stringByAppendingFormat:@"%@", @(indexPath.row)];
+    identifier = ORKChoiceViewCellReuseIdentifier;
     
-    ORKChoiceViewCell *cell = [tableView dequeueReusableCellWithIdentifier:identifier];
+    // Choice cells are reused between rows, so long lists only hold cells for the visible rows.
+    ORKChoiceViewCell *cell = ORKDynamicCast([tableView dequeueReusableCellWithIdentifier:identifier], ORKChoiceViewCell);
     
-    cell = [_choiceCellGroup cellAtIndexPath:indexPath withReuseIdentifier:identifier];
+    cell = [_choiceCellGroup cellAtIndexPath:indexPath reusingCell:cell withReuseIdentifier:identifier];
     
     cell.useCardView = self.questionStep.useCardView;
     cell.userInteractionEnabled = !self.readOnlyMode;
@@ -866,7 +916,8 @@ typedef NS_ENUM(NSInteger, ORKQuestionSection) {
         case ORKQuestionTypeSingleChoice:
         case ORKQuestionTypeMultipleChoice:{
             if ([self.questionStep isFormatFitsChoiceCells]) {
-                height = [self heightForChoiceItemOptionAtIndex:indexPath.row];
+                NSUInteger choiceIndex = [_choiceCellGroup choiceIndexAtIndexPath:indexPath];
+                height = [self heightForChoiceItemOptionAtIndex:(choiceIndex != NSNotFound ? choiceIndex : indexPath.row)];
             } else {
                 height = [ORKSurveyAnswerCellForPicker suggestedCellHeightForView:tableView];
             }
@@ -897,11 +948,55 @@ typedef NS_ENUM(NSInteger, ORKQuestionSection) {
 }
 
 - (CGFloat)heightForChoiceItemOptionAtIndex:(NSInteger)index {
+    // Heights are measured lazily as rows are displayed, and kept until the table width changes.
+    CGFloat width = _tableView.bounds.size.width;
+    if (_choiceCellHeights == nil || _choiceCellHeightsWidth != width) {
+        _choiceCellHeights = [NSMutableDictionary new];
+        _choiceCellHeightsWidth = width;
+    }
+    NSNumber *cachedHeight = _choiceCellHeights[@(index)];
+    if (cachedHeight) {
+        return cachedHeight.doubleValue;
+    }
+    
     ORKTextChoice *option = [(ORKTextChoiceAnswerFormat *)_answerFormat textChoices][index];
-    return [ORKChoiceViewCell suggestedCellHeightForShortText:option.text
-                                                     LongText:(option.detailTextShouldDisplay) ? option.detailText : nil
-                                      showDetailTextIndicator:((ORKTextChoiceAnswerFormat *)_answerFormat).descriptionStyle == ORKChoiceDescriptionStyleDisplayWhenExpanded
-                                                  inTableView:_tableView];
+    CGFloat height = [ORKChoiceViewCell suggestedCellHeightForShortText:option.text
+                                                               LongText:(option.detailTextShouldDisplay) ? option.detailText : nil
+                                                showDetailTextIndicator:((ORKTextChoiceAnswerFormat *)_answerFormat).descriptionStyle == ORKChoiceDescriptionStyleDisplayWhenExpanded
+                                                            inTableView:_tableView];
+    _choiceCellHeights[@(index)] = @(height);
+    return height;
+}
+
+#pragma mark - UISearchBarDelegate
+
+- (void)searchBar:(UISearchBar *)searchBar textDidChange:(NSString *)searchText {
+    NSUInteger previousRowCount = _choiceCellGroup.size;
+    _choiceCellGroup.filterQuery = searchText;
+    NSUInteger rowCount = _choiceCellGroup.size;
+    
+    // Update the rows in place; reloading the section would recreate the header holding the search bar.
+    NSMutableArray<NSIndexPath *> *reloadedRows = [NSMutableArray new];
+    NSMutableArray<NSIndexPath *> *changedRows = [NSMutableArray new];
+    for (NSUInteger row = 0; row < MAX(previousRowCount, rowCount); row++) {
+        NSIndexPath *indexPath = [NSIndexPath indexPathForRow:row inSection:ORKQuestionSectionAnswer];
+        [(row < MIN(previousRowCount, rowCount) ? reloadedRows : changedRows) addObject:indexPath];
+    }
+    
+    [UIView performWithoutAnimation:^{
+        [self.tableView beginUpdates];
+        [self.tableView reloadRowsAtIndexPaths:reloadedRows withRowAnimation:UITableViewRowAnimationNone];
+        if (rowCount > previousRowCount) {
+            [self.tableView insertRowsAtIndexPaths:changedRows withRowAnimation:UITableViewRowAnimationNone];
+        } else if (rowCount < previousRowCount) {
+            [self.tableView deleteRowsAtIndexPaths:changedRows withRowAnimation:UITableViewRowAnimationNone];
+        }
+        [self.tableView endUpdates];
+    }];
+}
+
+- (void)searchBarSearchButtonClicked:(UISearchBar *)searchBar {
+    [searchBar resignFirstResponder];
 }
 
 #pragma mark - ORKSurveyAnswerCellDelegate
@@ -0,0 +1,110 @@
+/*
+ Copyright (c) 2026, CareEvolution, Inc.
+ 
+ Redistribution and use in source and binary forms, with or without modification,
+ are permitted provided that the following conditions are met:
+ 
+ 1.  Redistributions of source code must retain the above copyright notice, this
+ list of conditions and the following disclaimer.
+ 
+ 2.  Redistributions in binary form must reproduce the above copyright notice,
+ this list of conditions and the following disclaimer in the documentation and/or
+ other materials provided with the distribution.
+ 
+ 3.  Neither the name of the copyright holder(s) nor the names of any contributors
+ may be used to endorse or promote products derived from this software without
+ specific prior written permission. No license is granted to the trademarks of
+ the copyright holders even if such marks are included in this software.
+ 
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE
+ FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+@import Foundation;
+#import <ResearchKit/ORKDefines.h>
+
+
+NS_ASSUME_NONNULL_BEGIN
+
+@class ORKStepResult;
+@class ORKTaskResult;
+
+/**
+ The `ORKResultArchiveWriter` class packages a task run into a single ZIP archive, ready to upload.
+ 
+ The archive contains every file referenced by an `ORKFileResult` under `files/`, the task result
+ serialized with `ORKJSONSerializer` as `result.json`, and a `manifest.json` that lists each entry
+ with its size and SHA-256 checksum. Manifest entries for files also record the original `fileURL`,
+ so the file results in `result.json` can be matched to the archived files, and an `abandoned` flag.
+ Abandoned files were appended but are not part of `result.json`: they belong to step results the
+ participant discarded, for example by going back and redoing a step, or they are earlier versions
+ of files that were rewritten after they were appended.
+ 
+ Files are streamed into the archive from disk, so they are never read into memory as a whole.
+ Append each step result as its step finishes (the task view controller does this for you when
+ its `resultArchiveWriter` is set), and the files are compressed in the background while the
+ participant continues with the task. Finishing then only has to write the result and manifest.
+ 
+ Audio, image, and video files, which are already compressed, are stored rather than deflated.
+ */
+ORK_CLASS_AVAILABLE
+@interface ORKResultArchiveWriter : NSObject
+
++ (instancetype)new NS_UNAVAILABLE;
+- (instancetype)init NS_UNAVAILABLE;
+
+/**
+ Returns a writer that creates an archive at the specified URL.
+ 
+ Any existing file at the URL is replaced when the first entry is written.
+ 
+ @param archiveURL  The file URL of the archive to create.
+ 
+ @return An initialized archive writer.
+ */
+- (instancetype)initWithArchiveURL:(NSURL *)archiveURL NS_DESIGNATED_INITIALIZER;
+
+/// The file URL of the archive.
+@property (nonatomic, copy, readonly) NSURL *archiveURL;
+
+/**
+ Queues the files referenced by the file results in a step result for archiving.
+ 
+ Files are written on a background queue. A file is archived again only if its size or
+ modification date changed since it was last archived. A file that cannot be archived fails the archive, and the error is reported by
+ `finishWithTaskResult:completionHandler:`.
+ 
+ @param stepResult  The result of a step that has finished.
+ */
+- (void)appendStepResult:(ORKStepResult *)stepResult;
+
+/**
+ Completes the archive in the background.
+ 
+ Waits for queued files to be written, archives any files in `taskResult` that were not appended
+ earlier or that changed since they were appended, and writes the result and the manifest. The
+ completion handler is called on the main queue once the archive is closed. If the archive could not
+ be written, the partial archive is removed and the handler receives the error that occurred.
+ 
+ @param taskResult          The result of the task run.
+ @param completionHandler   The block to call when the archive is complete, with `nil` on success.
+ */
+- (void)finishWithTaskResult:(ORKTaskResult *)taskResult completionHandler:(void (^)(NSError * _Nullable error))completionHandler;
+
+/**
+ Stops writing and removes the partial archive.
+ */
+- (void)cancel;
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,694 @@
+/*
+ Copyright (c) 2026, CareEvolution, Inc.
+ 
+ Redistribution and use in source and binary forms, with or without modification,
+ are permitted provided that the following conditions are met:
+ 
+ 1.  Redistributions of source code must retain the above copyright notice, this
+ list of conditions and the following disclaimer.
+ 
+ 2.  Redistributions in binary form must reproduce the above copyright notice,
+ this list of conditions and the following disclaimer in the documentation and/or
+ other materials provided with the distribution.
+ 
+ 3.  Neither the name of the copyright holder(s) nor the names of any contributors
+ may be used to endorse or promote products derived from this software without
+ specific prior written permission. No license is granted to the trademarks of
+ the copyright holders even if such marks are included in this software.
+ 
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE
+ FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#import "ORKResultArchiveWriter.h"
+
+#import "ORKCollectionResult.h"
+#import "ORKFileResult.h"
+#import "ORKJSONSerializer.h"
+
+#import "ORKHelpers_Internal.h"
+#import "ORKHelpers_Private.h"
+
+#import <CommonCrypto/CommonDigest.h>
+#import <fcntl.h>
+#import <unistd.h>
+#import <zlib.h>
+
+
+static const NSUInteger ORKArchiveChunkSize = 64 * 1024;
+
+static NSString *const ORKArchiveFilesDirectory = @"files";
+static NSString *const ORKArchiveResultPath = @"result.json";
+static NSString *const ORKArchiveManifestPath = @"manifest.json";
+
+// ZIP method numbers and the general purpose flag marking UTF-8 entry names
+static const uint16_t ORKArchiveMethodStored = 0;
+static const uint16_t ORKArchiveMethodDeflated = 8;
+static const uint16_t ORKArchiveFlagUTF8 = 0x0800;
+static const uint16_t ORKArchiveVersion = 20;
+
+static BOOL ORKArchiveShouldStoreFileWithExtension(NSString *extension) {
+    static NSSet<NSString *> *storedExtensions;
+    static dispatch_once_t onceToken;
+    dispatch_once(&onceToken, ^{
+        storedExtensions = [NSSet setWithArray:@[@"aac", @"caf", @"gif", @"gz", @"heic", @"jpeg", @"jpg", @"m4a", @"m4v", @"mov", @"mp3", @"mp4", @"png", @"zip"]];
+    });
+    return [storedExtensions containsObject:extension.lowercaseString];
+}
+
+static void ORKArchiveAppendUInt16(NSMutableData *data, uint16_t value) {
+    uint8_t bytes[2] = { value & 0xff, (value >> 8) & 0xff };
+    [data appendBytes:bytes length:sizeof(bytes)];
+}
+
+static void ORKArchiveAppendUInt32(NSMutableData *data, uint32_t value) {
+    uint8_t bytes[4] = { value & 0xff, (value >> 8) & 0xff, (value >> 16) & 0xff, (value >> 24) & 0xff };
+    [data appendBytes:bytes length:sizeof(bytes)];
+}
+
+static NSError *ORKArchiveError(NSString *reason) {
+    return [NSError errorWithDomain:ORKErrorDomain code:ORKErrorInvalidObject userInfo:@{NSLocalizedFailureReasonErrorKey: reason}];
+}
+
+static NSError *ORKArchivePOSIXError(NSURL *url) {
+    return [NSError errorWithDomain:NSPOSIXErrorDomain code:errno userInfo:@{NSURLErrorKey: url}];
+}
+
+static BOOL ORKArchiveSetError(NSError **errorOut, NSError *error) {
+    if (errorOut != NULL) {
+        *errorOut = error;
+    }
+    return NO;
+}
+
+static void ORKArchiveCollectFileResults(ORKResult *result, NSString *stepIdentifier, NSMutableArray<NSArray *> *fileResults) {
+    if ([result isKindOfClass:[ORKFileResult class]]) {
+        ORKFileResult *fileResult = (ORKFileResult *)result;
+        if (fileResult.fileURL.isFileURL) {
+            [fileResults addObject:@[[fileResult copy], stepIdentifier ? : @""]];
+        }
+    } else if ([result isKindOfClass:[ORKCollectionResult class]]) {
+        if ([result isKindOfClass:[ORKStepResult class]]) {
+            stepIdentifier = result.identifier;
+        }
+        for (ORKResult *childResult in ((ORKCollectionResult *)result).results) {
+            ORKArchiveCollectFileResults(childResult, stepIdentifier, fileResults);
+        }
+    }
+}
+
+
+@interface ORKArchiveEntry : NSObject
+
+@property (nonatomic, copy) NSString *path;
+@property (nonatomic) uint16_t method;
+@property (nonatomic) unsigned long long offset;
+@property (nonatomic) uint32_t crc;
+@property (nonatomic) unsigned long long compressedSize;
+@property (nonatomic) unsigned long long uncompressedSize;
+@property (nonatomic, copy) NSDictionary *manifestInfo;
+
+// For file entries, the standardized URL and the size and modification date of the archived version
+@property (nonatomic, copy) NSURL *fileURL;
+@property (nonatomic, copy) NSArray *fileVersion;
+
+@end
+
+
+@implementation ORKArchiveEntry
+
+@end
+
+
+@interface ORKResultArchiveWriter ()
+
+- (BOOL)queue_appendEntryBytes:(const void *)bytes length:(NSUInteger)length error:(NSError **)error;
+
+@end
+
+
+/*
+ Routes the output of `ORKJSONSerializer` into the archive entry that is currently open, so the
+ task result is compressed as it is serialized. Only used on the writer's queue.
+ */
+@interface ORKArchiveEntryOutputStream : NSOutputStream
+
+- (instancetype)initWithArchiveWriter:(ORKResultArchiveWriter *)archiveWriter;
+
+@end
+
+
+@implementation ORKArchiveEntryOutputStream {
+    __weak ORKResultArchiveWriter *_archiveWriter;
+    NSStreamStatus _streamStatus;
+    NSError *_streamError;
+}
+
+- (instancetype)initWithArchiveWriter:(ORKResultArchiveWriter *)archiveWriter {
+    self = [super init];
+    if (self) {
+        _archiveWriter = archiveWriter;
+        _streamStatus = NSStreamStatusNotOpen;
+    }
+    return self;
+}
+
+- (void)open {
+    _streamStatus = NSStreamStatusOpen;
+}
+
+- (void)close {
+    if (_streamStatus != NSStreamStatusError) {
+        _streamStatus = NSStreamStatusClosed;
+    }
+}
+
+- (NSStreamStatus)streamStatus {
+    return _streamStatus;
+}
+
+- (NSError *)streamError {
+    return _streamError;
+}
+
+- (BOOL)hasSpaceAvailable {
+    return (_streamStatus == NSStreamStatusOpen);
+}
+
+- (NSInteger)write:(const uint8_t *)buffer maxLength:(NSUInteger)length {
+    if (_streamStatus != NSStreamStatusOpen) {
+        return -1;
+    }
+    NSError *error = nil;
+    if (![_archiveWriter queue_appendEntryBytes:buffer length:length error:&error]) {
+        _streamError = error;
+        _streamStatus = NSStreamStatusError;
+        return -1;
+    }
+    return length;
+}
+
+@end
+
+
+@implementation ORKResultArchiveWriter {
+    dispatch_queue_t _queue;
+    int _fileDescriptor;
+    unsigned long long _offset;
+    uint16_t _dosDate;
+    uint16_t _dosTime;
+    
+    NSMutableArray<ORKArchiveEntry *> *_entries;
+    NSMutableSet<NSString *> *_entryPaths;
+    NSMutableDictionary<NSURL *, ORKArchiveEntry *> *_latestFileEntries;
+    
+    ORKArchiveEntry *_currentEntry;
+    z_stream _zstream;
+    CC_SHA256_CTX _sha256;
+    NSMutableData *_deflateBuffer;
+    
+    NSError *_error;
+    BOOL _closed;
+}
+
++ (instancetype)new {
+    ORKThrowMethodUnavailableException();
+}
+
+- (instancetype)init {
+    ORKThrowMethodUnavailableException();
+}
+
+- (instancetype)initWithArchiveURL:(NSURL *)archiveURL {
+    ORKThrowInvalidArgumentExceptionIfNil(archiveURL);
+    self = [super init];
+    if (self) {
+        _archiveURL = [archiveURL copy];
+        NSString *queueId = [@"ResearchKit.archive." stringByAppendingString:archiveURL.lastPathComponent];
+        _queue = dispatch_queue_create([queueId cStringUsingEncoding:NSUTF8StringEncoding], DISPATCH_QUEUE_SERIAL);
+        _fileDescriptor = -1;
+        _entries = [NSMutableArray new];
+        _entryPaths = [NSMutableSet new];
+        _latestFileEntries = [NSMutableDictionary new];
+        _deflateBuffer = [NSMutableData dataWithLength:ORKArchiveChunkSize];
+        
+        NSCalendar *calendar = [NSCalendar calendarWithIdentifier:NSCalendarIdentifierGregorian];
+        NSDateComponents *components = [calendar components:(NSCalendarUnitYear | NSCalendarUnitMonth | NSCalendarUnitDay | NSCalendarUnitHour | NSCalendarUnitMinute | NSCalendarUnitSecond) fromDate:[NSDate date]];
+        _dosDate = (uint16_t)(((MAX(components.year, 1980) - 1980) << 9) | (components.month << 5) | components.day);
+        _dosTime = (uint16_t)((components.hour << 11) | (components.minute << 5) | (components.second / 2));
+    }
+    return self;
+}
+
+- (void)dealloc {
+    if (_currentEntry.method == ORKArchiveMethodDeflated) {
+        deflateEnd(&_zstream);
+    }
+    if (_fileDescriptor >= 0) {
+        close(_fileDescriptor);
+    }
+}
+
+#pragma mark Public
+
+- (void)appendStepResult:(ORKStepResult *)stepResult {
+    ORKThrowInvalidArgumentExceptionIfNil(stepResult);
+    
+    NSMutableArray<NSArray *> *fileResults = [NSMutableArray new];
+    ORKArchiveCollectFileResults(stepResult, stepResult.identifier, fileResults);
+    if (fileResults.count == 0) {
+        return;
+    }
+    dispatch_async(_queue, ^{
+        [self queue_perform:^BOOL(NSError **error) {
+            for (NSArray *fileResult in fileResults) {
+                if (![self queue_archiveFileResult:fileResult[0] stepIdentifier:fileResult[1] error:error]) {
+                    return NO;
+                }
+            }
+            return YES;
+        }];
+    });
+}
+
+- (void)finishWithTaskResult:(ORKTaskResult *)taskResult completionHandler:(void (^)(NSError *error))completionHandler {
+    ORKThrowInvalidArgumentExceptionIfNil(taskResult);
+    ORKThrowInvalidArgumentExceptionIfNil(completionHandler);
+    
+    NSMutableArray<NSArray *> *fileResults = [NSMutableArray new];
+    ORKArchiveCollectFileResults(taskResult, nil, fileResults);
+    NSMutableSet<NSURL *> *resultFileURLs = [NSMutableSet new];
+    for (NSArray *fileResult in fileResults) {
+        [resultFileURLs addObject:((ORKFileResult *)fileResult[0]).fileURL.URLByStandardizingPath];
+    }
+    
+    dispatch_async(_queue, ^{
+        [self queue_perform:^BOOL(NSError **error) {
+            // Files changed since they were appended are archived again
+            for (NSArray *fileResult in fileResults) {
+                if (![self queue_archiveFileResult:fileResult[0] stepIdentifier:fileResult[1] error:error]) {
+                    return NO;
+                }
+            }
+            return ([self queue_writeTaskResult:taskResult error:error] &&
+                    [self queue_writeManifestForTaskResult:taskResult resultFileURLs:resultFileURLs error:error] &&
+                    [self queue_closeWithError:error]);
+        }];
+        NSError *archiveError = self->_error;
+        if (archiveError != nil) {
+            [self queue_discard];
+        }
+        dispatch_async(dispatch_get_main_queue(), ^{
+            completionHandler(archiveError);
+        });
+    });
+}
+
+- (void)cancel {
+    dispatch_sync(_queue, ^{
+        if (!self->_closed || self->_error != nil) {
+            [self queue_discard];
+        }
+    });
+}
+
+#pragma mark Queue
+
+// Runs archive work, keeping the first failure as the writer's error. Once the writer has failed
+// or closed, later work is skipped.
+- (void)queue_perform:(BOOL (^)(NSError **error))block {
+    if (_error != nil || _closed) {
+        return;
+    }
+    NSError *error = nil;
+    if (!block(&error)) {
+        _error = error ? : ORKArchiveError(@"Archive write failed");
+    }
+}
+
+- (void)queue_discard {
+    if (_currentEntry.method == ORKArchiveMethodDeflated) {
+        deflateEnd(&_zstream);
+    }
+    _currentEntry = nil;
+    if (_fileDescriptor >= 0) {
+        close(_fileDescriptor);
+        _fileDescriptor = -1;
+    }
+    _closed = YES;
+    [[NSFileManager defaultManager] removeItemAtURL:_archiveURL error:nil];
+}
+
+- (BOOL)queue_openIfNeededWithError:(NSError **)error {
+    if (_fileDescriptor >= 0) {
+        return YES;
+    }
+    if (![[NSFileManager defaultManager] createDirectoryAtURL:[_archiveURL URLByDeletingLastPathComponent] withIntermediateDirectories:YES attributes:nil error:error]) {
+        return NO;
+    }
+    _fileDescriptor = open(_archiveURL.fileSystemRepresentation, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    if (_fileDescriptor < 0) {
+        return ORKArchiveSetError(error, ORKArchivePOSIXError(_archiveURL));
+    }
+    _offset = 0;
+    return YES;
+}
+
+- (BOOL)queue_writeBytes:(const void *)bytes length:(NSUInteger)length atOffset:(unsigned long long)offset error:(NSError **)error {
+    const uint8_t *remainingBytes = bytes;
+    while (length > 0) {
+        ssize_t written = pwrite(_fileDescriptor, remainingBytes, length, (off_t)offset);
+        if (written < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            return ORKArchiveSetError(error, ORKArchivePOSIXError(_archiveURL));
+        }
+        remainingBytes += written;
+        length -= written;
+        offset += written;
+    }
+    return YES;
+}
+
+- (BOOL)queue_writeBytes:(const void *)bytes length:(NSUInteger)length error:(NSError **)error {
+    if (![self queue_writeBytes:bytes length:length atOffset:_offset error:error]) {
+        return NO;
+    }
+    _offset += length;
+    return YES;
+}
+
+- (BOOL)queue_writeData:(NSData *)data error:(NSError **)error {
+    return [self queue_writeBytes:data.bytes length:data.length error:error];
+}
+
+- (NSString *)queue_uniquePathForFileName:(NSString *)fileName {
+    NSString *path = [ORKArchiveFilesDirectory stringByAppendingPathComponent:fileName];
+    NSUInteger counter = 1;
+    while ([_entryPaths containsObject:path]) {
+        counter++;
+        NSString *uniqueName = [NSString stringWithFormat:@"%@-%lu", fileName.stringByDeletingPathExtension, (unsigned long)counter];
+        if (fileName.pathExtension.length > 0) {
+            uniqueName = [uniqueName stringByAppendingPathExtension:fileName.pathExtension];
+        }
+        path = [ORKArchiveFilesDirectory stringByAppendingPathComponent:uniqueName];
+    }
+    return path;
+}
+
+- (BOOL)queue_archiveFileResult:(ORKFileResult *)fileResult stepIdentifier:(NSString *)stepIdentifier error:(NSError **)error {
+    NSURL *fileURL = fileResult.fileURL.URLByStandardizingPath;
+    NSDictionary<NSFileAttributeKey, id> *attributes = [[NSFileManager defaultManager] attributesOfItemAtPath:fileURL.path error:error];
+    if (attributes == nil) {
+        return NO;
+    }
+    NSArray *fileVersion = @[@(attributes.fileSize), attributes.fileModificationDate ? : [NSDate distantPast]];
+    if ([_latestFileEntries[fileURL].fileVersion isEqualToArray:fileVersion]) {
+        return YES;
+    }
+    
+    NSInputStream *inputStream = [NSInputStream inputStreamWithURL:fileURL];
+    [inputStream open];
+    if (inputStream.streamStatus == NSStreamStatusError) {
+        return ORKArchiveSetError(error, inputStream.streamError);
+    }
+    
+    NSMutableDictionary *manifestInfo = [NSMutableDictionary new];
+    manifestInfo[@"fileURL"] = fileResult.fileURL.absoluteString;
+    manifestInfo[@"identifier"] = fileResult.identifier;
+    manifestInfo[@"contentType"] = fileResult.contentType;
+    if (stepIdentifier.length > 0) {
+        manifestInfo[@"stepIdentifier"] = stepIdentifier;
+    }
+    
+    NSString *path = [self queue_uniquePathForFileName:fileURL.lastPathComponent];
+    BOOL store = ORKArchiveShouldStoreFileWithExtension(fileURL.pathExtension);
+    BOOL success = [self queue_beginEntryWithPath:path method:(store ? ORKArchiveMethodStored : ORKArchiveMethodDeflated) manifestInfo:manifestInfo error:error];
+    
+    NSMutableData *buffer = [NSMutableData dataWithLength:ORKArchiveChunkSize];
+    NSInteger bytesRead = 0;
+    while (success && (bytesRead = [inputStream read:buffer.mutableBytes maxLength:buffer.length]) > 0) {
+        success = [self queue_appendEntryBytes:buffer.bytes length:bytesRead error:error];
+    }
+    if (success && bytesRead < 0) {
+        success = ORKArchiveSetError(error, inputStream.streamError);
+    }
+    [inputStream close];
+    if (!success) {
+        return NO;
+    }
+    
+    ORKArchiveEntry *entry = _currentEntry;
+    entry.fileURL = fileURL;
+    entry.fileVersion = fileVersion;
+    if (![self queue_finishEntryWithError:error]) {
+        return NO;
+    }
+    _latestFileEntries[fileURL] = entry;
+    return YES;
+}
+
+- (BOOL)queue_writeTaskResult:(ORKTaskResult *)taskResult error:(NSError **)error {
+    if (![self queue_beginEntryWithPath:ORKArchiveResultPath method:ORKArchiveMethodDeflated manifestInfo:nil error:error]) {
+        return NO;
+    }
+    
+    ORKArchiveEntryOutputStream *stream = [[ORKArchiveEntryOutputStream alloc] initWithArchiveWriter:self];
+    [stream open];
+    BOOL success = [ORKJSONSerializer writeObject:taskResult toStream:stream error:error];
+    [stream close];
+    if (!success) {
+        // A failed write into the entry is reported with its own error
+        if (stream.streamError != nil) {
+            ORKArchiveSetError(error, stream.streamError);
+        }
+        return NO;
+    }
+    
+    return [self queue_finishEntryWithError:error];
+}
+
+- (BOOL)queue_writeManifestForTaskResult:(ORKTaskResult *)taskResult resultFileURLs:(NSSet<NSURL *> *)resultFileURLs error:(NSError **)error {
+    NSMutableArray *entries = [NSMutableArray arrayWithCapacity:_entries.count];
+    for (ORKArchiveEntry *entry in _entries) {
+        NSMutableDictionary *manifestEntry = [entry.manifestInfo mutableCopy];
+        manifestEntry[@"path"] = entry.path;
+        manifestEntry[@"size"] = @(entry.uncompressedSize);
+        if (entry.fileURL != nil) {
+            // Files of step results that were discarded, and earlier versions of rewritten files
+            BOOL abandoned = (![resultFileURLs containsObject:entry.fileURL] || _latestFileEntries[entry.fileURL] != entry);
+            manifestEntry[@"abandoned"] = @(abandoned);
+        }
+        [entries addObject:manifestEntry];
+    }
+    
+    NSMutableDictionary *manifest = [NSMutableDictionary new];
+    manifest[@"taskIdentifier"] = taskResult.identifier;
+    manifest[@"taskRunUUID"] = taskResult.taskRunUUID.UUIDString;
+    manifest[@"startDate"] = ORKStringFromDateISO8601(taskResult.startDate);
+    manifest[@"endDate"] = ORKStringFromDateISO8601(taskResult.endDate);
+    manifest[@"entries"] = entries;
+    
+    NSData *data = [NSJSONSerialization dataWithJSONObject:manifest options:NSJSONWritingPrettyPrinted error:error];
+    if (data == nil) {
+        return NO;
+    }
+    
+    return ([self queue_beginEntryWithPath:ORKArchiveManifestPath method:ORKArchiveMethodDeflated manifestInfo:nil error:error] &&
+            [self queue_appendEntryBytes:data.bytes length:data.length error:error] &&
+            [self queue_finishEntryWithError:error]);
+}
+
+- (BOOL)queue_beginEntryWithPath:(NSString *)path method:(uint16_t)method manifestInfo:(NSDictionary *)manifestInfo error:(NSError **)error {
+    NSAssert(_currentEntry == nil, @"Previous entry was not finished");
+    if (![self queue_openIfNeededWithError:error]) {
+        return NO;
+    }
+    
+    ORKArchiveEntry *entry = [ORKArchiveEntry new];
+    entry.path = path;
+    entry.method = method;
+    entry.offset = _offset;
+    entry.manifestInfo = manifestInfo ? : @{};
+    
+    if (method == ORKArchiveMethodDeflated) {
+        memset(&_zstream, 0, sizeof(_zstream));
+        // Negative window bits produce the raw deflate stream that ZIP entries contain
+        if (deflateInit2(&_zstream, Z_DEFAULT_COMPRESSION, Z_DEFLATED, -MAX_WBITS, 8, Z_DEFAULT_STRATEGY) != Z_OK) {
+            return ORKArchiveSetError(error, ORKArchiveError(@"Could not initialize compression"));
+        }
+    }
+    CC_SHA256_Init(&_sha256);
+    entry.crc = (uint32_t)crc32(0L, Z_NULL, 0);
+    _currentEntry = entry;
+    
+    // The local header is written with zero sizes and checksum, and patched by queue_finishEntryWithError:
+    return [self queue_writeData:[self localHeaderForEntry:entry] error:error];
+}
+
+- (BOOL)queue_appendEntryBytes:(const void *)bytes length:(NSUInteger)length error:(NSError **)error {
+    ORKArchiveEntry *entry = _currentEntry;
+    NSAssert(entry != nil, @"No archive entry is open");
+    
+    entry.crc = (uint32_t)crc32(entry.crc, bytes, (uInt)length);
+    CC_SHA256_Update(&_sha256, bytes, (CC_LONG)length);
+    entry.uncompressedSize += length;
+    
+    if (entry.method == ORKArchiveMethodDeflated) {
+        return [self queue_deflateBytes:bytes length:length finish:NO error:error];
+    }
+    entry.compressedSize += length;
+    return [self queue_writeBytes:bytes length:length error:error];
+}
+
+- (BOOL)queue_deflateBytes:(const void *)bytes length:(NSUInteger)length finish:(BOOL)finish error:(NSError **)error {
+    _zstream.next_in = (Bytef *)bytes;
+    _zstream.avail_in = (uInt)length;
+    int status;
+    do {
+        _zstream.next_out = _deflateBuffer.mutableBytes;
+        _zstream.avail_out = (uInt)_deflateBuffer.length;
+        status = deflate(&_zstream, finish ? Z_FINISH : Z_NO_FLUSH);
+        if (status == Z_STREAM_ERROR) {
+            return ORKArchiveSetError(error, ORKArchiveError(@"Compression failed"));
+        }
+        NSUInteger produced = _deflateBuffer.length - _zstream.avail_out;
+        if (produced > 0) {
+            if (![self queue_writeBytes:_deflateBuffer.bytes length:produced error:error]) {
+                return NO;
+            }
+            _currentEntry.compressedSize += produced;
+        }
+    } while (_zstream.avail_out == 0 || (finish && status != Z_STREAM_END));
+    return YES;
+}
+
+- (BOOL)queue_finishEntryWithError:(NSError **)error {
+    ORKArchiveEntry *entry = _currentEntry;
+    if (entry.method == ORKArchiveMethodDeflated) {
+        if (![self queue_deflateBytes:NULL length:0 finish:YES error:error]) {
+            return NO;
+        }
+        deflateEnd(&_zstream);
+    }
+    _currentEntry = nil;
+    
+    if (entry.compressedSize > UINT32_MAX || entry.uncompressedSize > UINT32_MAX) {
+        return ORKArchiveSetError(error, ORKArchiveError(@"Archive exceeds the 4 GB ZIP limit"));
+    }
+    
+    unsigned char digest[CC_SHA256_DIGEST_LENGTH];
+    CC_SHA256_Final(digest, &_sha256);
+    NSMutableString *hexString = [NSMutableString stringWithCapacity:CC_SHA256_DIGEST_LENGTH * 2];
+    for (NSInteger i = 0; i < CC_SHA256_DIGEST_LENGTH; i++) {
+        [hexString appendFormat:@"%02x", digest[i]];
+    }
+    NSMutableDictionary *manifestInfo = [entry.manifestInfo mutableCopy];
+    manifestInfo[@"sha256"] = hexString;
+    entry.manifestInfo = manifestInfo;
+    
+    // Patch the checksum and sizes into the local header, which start 14 bytes in
+    NSMutableData *patch = [NSMutableData dataWithCapacity:12];
+    ORKArchiveAppendUInt32(patch, entry.crc);
+    ORKArchiveAppendUInt32(patch, (uint32_t)entry.compressedSize);
+    ORKArchiveAppendUInt32(patch, (uint32_t)entry.uncompressedSize);
+    if (![self queue_writeBytes:patch.bytes length:patch.length atOffset:entry.offset + 14 error:error]) {
+        return NO;
+    }
+    
+    [_entries addObject:entry];
+    [_entryPaths addObject:entry.path];
+    return YES;
+}
+
+- (BOOL)queue_closeWithError:(NSError **)error {
+    if (![self queue_openIfNeededWithError:error]) {
+        return NO;
+    }
+    
+    unsigned long long centralDirectoryOffset = _offset;
+    if (_entries.count > UINT16_MAX) {
+        return ORKArchiveSetError(error, ORKArchiveError(@"Archive exceeds the ZIP entry limit"));
+    }
+    NSMutableData *centralDirectory = [NSMutableData new];
+    for (ORKArchiveEntry *entry in _entries) {
+        if (entry.offset > UINT32_MAX) {
+            return ORKArchiveSetError(error, ORKArchiveError(@"Archive exceeds the 4 GB ZIP limit"));
+        }
+        NSData *name = [entry.path dataUsingEncoding:NSUTF8StringEncoding];
+        ORKArchiveAppendUInt32(centralDirectory, 0x02014b50);
+        ORKArchiveAppendUInt16(centralDirectory, ORKArchiveVersion);
+        ORKArchiveAppendUInt16(centralDirectory, ORKArchiveVersion);
+        ORKArchiveAppendUInt16(centralDirectory, ORKArchiveFlagUTF8);
+        ORKArchiveAppendUInt16(centralDirectory, entry.method);
+        ORKArchiveAppendUInt16(centralDirectory, _dosTime);
+        ORKArchiveAppendUInt16(centralDirectory, _dosDate);
+        ORKArchiveAppendUInt32(centralDirectory, entry.crc);
+        ORKArchiveAppendUInt32(centralDirectory, (uint32_t)entry.compressedSize);
+        ORKArchiveAppendUInt32(centralDirectory, (uint32_t)entry.uncompressedSize);
+        ORKArchiveAppendUInt16(centralDirectory, (uint16_t)name.length);
+        ORKArchiveAppendUInt16(centralDirectory, 0);    // extra field length
+        ORKArchiveAppendUInt16(centralDirectory, 0);    // comment length
+        ORKArchiveAppendUInt16(centralDirectory, 0);    // disk number
+        ORKArchiveAppendUInt16(centralDirectory, 0);    // internal attributes
+        ORKArchiveAppendUInt32(centralDirectory, 0);    // external attributes
+        ORKArchiveAppendUInt32(centralDirectory, (uint32_t)entry.offset);
+        [centralDirectory appendData:name];
+    }
+    if (centralDirectoryOffset > UINT32_MAX || centralDirectory.length > UINT32_MAX) {
+        return ORKArchiveSetError(error, ORKArchiveError(@"Archive exceeds the 4 GB ZIP limit"));
+    }
+    
+    NSMutableData *endRecord = [NSMutableData new];
+    ORKArchiveAppendUInt32(endRecord, 0x06054b50);
+    ORKArchiveAppendUInt16(endRecord, 0);    // disk number
+    ORKArchiveAppendUInt16(endRecord, 0);    // disk with central directory
+    ORKArchiveAppendUInt16(endRecord, (uint16_t)_entries.count);
+    ORKArchiveAppendUInt16(endRecord, (uint16_t)_entries.count);
+    ORKArchiveAppendUInt32(endRecord, (uint32_t)centralDirectory.length);
+    ORKArchiveAppendUInt32(endRecord, (uint32_t)centralDirectoryOffset);
+    ORKArchiveAppendUInt16(endRecord, 0);    // comment length
+    if (![self queue_writeData:centralDirectory error:error] || ![self queue_writeData:endRecord error:error]) {
+        return NO;
+    }
+    
+    BOOL synchronized = (fsync(_fileDescriptor) == 0);
+    NSError *syncError = synchronized ? nil : ORKArchivePOSIXError(_archiveURL);
+    close(_fileDescriptor);
+    _fileDescriptor = -1;
+    if (!synchronized) {
+        return ORKArchiveSetError(error, syncError);
+    }
+    _closed = YES;
+    return YES;
+}
+
+- (NSData *)localHeaderForEntry:(ORKArchiveEntry *)entry {
+    NSData *name = [entry.path dataUsingEncoding:NSUTF8StringEncoding];
+    NSMutableData *header = [NSMutableData dataWithCapacity:30 + name.length];
+    ORKArchiveAppendUInt32(header, 0x04034b50);
+    ORKArchiveAppendUInt16(header, ORKArchiveVersion);
+    ORKArchiveAppendUInt16(header, ORKArchiveFlagUTF8);
+    ORKArchiveAppendUInt16(header, entry.method);
+    ORKArchiveAppendUInt16(header, _dosTime);
+    ORKArchiveAppendUInt16(header, _dosDate);
+    ORKArchiveAppendUInt32(header, 0);    // crc-32
+    ORKArchiveAppendUInt32(header, 0);    // compressed size
+    ORKArchiveAppendUInt32(header, 0);    // uncompressed size
+    ORKArchiveAppendUInt16(header, (uint16_t)name.length);
+    ORKArchiveAppendUInt16(header, 0);    // extra field length
+    [header appendData:name];
+    return header;
+}
+
+@end
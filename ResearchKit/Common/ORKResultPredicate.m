@@ -30,6 +30,7 @@
 
 
 #import "ORKResultPredicate.h"
+#import "ORKResultPredicate_Private.h"
 
 #import "ORKHelpers_Internal.h"
 
@@ -172,6 +173,133 @@ NSString *const ORKResultPredicateTaskIdentifierVariableName = @"ORK_TASK_IDENTI
 @end
 
 
+static BOOL ORKExpressionIsIdentifierKeyPath(NSExpression *expression) {
+    NSString *keyPath = nil;
+    if (expression.expressionType == NSKeyPathExpressionType) {
+        keyPath = expression.keyPath;
+    } else if (expression.expressionType == NSFunctionExpressionType && [expression.function isEqualToString:@"valueForKeyPath:"]) {
+        // `$x.identifier` inside a subquery is parsed as a key path lookup on the variable
+        NSExpression *argument = expression.arguments.firstObject;
+        if (argument.expressionType == NSConstantValueExpressionType && [argument.constantValue isKindOfClass:[NSString class]]) {
+            keyPath = argument.constantValue;
+        }
+    }
+    return [keyPath isEqualToString:@"identifier"] || [keyPath hasSuffix:@".identifier"];
+}
+
+static BOOL ORKExpressionIsIdentifierValue(NSExpression *expression) {
+    switch (expression.expressionType) {
+        case NSConstantValueExpressionType:
+        case NSAggregateExpressionType:
+            return YES;
+        case NSVariableExpressionType:
+            // Only the task identifier is substituted at evaluation time
+            return [expression.variable isEqualToString:ORKResultPredicateTaskIdentifierVariableName];
+        default:
+            return NO;
+    }
+}
+
+static void ORKCollectConstantStrings(id value, NSMutableSet<NSString *> *strings) {
+    if ([value isKindOfClass:[NSString class]]) {
+        [strings addObject:value];
+    } else if ([value isKindOfClass:[NSArray class]] || [value isKindOfClass:[NSSet class]]) {
+        for (id element in value) {
+            if ([element isKindOfClass:[NSExpression class]]) {
+                if (((NSExpression *)element).expressionType == NSConstantValueExpressionType) {
+                    ORKCollectConstantStrings(((NSExpression *)element).constantValue, strings);
+                }
+            } else {
+                ORKCollectConstantStrings(element, strings);
+            }
+        }
+    }
+}
+
+static BOOL ORKCollectIdentifiersFromPredicate(NSPredicate *predicate, NSMutableSet<NSString *> *identifiers);
+
+static BOOL ORKCollectIdentifiersFromExpression(NSExpression *expression, NSMutableSet<NSString *> *identifiers) {
+    switch (expression.expressionType) {
+        case NSConstantValueExpressionType:
+            ORKCollectConstantStrings(expression.constantValue, identifiers);
+            return YES;
+        case NSEvaluatedObjectExpressionType:
+        case NSVariableExpressionType:
+        case NSKeyPathExpressionType:
+        case NSAnyKeyExpressionType:
+            return YES;
+        case NSAggregateExpressionType:
+            for (NSExpression *element in expression.collection) {
+                if (!ORKCollectIdentifiersFromExpression(element, identifiers)) {
+                    return NO;
+                }
+            }
+            return YES;
+        case NSFunctionExpressionType:
+            if (!ORKCollectIdentifiersFromExpression(expression.operand, identifiers)) {
+                return NO;
+            }
+            for (NSExpression *argument in expression.arguments) {
+                if (!ORKCollectIdentifiersFromExpression(argument, identifiers)) {
+                    return NO;
+                }
+            }
+            return YES;
+        case NSSubqueryExpressionType:
+            return (ORKCollectIdentifiersFromExpression(expression.collection, identifiers)
+                    && ORKCollectIdentifiersFromPredicate(expression.predicate, identifiers));
+        case NSUnionSetExpressionType:
+        case NSIntersectSetExpressionType:
+        case NSMinusSetExpressionType:
+            return (ORKCollectIdentifiersFromExpression(expression.leftExpression, identifiers)
+                    && ORKCollectIdentifiersFromExpression(expression.rightExpression, identifiers));
+        case NSConditionalExpressionType:
+            return (ORKCollectIdentifiersFromPredicate(expression.predicate, identifiers)
+                    && ORKCollectIdentifiersFromExpression(expression.trueExpression, identifiers)
+                    && ORKCollectIdentifiersFromExpression(expression.falseExpression, identifiers));
+        default:
+            // Block expressions can read anything
+            return NO;
+    }
+}
+
+static BOOL ORKCollectIdentifiersFromPredicate(NSPredicate *predicate, NSMutableSet<NSString *> *identifiers) {
+    if ([predicate isKindOfClass:[NSCompoundPredicate class]]) {
+        for (NSPredicate *subpredicate in ((NSCompoundPredicate *)predicate).subpredicates) {
+            if (!ORKCollectIdentifiersFromPredicate(subpredicate, identifiers)) {
+                return NO;
+            }
+        }
+        return YES;
+    }
+    
+    if ([predicate isKindOfClass:[NSComparisonPredicate class]]) {
+        NSComparisonPredicate *comparison = (NSComparisonPredicate *)predicate;
+        if (comparison.predicateOperatorType == NSCustomSelectorPredicateOperatorType) {
+            return NO;
+        }
+        NSExpression *left = comparison.leftExpression;
+        NSExpression *right = comparison.rightExpression;
+        BOOL leftIsIdentifier = ORKExpressionIsIdentifierKeyPath(left);
+        BOOL rightIsIdentifier = ORKExpressionIsIdentifierKeyPath(right);
+        if (leftIsIdentifier || rightIsIdentifier) {
+            BOOL matchesExactly = (comparison.predicateOperatorType == NSEqualToPredicateOperatorType
+                                   || comparison.predicateOperatorType == NSInPredicateOperatorType);
+            NSExpression *value = leftIsIdentifier ? right : left;
+            if (!matchesExactly || !ORKExpressionIsIdentifierValue(value)) {
+                return NO;
+            }
+        }
+        return (ORKCollectIdentifiersFromExpression(left, identifiers)
+                && ORKCollectIdentifiersFromExpression(right, identifiers));
+    }
+    
+    // TRUEPREDICATE and FALSEPREDICATE do not depend on any result; block predicates cannot be inspected
+    return ([predicate isEqual:[NSPredicate predicateWithValue:YES]]
+            || [predicate isEqual:[NSPredicate predicateWithValue:NO]]);
+}
+
+
 @implementation ORKResultPredicate
 
 + (instancetype)new {
@@ -483,4 +611,14 @@ return [self predicateMatchingResultSelector:resultSelector
                  subPredicateFormatArgumentArray:@[ @(didConsent) ]];
 }
 
++ (NSSet<NSString *> *)resultIdentifiersReferencedByPredicate:(NSPredicate *)predicate {
+    ORKThrowInvalidArgumentExceptionIfNil(predicate);
+    
+    NSMutableSet<NSString *> *identifiers = [NSMutableSet new];
+    if (!ORKCollectIdentifiersFromPredicate(predicate, identifiers)) {
+        return nil;
+    }
+    return [identifiers copy];
+}
+
 @end
@@ -0,0 +1,58 @@
+/*
+ Copyright (c) 2026, CareEvolution, Inc.
+ 
+ Redistribution and use in source and binary forms, with or without modification,
+ are permitted provided that the following conditions are met:
+ 
+ 1.  Redistributions of source code must retain the above copyright notice, this
+ list of conditions and the following disclaimer.
+ 
+ 2.  Redistributions in binary form must reproduce the above copyright notice,
+ this list of conditions and the following disclaimer in the documentation and/or
+ other materials provided with the distribution.
+ 
+ 3.  Neither the name of the copyright holder(s) nor the names of any contributors
+ may be used to endorse or promote products derived from this software without
+ specific prior written permission. No license is granted to the trademarks of
+ the copyright holders even if such marks are included in this software.
+ 
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE
+ FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#import <ResearchKit/ORKResultPredicate.h>
+
+
+NS_ASSUME_NONNULL_BEGIN
+
+@interface ORKResultPredicate ()
+
+/**
+ Returns the result identifiers a predicate can match, or `nil` if they cannot be determined.
+ 
+ The identifiers are the constant values the predicate compares against `identifier` key paths,
+ as produced by the `ORKResultPredicate` factory methods. Callers can use them to skip evaluating
+ a predicate when none of the results it refers to have changed. The returned set may also contain
+ other constant strings from the predicate, which only makes it more conservative.
+ 
+ `nil` is returned for block-based predicates and for predicates that compare identifiers with
+ anything other than equality or membership against constants.
+ 
+ @param predicate   The predicate to analyze.
+ 
+ @return The set of identifiers the predicate refers to, or `nil`.
+ */
++ (nullable NSSet<NSString *> *)resultIdentifiersReferencedByPredicate:(NSPredicate *)predicate;
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -30,6 +30,7 @@
 
 
 #import <ResearchKit/ORKResult.h>
+#import <ResearchKit/ORKStroke.h>
 
 
 NS_ASSUME_NONNULL_BEGIN
@@ -48,11 +49,27 @@ ORK_CLASS_AVAILABLE
  */
 @property (nonatomic, nullable) UIImage *signatureImage;
 
+/**
+ The PNG encoding of the signature image.
+ 
+ The image is encoded once when it is set. The result archives these bytes, and a consent review
+ passes them on to the consent signature for the document.
+ */
+@property (nonatomic, copy, readonly, nullable) NSData *signatureImageData;
+
 /**
  The bezier path components used to create the signature image.
  */
 @property (nonatomic, copy, nullable) NSArray <UIBezierPath *> *signaturePath;
 
+/**
+ The touch samples of each stroke of the signature, with timing and force.
+ 
+ Strokes are archived with the compact encoding of `+[ORKStroke dataWithStrokes:]`, which keeps
+ them exactly, so a decoded result is equal to the archived one.
+ */
+@property (nonatomic, copy, nullable) NSArray <ORKStroke *> *strokes;
+
 @end
 
 NS_ASSUME_NONNULL_END
@@ -39,25 +39,57 @@
 
 - (instancetype)initWithSignatureImage:(UIImage *)signatureImage
                          signaturePath:(NSArray <UIBezierPath *> *)signaturePath {
+    return [self initWithSignatureImage:signatureImage signaturePath:signaturePath strokes:nil];
+}
+
+- (instancetype)initWithSignatureImage:(UIImage *)signatureImage
+                         signaturePath:(NSArray <UIBezierPath *> *)signaturePath
+                               strokes:(NSArray <ORKStroke *> *)strokes {
     self = [super init];
     if (self) {
         _signatureImage = [signatureImage copy];
+        _signatureImageData = signatureImage ? ORKImagePNGRepresentation(signatureImage) : nil;
         _signaturePath = ORKArrayCopyObjects(signaturePath);
+        _strokes = [strokes copy];
     }
     return self;
 }
 
+- (void)setSignatureImage:(UIImage *)signatureImage {
+    _signatureImageData = signatureImage ? ORKImagePNGRepresentation(signatureImage) : nil;
+    _signatureImage = [signatureImage copy];
+}
+
 - (void)encodeWithCoder:(NSCoder *)aCoder {
     [super encodeWithCoder:aCoder];
+    ORK_ENCODE_OBJ(aCoder, signatureImageData);
+    if (_signatureImage) {
+        [aCoder encodeDouble:_signatureImage.scale forKey:@"signatureImageScale"];
+    }
+    // Also written under the legacy key, so versions that only read the image can decode this archive
     ORK_ENCODE_IMAGE(aCoder, signatureImage);
     ORK_ENCODE_OBJ(aCoder, signaturePath);
+    if (_strokes) {
+        [aCoder encodeObject:[ORKStroke dataWithStrokes:_strokes] forKey:@ORK_STRINGIFY(strokes)];
+    }
 }
 
 - (instancetype)initWithCoder:(NSCoder *)aDecoder {
     self = [super initWithCoder:aDecoder];
     if (self) {
-        ORK_DECODE_IMAGE(aDecoder, signatureImage);
+        ORK_DECODE_OBJ_CLASS(aDecoder, signatureImageData, NSData);
+        if (_signatureImageData) {
+            _signatureImage = [UIImage imageWithData:_signatureImageData scale:[aDecoder decodeDoubleForKey:@"signatureImageScale"] ? : 1];
+        } else {
+            // Results archived before the PNG bytes were kept
+            ORK_DECODE_IMAGE(aDecoder, signatureImage);
+            _signatureImageData = _signatureImage ? ORKImagePNGRepresentation(_signatureImage) : nil;
+        }
         ORK_DECODE_OBJ_ARRAY(aDecoder, signaturePath, UIBezierPath);
+        NSData *strokeData = [aDecoder decodeObjectOfClass:[NSData class] forKey:@ORK_STRINGIFY(strokes)];
+        if (strokeData) {
+            _strokes = [ORKStroke strokesWithData:strokeData error:NULL];
+        }
     }
     return self;
 }
@@ -67,7 +99,7 @@
 }
 
 - (NSUInteger)hash {
-    return super.hash ^ self.signatureImage.hash ^ self.signaturePath.hash;
+    return super.hash ^ self.signatureImageData.hash ^ self.signaturePath.hash ^ self.strokes.hash;
 }
 
 - (BOOL)isEqual:(id)object {
@@ -75,14 +107,17 @@
     
     __typeof(self) castObject = object;
     return (isParentSame &&
-            ORKEqualObjects(self.signatureImage, castObject.signatureImage) &&
-            ORKEqualObjects(self.signaturePath, castObject.signaturePath));
+            ORKEqualObjects(self.signatureImageData, castObject.signatureImageData) &&
+            ORKEqualObjects(self.signaturePath, castObject.signaturePath) &&
+            ORKEqualObjects(self.strokes, castObject.strokes));
 }
 
 - (instancetype)copyWithZone:(NSZone *)zone {
     ORKSignatureResult *result = [super copyWithZone:zone];
     result->_signatureImage = [_signatureImage copy];
+    result->_signatureImageData = _signatureImageData;
     result->_signaturePath = ORKArrayCopyObjects(_signaturePath);
+    result->_strokes = [_strokes copy];
     return result;
 }
 
@@ -39,6 +39,10 @@ NS_ASSUME_NONNULL_BEGIN
 - (instancetype)initWithSignatureImage:(UIImage *)signatureImage
                          signaturePath:(NSArray <UIBezierPath *> *)signaturePath;
 
+- (instancetype)initWithSignatureImage:(UIImage *)signatureImage
+                         signaturePath:(NSArray <UIBezierPath *> *)signaturePath
+                               strokes:(nullable NSArray <ORKStroke *> *)strokes;
+
 @end
 
 NS_ASSUME_NONNULL_END
@@ -206,6 +206,7 @@
 @property (nonatomic, strong) ORKConsentSigningView *signingView;
 @property (nonatomic, strong) ORKNavigationContainerView *navigationFooterView;
 @property (nonatomic, strong) NSArray <UIBezierPath *> *originalPath;
+@property (nonatomic, strong) NSArray <ORKStroke *> *originalStrokes;
 
 @end
 
@@ -221,6 +222,7 @@
             [[(ORKStepResult *)result results] enumerateObjectsUsingBlock:^(ORKResult * _Nonnull obj, NSUInteger idx, BOOL * _Nonnull stop) {
                 if ([obj isKindOfClass:[ORKSignatureResult class]]) {
                     _originalPath = [(ORKSignatureResult*)obj signaturePath];
+                    _originalStrokes = [(ORKSignatureResult*)obj strokes];
                     *stop = YES;
                 }
             }];
@@ -235,6 +237,7 @@
     
     // set the original path and update state
     self.signatureView.signaturePath = self.originalPath;
+    self.signatureView.strokes = self.originalStrokes;
     [self updateButtonStates];
 }
 
@@ -243,7 +246,8 @@
     
     if (self.signatureView.signatureExists) {
         ORKSignatureResult *sigResult = [[ORKSignatureResult alloc] initWithSignatureImage:self.signatureView.signatureImage
-                                                                             signaturePath:self.signatureView.signaturePath];
+                                                                             signaturePath:self.signatureView.signaturePath
+                                                                                   strokes:self.signatureView.strokes];
         parentResult.results = @[sigResult];
     }
     
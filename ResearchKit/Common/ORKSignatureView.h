@@ -36,6 +36,7 @@
 NS_ASSUME_NONNULL_BEGIN
 
 @class ORKSignatureView;
+@class ORKStroke;
 
 @protocol ORKSignatureViewDelegate <NSObject>
 
@@ -65,6 +66,9 @@ NS_ASSUME_NONNULL_BEGIN
 @property (nonatomic, strong, nullable) UIGestureRecognizer *signatureGestureRecognizer;
 @property (nonatomic, copy, nullable) NSArray <UIBezierPath *> *signaturePath;
 
+/// The raw touch samples of each stroke, in the order they were drawn.
+@property (nonatomic, copy, nullable) NSArray <ORKStroke *> *strokes;
+
 - (UIImage *)signatureImage;
 
 @property (nonatomic, readonly) BOOL signatureExists;
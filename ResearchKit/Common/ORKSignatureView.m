@@ -33,6 +33,8 @@
 #import "ORKSignatureView.h"
 
 #import "ORKSelectionTitleLabel.h"
+#import "ORKStroke.h"
+#import "ORKStrokeCapture.h"
 
 #import "ORKHelpers_Internal.h"
 #import "ORKSkin.h"
@@ -126,6 +128,16 @@ static const CGFloat LineWidthStepValue = 0.25f;
 @implementation ORKSignatureView {
     NSLayoutConstraint *_heightConstraint;
     NSLayoutConstraint *_widthConstraint;
+    
+    // Rasterized signature, kept until the strokes, color or size change.
+    UIImage *_signatureImage;
+    
+    // Committed paths, rasterized once; drawRect: only strokes the path in progress on top.
+    ORKStrokeCanvas *_canvas;
+    
+    ORKStrokeBuilder *_strokeBuilder;
+    NSMutableArray<ORKStroke *> *_strokes;
+    BOOL _currentStrokeCommitted; // Whether any path of the stroke in progress was committed
 }
 
 + (void)initialize {
@@ -193,11 +205,19 @@ static const CGFloat LineWidthStepValue = 0.25f;
 }
 
 - (void)setBounds:(CGRect)bounds {
+    if (!CGSizeEqualToSize(bounds.size, self.bounds.size)) {
+        _signatureImage = nil;
+        _canvas = nil;
+    }
     [super setBounds:bounds];
     [self setNeedsDisplay];
 }
 
 - (void)setFrame:(CGRect)frame {
+    if (!CGSizeEqualToSize(frame.size, self.frame.size)) {
+        _signatureImage = nil;
+        _canvas = nil;
+    }
     [super setFrame:frame];
     [self setNeedsDisplay];
 }
@@ -219,6 +239,13 @@ static const CGFloat LineWidthStepValue = 0.25f;
     }
 }
 
+- (void)setLineColor:(UIColor *)lineColor {
+    _lineColor = lineColor;
+    _signatureImage = nil;
+    _canvas = nil;
+    [self setNeedsDisplay];
+}
+
 - (UIColor *)lineColor {
     if (_lineColor == nil) {
         _lineColor = ORKColor(ORKSignatureColorKey);
@@ -226,6 +253,17 @@ static const CGFloat LineWidthStepValue = 0.25f;
     return _lineColor;
 }
 
+- (ORKStrokeCanvas *)canvas {
+    if (_canvas == nil) {
+        CGFloat scale = self.window.screen.scale ? : [UIScreen mainScreen].scale;
+        _canvas = [[ORKStrokeCanvas alloc] initWithSize:self.bounds.size scale:scale];
+        for (UIBezierPath *path in self.pathArray) {
+            [_canvas strokePath:path color:self.lineColor];
+        }
+    }
+    return _canvas;
+}
+
 - (NSMutableArray *)pathArray {
     if (_pathArray == nil) {
         _pathArray = [NSMutableArray new];
@@ -293,6 +331,10 @@ static const CGFloat LineWidthStepValue = 0.25f;
 - (void)gestureTouchesBegan:(NSSet *)touches withEvent:(UIEvent *)event {
     UITouch *touch = [touches anyObject];
     
+    // A cancelled touch never reports an end; keep its stroke if any of its paths were committed.
+    [self finishStroke];
+    [self.strokeBuilder addSamplesForTouch:touch event:event inView:self];
+    
     self.currentPath = [self pathWithRoundedStyle];
     
     // Trigger full redraw - whether there's a path has changed
@@ -326,6 +368,7 @@ static CGPoint mmid_Point(CGPoint p1, CGPoint p2) {
 
 - (void)gestureTouchesMoved:(NSSet *)touches withEvent:(UIEvent *)event {
     UITouch *touch = [touches anyObject];
+    [self.strokeBuilder addSamplesForTouch:touch event:event inView:self];
     
     CGPoint point = [touch locationInView:self];
     
@@ -416,7 +459,28 @@ static CGPoint mmid_Point(CGPoint p1, CGPoint p2) {
 }
 
 - (void)gestureTouchesEnded:(NSSet *)touches withEvent:(UIEvent *)event {
+    [self.strokeBuilder addSamplesForTouch:[touches anyObject] event:event inView:self];
     [self commitCurrentPath];
+    [self finishStroke];
+}
+
+- (ORKStrokeBuilder *)strokeBuilder {
+    if (_strokeBuilder == nil) {
+        _strokeBuilder = [ORKStrokeBuilder new];
+    }
+    return _strokeBuilder;
+}
+
+- (void)finishStroke {
+    // Strokes whose paths were all discarded for being empty drew nothing, so they are dropped too
+    ORKStroke *stroke = [_strokeBuilder finishStroke];
+    if (stroke && _currentStrokeCommitted) {
+        if (_strokes == nil) {
+            _strokes = [NSMutableArray new];
+        }
+        [_strokes addObject:stroke];
+    }
+    _currentStrokeCommitted = NO;
 }
 
 - (void)commitCurrentPath {
@@ -426,6 +490,9 @@ static CGPoint mmid_Point(CGPoint p1, CGPoint p2) {
     }
     
     [self.pathArray addObject:self.currentPath];
+    [_canvas strokePath:self.currentPath color:self.lineColor];
+    _currentStrokeCommitted = YES;
+    _signatureImage = nil;
     
     [self.delegate signatureViewDidEditImage:self];
 }
@@ -434,9 +501,8 @@ static CGPoint mmid_Point(CGPoint p1, CGPoint p2) {
     [[UIColor whiteColor] setFill];
     CGContextFillRect(UIGraphicsGetCurrentContext(), rect);
     
-    for (UIBezierPath *path in self.pathArray) {
-        [self.lineColor setStroke];
-        [path stroke];
+    if (!CGRectIsEmpty(self.bounds)) {
+        [self.canvas drawInCurrentContext];
     }
     
     [self.lineColor setStroke];
@@ -450,11 +516,17 @@ static CGPoint mmid_Point(CGPoint p1, CGPoint p2) {
 - (void)setSignaturePath:(NSArray<UIBezierPath *> *)signaturePath {
     if (signaturePath) {
         _pathArray = [signaturePath mutableCopy];
+        _signatureImage = nil;
+        _canvas = nil;
         [self setNeedsDisplay];
     }
 }
 
 - (UIImage *)signatureImage {
+    if (_signatureImage) {
+        return _signatureImage;
+    }
+    
     CGSize imageContextSize;
     imageContextSize = (self.bounds.size.width == 0 || self.bounds.size.height == 0) ? CGSizeMake(200, 200) :
                         self.bounds.size;
@@ -465,10 +537,18 @@ static CGPoint mmid_Point(CGPoint p1, CGPoint p2) {
         [path stroke];
     }
     
-    UIImage *image = UIGraphicsGetImageFromCurrentImageContext();
+    _signatureImage = UIGraphicsGetImageFromCurrentImageContext();
     UIGraphicsEndImageContext();
     
-    return image;
+    return _signatureImage;
+}
+
+- (NSArray<ORKStroke *> *)strokes {
+    return [_strokes copy];
+}
+
+- (void)setStrokes:(NSArray<ORKStroke *> *)strokes {
+    _strokes = [strokes mutableCopy];
 }
 
 - (BOOL)signatureExists {
@@ -482,6 +562,9 @@ static CGPoint mmid_Point(CGPoint p1, CGPoint p2) {
         }
         
         [self.pathArray removeAllObjects];
+        [_strokes removeAllObjects];
+        [_canvas clear];
+        _signatureImage = nil;
         [self setNeedsDisplayInRect:self.bounds];
     }
 }
@@ -32,7 +32,7 @@
 #import <ResearchKit/ORKStepNavigationRule.h>
 
 
-// This 'Private' header is needed because ORKESerialization uses ORKPredicateStepNavigationRule's
+// This 'Private' header is needed because ORKJSONSerializer uses ORKPredicateStepNavigationRule's
 // internal initializer in order to avoid argument array validation.
 NS_ASSUME_NONNULL_BEGIN
 
@@ -461,6 +461,9 @@ static const CGFloat iPadStepTitleLabelFontSize = 50.0;
     return supportedOrientations;
 }
 
++ (void)prefetchResourcesForStep:(ORKStep *)step {
+}
+
 - (BOOL)isBeingReviewed {
     return _parentReviewStep != nil;
 }
@@ -65,6 +65,11 @@ NS_ASSUME_NONNULL_BEGIN
 
 + (UIInterfaceOrientationMask)supportedInterfaceOrientations;
 
+// Loads resources that are slow to prepare when the step is presented, such as bundled audio files, so that
+// presenting `step` later finds them cached. Called on a background queue while the preceding step is on screen.
+// The default implementation does nothing.
++ (void)prefetchResourcesForStep:(ORKStep *)step;
+
 // this property is set to `YES` when the step is part of a standalone review step. If set to `YES it will prevent any user input that might change the step result.
 @property (nonatomic, readonly) BOOL readOnlyMode;
 
@@ -0,0 +1,111 @@
+/*
+ Copyright (c) 2026, CareEvolution, Inc.
+ 
+ Redistribution and use in source and binary forms, with or without modification,
+ are permitted provided that the following conditions are met:
+ 
+ 1.  Redistributions of source code must retain the above copyright notice, this
+ list of conditions and the following disclaimer.
+ 
+ 2.  Redistributions in binary form must reproduce the above copyright notice,
+ this list of conditions and the following disclaimer in the documentation and/or
+ other materials provided with the distribution.
+ 
+ 3.  Neither the name of the copyright holder(s) nor the names of any contributors
+ may be used to endorse or promote products derived from this software without
+ specific prior written permission. No license is granted to the trademarks of
+ the copyright holders even if such marks are included in this software.
+ 
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE
+ FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+@import UIKit;
+#import <ResearchKit/ORKDefines.h>
+
+
+NS_ASSUME_NONNULL_BEGIN
+
+/**
+ `ORKStrokePoint` is a single touch sample of a drawn stroke.
+ */
+typedef struct {
+    /// The location of the touch, in the coordinate space of the view that captured it.
+    CGPoint location;
+    
+    /// The time of the sample, in seconds since system startup (the `UITouch` timestamp).
+    NSTimeInterval timestamp;
+    
+    /// The force of the touch, or 0 when the device does not report force.
+    CGFloat force;
+} ORKStrokePoint ORK_AVAILABLE_DECL;
+
+/**
+ The `ORKStroke` class represents one continuous stroke of a signature or freehand drawing, from
+ touch down to touch up, as a compact array of samples.
+ 
+ Strokes keep the touch timing and force, so they can be used for kinematic analysis as well as
+ for redrawing. Samples are rounded to the precision of `+dataWithStrokes:` when the stroke is
+ created, so a stroke decoded from that encoding is equal to the original. Use `+dataWithStrokes:`
+ to get a binary encoding that is much smaller than a rendered image of the same drawing.
+ */
+ORK_CLASS_AVAILABLE
+@interface ORKStroke : NSObject <NSCopying>
+
++ (instancetype)new NS_UNAVAILABLE;
+- (instancetype)init NS_UNAVAILABLE;
+
+/**
+ Returns a stroke containing a copy of the specified samples, rounded to 1/8 point, 1 millisecond,
+ and 1/64 force.
+ 
+ @param points  A C array of samples, in the order they were captured.
+ @param count   The number of samples in `points`.
+ */
+- (instancetype)initWithPoints:(const ORKStrokePoint *)points count:(NSUInteger)count NS_DESIGNATED_INITIALIZER;
+
+/// The number of samples in the stroke.
+@property (nonatomic, readonly) NSUInteger pointCount;
+
+/// Returns the sample at the specified index. Raises an exception if the index is out of bounds.
+- (ORKStrokePoint)pointAtIndex:(NSUInteger)index;
+
+/**
+ Returns a copy of the stroke with the sample locations smoothed by a centered moving average.
+ Timestamps and forces are left untouched, and the first and last samples keep their locations.
+ 
+ @param windowSize  The number of samples averaged around each point. Values below 2 return the receiver.
+ */
+- (ORKStroke *)strokeBySmoothingWithWindowSize:(NSUInteger)windowSize;
+
+/**
+ Returns a binary encoding of the strokes.
+ 
+ The samples, already rounded to 1/8 point, 1 millisecond, and 1/64 force when the strokes were
+ created, are delta encoded as variable-length integers. Decoding the data with
+ `+strokesWithData:error:` returns strokes equal to the encoded ones.
+ */
++ (NSData *)dataWithStrokes:(NSArray<ORKStroke *> *)strokes;
+
+/**
+ Decodes strokes from data produced by `+dataWithStrokes:`.
+ 
+ @param data    The encoded strokes.
+ @param error   On failure, an error in `ORKErrorDomain` describing the malformed input.
+ 
+ @return The decoded strokes, or `nil` if the data is not a valid stroke encoding.
+ */
++ (nullable NSArray<ORKStroke *> *)strokesWithData:(NSData *)data error:(NSError * _Nullable *)error;
+
+@end
+
+NS_ASSUME_NONNULL_END
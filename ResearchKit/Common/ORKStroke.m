@@ -0,0 +1,308 @@
+/*
+ Copyright (c) 2026, CareEvolution, Inc.
+ 
+ Redistribution and use in source and binary forms, with or without modification,
+ are permitted provided that the following conditions are met:
+ 
+ 1.  Redistributions of source code must retain the above copyright notice, this
+ list of conditions and the following disclaimer.
+ 
+ 2.  Redistributions in binary form must reproduce the above copyright notice,
+ this list of conditions and the following disclaimer in the documentation and/or
+ other materials provided with the distribution.
+ 
+ 3.  Neither the name of the copyright holder(s) nor the names of any contributors
+ may be used to endorse or promote products derived from this software without
+ specific prior written permission. No license is granted to the trademarks of
+ the copyright holders even if such marks are included in this software.
+ 
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE
+ FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#import "ORKStroke.h"
+
+#import "ORKErrors.h"
+#import "ORKHelpers_Internal.h"
+
+
+static const uint8_t ORKStrokeEncodingMagic[4] = { 'O', 'R', 'K', 'S' };
+static const uint8_t ORKStrokeEncodingVersion = 1;
+
+static const double ORKStrokeLocationScale = 8.0;
+static const double ORKStrokeTimestampScale = 1000.0;
+static const double ORKStrokeForceScale = 64.0;
+
+static void ORKStrokeAppendVarint(NSMutableData *data, uint64_t value) {
+    uint8_t bytes[10];
+    NSUInteger length = 0;
+    do {
+        uint8_t byte = value & 0x7F;
+        value >>= 7;
+        bytes[length++] = byte | (value ? 0x80 : 0);
+    } while (value);
+    [data appendBytes:bytes length:length];
+}
+
+static void ORKStrokeAppendSignedVarint(NSMutableData *data, int64_t value) {
+    ORKStrokeAppendVarint(data, ((uint64_t)value << 1) ^ (uint64_t)(value >> 63));
+}
+
+static BOOL ORKStrokeReadVarint(const uint8_t *bytes, NSUInteger length, NSUInteger *offset, uint64_t *value) {
+    uint64_t result = 0;
+    for (NSUInteger shift = 0; shift < 64; shift += 7) {
+        if (*offset >= length) {
+            return NO;
+        }
+        uint8_t byte = bytes[(*offset)++];
+        result |= (uint64_t)(byte & 0x7F) << shift;
+        if ((byte & 0x80) == 0) {
+            *value = result;
+            return YES;
+        }
+    }
+    return NO;
+}
+
+static BOOL ORKStrokeReadSignedVarint(const uint8_t *bytes, NSUInteger length, NSUInteger *offset, int64_t *value) {
+    uint64_t encoded;
+    if (!ORKStrokeReadVarint(bytes, length, offset, &encoded)) {
+        return NO;
+    }
+    *value = (int64_t)(encoded >> 1) ^ -(int64_t)(encoded & 1);
+    return YES;
+}
+
+// Rounds a sample to the precision of the encoding, so encoding and decoding a stroke is lossless
+static ORKStrokePoint ORKStrokePointQuantized(ORKStrokePoint point) {
+    return (ORKStrokePoint){
+        .location = CGPointMake(llround(point.location.x * ORKStrokeLocationScale) / ORKStrokeLocationScale,
+                                llround(point.location.y * ORKStrokeLocationScale) / ORKStrokeLocationScale),
+        .timestamp = llround(point.timestamp * ORKStrokeTimestampScale) / ORKStrokeTimestampScale,
+        .force = llround(MAX(point.force, 0) * ORKStrokeForceScale) / ORKStrokeForceScale
+    };
+}
+
+static NSError *ORKStrokeDecodingError(NSString *reason) {
+    return [NSError errorWithDomain:ORKErrorDomain
+                               code:ORKErrorInvalidObject
+                           userInfo:@{NSLocalizedFailureReasonErrorKey: reason}];
+}
+
+
+@implementation ORKStroke {
+    NSData *_points;
+}
+
++ (instancetype)new {
+    ORKThrowMethodUnavailableException();
+}
+
+- (instancetype)init {
+    ORKThrowMethodUnavailableException();
+}
+
+- (instancetype)initWithPoints:(const ORKStrokePoint *)points count:(NSUInteger)count {
+    self = [super init];
+    if (self) {
+        NSMutableData *quantizedPoints = [NSMutableData dataWithLength:count * sizeof(ORKStrokePoint)];
+        ORKStrokePoint *quantized = quantizedPoints.mutableBytes;
+        for (NSUInteger i = 0; i < count; i++) {
+            quantized[i] = ORKStrokePointQuantized(points[i]);
+        }
+        _points = [quantizedPoints copy];
+        _pointCount = count;
+    }
+    return self;
+}
+
+- (ORKStrokePoint)pointAtIndex:(NSUInteger)index {
+    if (index >= _pointCount) {
+        @throw [NSException exceptionWithName:NSRangeException
+                                       reason:[NSString stringWithFormat:@"Index %@ is out of bounds for a stroke of %@ points", @(index), @(_pointCount)]
+                                     userInfo:nil];
+    }
+    return ((const ORKStrokePoint *)_points.bytes)[index];
+}
+
+- (ORKStroke *)strokeBySmoothingWithWindowSize:(NSUInteger)windowSize {
+    if (windowSize < 2 || _pointCount < 3) {
+        return self;
+    }
+    
+    const ORKStrokePoint *points = _points.bytes;
+    NSUInteger count = _pointCount;
+    NSUInteger halfWindow = windowSize / 2;
+    
+    // Prefix sums keep the pass linear regardless of the window size.
+    double *sumX = calloc(count + 1, sizeof(double));
+    double *sumY = calloc(count + 1, sizeof(double));
+    for (NSUInteger i = 0; i < count; i++) {
+        sumX[i + 1] = sumX[i] + points[i].location.x;
+        sumY[i + 1] = sumY[i] + points[i].location.y;
+    }
+    
+    NSMutableData *smoothed = [_points mutableCopy];
+    ORKStrokePoint *smoothedPoints = smoothed.mutableBytes;
+    for (NSUInteger i = 1; i < count - 1; i++) {
+        NSUInteger start = (i > halfWindow) ? i - halfWindow : 0;
+        NSUInteger end = MIN(count - 1, i + halfWindow);
+        double n = end - start + 1;
+        smoothedPoints[i].location = CGPointMake((sumX[end + 1] - sumX[start]) / n, (sumY[end + 1] - sumY[start]) / n);
+    }
+    free(sumX);
+    free(sumY);
+    
+    return [[ORKStroke alloc] initWithPoints:smoothedPoints count:count];
+}
+
+#pragma mark - Encoding
+
++ (NSData *)dataWithStrokes:(NSArray<ORKStroke *> *)strokes {
+    NSMutableData *data = [NSMutableData dataWithBytes:ORKStrokeEncodingMagic length:sizeof(ORKStrokeEncodingMagic)];
+    [data appendBytes:&ORKStrokeEncodingVersion length:1];
+    
+    // Timestamps are stored in milliseconds relative to the first sample, so they fit in a few bytes each.
+    double baseTimestamp = 0;
+    for (ORKStroke *stroke in strokes) {
+        if (stroke.pointCount > 0) {
+            baseTimestamp = [stroke pointAtIndex:0].timestamp;
+            break;
+        }
+    }
+    uint64_t swappedBaseTimestamp = CFConvertDoubleHostToSwapped(baseTimestamp).v;
+    [data appendBytes:&swappedBaseTimestamp length:sizeof(swappedBaseTimestamp)];
+    
+    ORKStrokeAppendVarint(data, strokes.count);
+    
+    int64_t baseT = llround(baseTimestamp * ORKStrokeTimestampScale);
+    int64_t previousX = 0;
+    int64_t previousY = 0;
+    int64_t previousT = 0;
+    for (ORKStroke *stroke in strokes) {
+        NSUInteger count = stroke.pointCount;
+        const ORKStrokePoint *points = stroke->_points.bytes;
+        ORKStrokeAppendVarint(data, count);
+        for (NSUInteger i = 0; i < count; i++) {
+            int64_t x = llround(points[i].location.x * ORKStrokeLocationScale);
+            int64_t y = llround(points[i].location.y * ORKStrokeLocationScale);
+            int64_t t = llround(points[i].timestamp * ORKStrokeTimestampScale) - baseT;
+            ORKStrokeAppendSignedVarint(data, x - previousX);
+            ORKStrokeAppendSignedVarint(data, y - previousY);
+            ORKStrokeAppendSignedVarint(data, t - previousT);
+            ORKStrokeAppendVarint(data, (uint64_t)llround(MAX(points[i].force, 0) * ORKStrokeForceScale));
+            previousX = x;
+            previousY = y;
+            previousT = t;
+        }
+    }
+    return [data copy];
+}
+
++ (NSArray<ORKStroke *> *)strokesWithData:(NSData *)data error:(NSError **)error {
+    const uint8_t *bytes = data.bytes;
+    NSUInteger length = data.length;
+    NSUInteger headerLength = sizeof(ORKStrokeEncodingMagic) + 1 + sizeof(uint64_t);
+    if (length < headerLength || memcmp(bytes, ORKStrokeEncodingMagic, sizeof(ORKStrokeEncodingMagic)) != 0) {
+        if (error) {
+            *error = ORKStrokeDecodingError(@"Data is not a stroke encoding");
+        }
+        return nil;
+    }
+    if (bytes[sizeof(ORKStrokeEncodingMagic)] != ORKStrokeEncodingVersion) {
+        if (error) {
+            *error = ORKStrokeDecodingError(@"Unsupported stroke encoding version");
+        }
+        return nil;
+    }
+    
+    CFSwappedFloat64 swappedBaseTimestamp;
+    memcpy(&swappedBaseTimestamp.v, bytes + sizeof(ORKStrokeEncodingMagic) + 1, sizeof(uint64_t));
+    double baseTimestamp = CFConvertDoubleSwappedToHost(swappedBaseTimestamp);
+    NSUInteger offset = headerLength;
+    
+    uint64_t strokeCount;
+    if (!ORKStrokeReadVarint(bytes, length, &offset, &strokeCount)) {
+        if (error) {
+            *error = ORKStrokeDecodingError(@"Truncated stroke encoding");
+        }
+        return nil;
+    }
+    
+    NSMutableArray<ORKStroke *> *strokes = [NSMutableArray new];
+    NSMutableData *buffer = [NSMutableData new];
+    int64_t x = 0;
+    int64_t y = 0;
+    int64_t t = llround(baseTimestamp * ORKStrokeTimestampScale);
+    for (uint64_t strokeIndex = 0; strokeIndex < strokeCount; strokeIndex++) {
+        uint64_t count;
+        // Every sample takes at least four bytes, which bounds the allocation for corrupt counts.
+        if (!ORKStrokeReadVarint(bytes, length, &offset, &count) || count > (length - offset) / 4) {
+            if (error) {
+                *error = ORKStrokeDecodingError(@"Truncated stroke encoding");
+            }
+            return nil;
+        }
+        
+        buffer.length = (NSUInteger)count * sizeof(ORKStrokePoint);
+        ORKStrokePoint *points = buffer.mutableBytes;
+        for (uint64_t i = 0; i < count; i++) {
+            int64_t dx, dy, dt;
+            uint64_t force;
+            if (!ORKStrokeReadSignedVarint(bytes, length, &offset, &dx) ||
+                !ORKStrokeReadSignedVarint(bytes, length, &offset, &dy) ||
+                !ORKStrokeReadSignedVarint(bytes, length, &offset, &dt) ||
+                !ORKStrokeReadVarint(bytes, length, &offset, &force)) {
+                if (error) {
+                    *error = ORKStrokeDecodingError(@"Truncated stroke encoding");
+                }
+                return nil;
+            }
+            x += dx;
+            y += dy;
+            t += dt;
+            points[i] = (ORKStrokePoint){
+                .location = CGPointMake(x / ORKStrokeLocationScale, y / ORKStrokeLocationScale),
+                .timestamp = t / ORKStrokeTimestampScale,
+                .force = force / ORKStrokeForceScale
+            };
+        }
+        [strokes addObject:[[ORKStroke alloc] initWithPoints:points count:(NSUInteger)count]];
+    }
+    return [strokes copy];
+}
+
+#pragma mark - NSObject
+
+- (instancetype)copyWithZone:(NSZone *)zone {
+    // Strokes are immutable.
+    return self;
+}
+
+- (BOOL)isEqual:(id)object {
+    if ([self class] != [object class]) {
+        return NO;
+    }
+    
+    __typeof(self) castObject = object;
+    return ORKEqualObjects(_points, castObject->_points);
+}
+
+- (NSUInteger)hash {
+    return _points.hash;
+}
+
+- (NSString *)description {
+    return [NSString stringWithFormat:@"<%@: %p; points: %@>", self.class.description, self, @(_pointCount)];
+}
+
+@end
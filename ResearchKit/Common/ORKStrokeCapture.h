@@ -0,0 +1,77 @@
+/*
+ Copyright (c) 2026, CareEvolution, Inc.
+ 
+ Redistribution and use in source and binary forms, with or without modification,
+ are permitted provided that the following conditions are met:
+ 
+ 1.  Redistributions of source code must retain the above copyright notice, this
+ list of conditions and the following disclaimer.
+ 
+ 2.  Redistributions in binary form must reproduce the above copyright notice,
+ this list of conditions and the following disclaimer in the documentation and/or
+ other materials provided with the distribution.
+ 
+ 3.  Neither the name of the copyright holder(s) nor the names of any contributors
+ may be used to endorse or promote products derived from this software without
+ specific prior written permission. No license is granted to the trademarks of
+ the copyright holders even if such marks are included in this software.
+ 
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE
+ FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+@import UIKit;
+
+
+NS_ASSUME_NONNULL_BEGIN
+
+@class ORKStroke;
+
+/**
+ An offscreen bitmap that accumulates committed strokes, so that drawing views only rasterize each
+ path once instead of re-stroking every path on every `drawRect:`.
+ */
+@interface ORKStrokeCanvas : NSObject
+
+- (instancetype)init NS_UNAVAILABLE;
+
+- (instancetype)initWithSize:(CGSize)size scale:(CGFloat)scale NS_DESIGNATED_INITIALIZER;
+
+@property (nonatomic, readonly) CGSize size;
+
+/// Strokes the path into the bitmap. Coordinates are in points, with the origin at the top left.
+- (void)strokePath:(UIBezierPath *)path color:(UIColor *)color;
+
+- (void)clear;
+
+/// Draws the accumulated bitmap into the current context, at the origin.
+- (void)drawInCurrentContext;
+
+@end
+
+
+/**
+ Collects the raw samples of one touch sequence, including coalesced touches, and turns them into
+ an `ORKStroke` when the touch ends.
+ */
+@interface ORKStrokeBuilder : NSObject
+
+@property (nonatomic, readonly) BOOL hasSamples;
+
+- (void)addSamplesForTouch:(UITouch *)touch event:(nullable UIEvent *)event inView:(UIView *)view;
+
+/// Returns the stroke built from the collected samples, or `nil` if there are none, and starts over.
+- (nullable ORKStroke *)finishStroke;
+
+@end
+
+NS_ASSUME_NONNULL_END
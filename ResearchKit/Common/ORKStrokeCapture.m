@@ -0,0 +1,143 @@
+/*
+ Copyright (c) 2026, CareEvolution, Inc.
+ 
+ Redistribution and use in source and binary forms, with or without modification,
+ are permitted provided that the following conditions are met:
+ 
+ 1.  Redistributions of source code must retain the above copyright notice, this
+ list of conditions and the following disclaimer.
+ 
+ 2.  Redistributions in binary form must reproduce the above copyright notice,
+ this list of conditions and the following disclaimer in the documentation and/or
+ other materials provided with the distribution.
+ 
+ 3.  Neither the name of the copyright holder(s) nor the names of any contributors
+ may be used to endorse or promote products derived from this software without
+ specific prior written permission. No license is granted to the trademarks of
+ the copyright holders even if such marks are included in this software.
+ 
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE
+ FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#import "ORKStrokeCapture.h"
+
+#import "ORKStroke.h"
+
+#import "ORKHelpers_Internal.h"
+
+
+@implementation ORKStrokeCanvas {
+    CGContextRef _context;
+    CGFloat _scale;
+    UIImage *_image;
+}
+
+- (instancetype)init {
+    ORKThrowMethodUnavailableException();
+}
+
+- (instancetype)initWithSize:(CGSize)size scale:(CGFloat)scale {
+    self = [super init];
+    if (self) {
+        _size = size;
+        _scale = MAX(scale, 1);
+        
+        size_t width = (size_t)ceil(size.width * _scale);
+        size_t height = (size_t)ceil(size.height * _scale);
+        CGColorSpaceRef colorSpace = CGColorSpaceCreateDeviceRGB();
+        _context = CGBitmapContextCreate(NULL, MAX(width, 1), MAX(height, 1), 8, 0, colorSpace, kCGImageAlphaPremultipliedFirst | kCGBitmapByteOrder32Host);
+        CGColorSpaceRelease(colorSpace);
+        
+        // Flip to UIKit coordinates so paths captured from touches can be stroked directly.
+        CGContextTranslateCTM(_context, 0, height);
+        CGContextScaleCTM(_context, _scale, -_scale);
+    }
+    return self;
+}
+
+- (void)dealloc {
+    CGContextRelease(_context);
+}
+
+- (void)strokePath:(UIBezierPath *)path color:(UIColor *)color {
+    UIGraphicsPushContext(_context);
+    [color setStroke];
+    [path stroke];
+    UIGraphicsPopContext();
+    _image = nil;
+}
+
+- (void)clear {
+    CGContextSaveGState(_context);
+    CGContextConcatCTM(_context, CGAffineTransformInvert(CGContextGetCTM(_context)));
+    CGContextClearRect(_context, CGRectMake(0, 0, CGBitmapContextGetWidth(_context), CGBitmapContextGetHeight(_context)));
+    CGContextRestoreGState(_context);
+    _image = nil;
+}
+
+- (void)drawInCurrentContext {
+    if (_image == nil) {
+        // The snapshot is copy-on-write, so it stays cheap until the next stroke lands.
+        CGImageRef image = CGBitmapContextCreateImage(_context);
+        _image = [UIImage imageWithCGImage:image scale:_scale orientation:UIImageOrientationUp];
+        CGImageRelease(image);
+    }
+    [_image drawAtPoint:CGPointZero];
+}
+
+@end
+
+
+@implementation ORKStrokeBuilder {
+    NSMutableData *_points;
+}
+
+- (instancetype)init {
+    self = [super init];
+    if (self) {
+        _points = [NSMutableData new];
+    }
+    return self;
+}
+
+- (BOOL)hasSamples {
+    return _points.length > 0;
+}
+
+- (void)addSamplesForTouch:(UITouch *)touch event:(UIEvent *)event inView:(UIView *)view {
+    NSArray<UITouch *> *touches = [event coalescedTouchesForTouch:touch] ? : @[touch];
+    for (UITouch *sample in touches) {
+        NSUInteger count = _points.length / sizeof(ORKStrokePoint);
+        // Began and moved handlers can both see the same touch; keep one sample per timestamp.
+        if (count > 0 && ((const ORKStrokePoint *)_points.bytes)[count - 1].timestamp >= sample.timestamp) {
+            continue;
+        }
+        ORKStrokePoint point = {
+            .location = [sample locationInView:view],
+            .timestamp = sample.timestamp,
+            .force = sample.force
+        };
+        [_points appendBytes:&point length:sizeof(point)];
+    }
+}
+
+- (ORKStroke *)finishStroke {
+    if (_points.length == 0) {
+        return nil;
+    }
+    ORKStroke *stroke = [[ORKStroke alloc] initWithPoints:_points.bytes count:_points.length / sizeof(ORKStrokePoint)];
+    _points.length = 0;
+    return stroke;
+}
+
+@end
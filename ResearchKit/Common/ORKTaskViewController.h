@@ -36,6 +36,7 @@
 NS_ASSUME_NONNULL_BEGIN
 
 @class ORKResult;
+@class ORKResultArchiveWriter;
 @class ORKStep;
 @class ORKStepViewController;
 @class ORKTaskResult;
@@ -427,6 +428,21 @@ ORK_CLASS_AVAILABLE
  */
 @property (nonatomic, copy, nullable) NSURL *outputDirectory;
 
+/**
+ An archive writer that packages the files and result of this task run for upload.
+ 
+ When this property is set, each step result is appended to the writer as its step finishes, so
+ that recorded files are archived while the task is still in progress. When the task completes,
+ the archive is finished with the task result in the background, and the delegate is notified
+ once it is written; if the archive
+ cannot be written, the task finishes with `ORKTaskViewControllerFinishReasonFailed` and the
+ archive error. For any other finish reason, the partial archive is removed.
+ 
+ Set this property before presenting the task view controller. Any files referenced by the
+ result are read from `outputDirectory`.
+ */
+@property (nonatomic, strong, nullable) ORKResultArchiveWriter *resultArchiveWriter;
+
 /**
  A Boolean value indicating whether progress is shown in the navigation bar.
  
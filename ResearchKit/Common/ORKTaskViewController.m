@@ -48,6 +48,7 @@
 #import "ORKOrderedTask.h"
 #import "ORKQuestionStep.h"
 #import "ORKResult_Private.h"
+#import "ORKResultArchiveWriter.h"
 #import "ORKReviewStep_Internal.h"
 #import "ORKStep_Private.h"
 #import "ORKTappingIntervalStep.h"
@@ -235,9 +236,210 @@ static void *_ORKViewControllerToolbarObserverContext = &_ORKViewControllerToolb
 @end
 
 
+static void ORKEnumerateResultTree(ORKResult *result, void (^block)(ORKResult *result)) {
+    block(result);
+    if ([result isKindOfClass:[ORKCollectionResult class]]) {
+        for (ORKResult *childResult in ((ORKCollectionResult *)result).results) {
+            ORKEnumerateResultTree(childResult, block);
+        }
+    }
+}
+
+
+/*
+ The archive of a stored step result. The start and end dates of the result and its child results
+ are kept apart from the archive, in depth-first order, so that visits of a step which differ only in
+ their timing share a single archive.
+ */
+@interface ORKStepResultArchive : NSObject
+
+- (instancetype)initWithResult:(ORKStepResult *)result;
+- (instancetype)initWithData:(NSData *)data dates:(NSArray *)dates;
+
+@property (nonatomic, copy, readonly) NSData *data;
+// Start and end date pairs, with NSNull for missing dates
+@property (nonatomic, copy, readonly) NSArray *dates;
+
+- (nullable ORKStepResult *)decodeResult;
+
+@end
+
+
+@implementation ORKStepResultArchive
+
+- (instancetype)initWithResult:(ORKStepResult *)result {
+    NSMutableArray *dates = [NSMutableArray new];
+    ORKStepResult *undatedResult = [result copy];
+    ORKEnumerateResultTree(undatedResult, ^(ORKResult *subresult) {
+        [dates addObject:subresult.startDate ? : [NSNull null]];
+        [dates addObject:subresult.endDate ? : [NSNull null]];
+        subresult.startDate = [NSDate distantPast];
+        subresult.endDate = [NSDate distantPast];
+    });
+    return [self initWithData:[NSKeyedArchiver archivedDataWithRootObject:undatedResult] dates:dates];
+}
+
+- (instancetype)initWithData:(NSData *)data dates:(NSArray *)dates {
+    self = [super init];
+    if (self) {
+        _data = [data copy];
+        _dates = [dates copy];
+    }
+    return self;
+}
+
+- (ORKStepResult *)decodeResult {
+    if (_data.length == 0) {
+        return nil;
+    }
+    NSKeyedUnarchiver *unarchiver = [[NSKeyedUnarchiver alloc] initForReadingWithData:_data];
+    ORKStepResult *result = ORKDynamicCast([unarchiver decodeObjectForKey:NSKeyedArchiveRootObjectKey], ORKStepResult);
+    __block NSUInteger dateIndex = 0;
+    ORKEnumerateResultTree(result, ^(ORKResult *subresult) {
+        if (dateIndex + 1 < self->_dates.count) {
+            subresult.startDate = ORKDynamicCast(self->_dates[dateIndex], NSDate);
+            subresult.endDate = ORKDynamicCast(self->_dates[dateIndex + 1], NSDate);
+        }
+        dateIndex += 2;
+    });
+    return result;
+}
+
+@end
+
+
+/*
+ Step results restored from archived state. Each result is decoded the first time it is asked for,
+ either by the task view controller or through a result snapshot handed out earlier, possibly on
+ another thread, and always decodes to the same object.
+ */
+@interface ORKArchivedStepResults : NSObject
+
+- (instancetype)initWithArchives:(NSArray<ORKStepResultArchive *> *)archives saveableIndexes:(nullable NSIndexSet *)saveableIndexes;
+
+- (ORKStepResultArchive *)archiveAtIndex:(NSUInteger)index;
+- (BOOL)isSaveableAtIndex:(NSUInteger)index;
+- (nullable ORKStepResult *)resultAtIndex:(NSUInteger)index;
+// The result at the index if it was decoded already
+- (nullable ORKStepResult *)decodedResultAtIndex:(NSUInteger)index;
+
+@end
+
+
+@implementation ORKArchivedStepResults {
+    NSArray<ORKStepResultArchive *> *_archives;
+    NSIndexSet *_saveableIndexes;
+    NSMutableDictionary<NSNumber *, ORKStepResult *> *_decodedResults;
+}
+
+- (instancetype)initWithArchives:(NSArray<ORKStepResultArchive *> *)archives saveableIndexes:(NSIndexSet *)saveableIndexes {
+    self = [super init];
+    if (self) {
+        _archives = [archives copy];
+        _saveableIndexes = [saveableIndexes copy];
+        _decodedResults = [NSMutableDictionary new];
+    }
+    return self;
+}
+
+- (ORKStepResultArchive *)archiveAtIndex:(NSUInteger)index {
+    return _archives[index];
+}
+
+- (BOOL)isSaveableAtIndex:(NSUInteger)index {
+    if (_saveableIndexes == nil) {
+        // Archived without saveable flags
+        return [[self resultAtIndex:index] isSaveable];
+    }
+    return [_saveableIndexes containsIndex:index];
+}
+
+- (ORKStepResult *)decodedResultAtIndex:(NSUInteger)index {
+    @synchronized (self) {
+        return _decodedResults[@(index)];
+    }
+}
+
+- (ORKStepResult *)resultAtIndex:(NSUInteger)index {
+    @synchronized (self) {
+        ORKStepResult *result = _decodedResults[@(index)];
+        if (result == nil) {
+            result = [_archives[index] decodeResult];
+            _decodedResults[@(index)] = result;
+        }
+        return result;
+    }
+}
+
+@end
+
+
+/*
+ The step results of a task result. Slots still held in archives are decoded the first time they
+ are accessed, so handing out the task result does not decode results nobody reads.
+ */
+@interface ORKManagedStepResultArray : NSArray
+
+- (instancetype)initWithResults:(NSArray *)results stepIdentifiers:(NSArray<NSString *> *)stepIdentifiers archivedResults:(ORKArchivedStepResults *)archivedResults;
+
+@end
+
+
+@implementation ORKManagedStepResultArray {
+    // Step results, or indexes in `_archivedResults` for slots not decoded yet
+    NSArray *_results;
+    NSArray<NSString *> *_stepIdentifiers;
+    ORKArchivedStepResults *_archivedResults;
+}
+
+- (instancetype)initWithResults:(NSArray *)results stepIdentifiers:(NSArray<NSString *> *)stepIdentifiers archivedResults:(ORKArchivedStepResults *)archivedResults {
+    self = [super init];
+    if (self) {
+        _results = [results copy];
+        _stepIdentifiers = [stepIdentifiers copy];
+        _archivedResults = archivedResults;
+    }
+    return self;
+}
+
+- (NSUInteger)count {
+    return _results.count;
+}
+
+- (id)objectAtIndex:(NSUInteger)index {
+    id result = _results[index];
+    if ([result isKindOfClass:[NSNumber class]]) {
+        // An archive that fails to decode leaves an empty result in its slot
+        result = [_archivedResults resultAtIndex:[result unsignedIntegerValue]] ? : [[ORKStepResult alloc] initWithStepIdentifier:_stepIdentifiers[index] results:nil];
+    }
+    return result;
+}
+
+- (id)copyWithZone:(NSZone *)zone {
+    return self;
+}
+
+- (Class)classForCoder {
+    return [NSArray class];
+}
+
+@end
+
+
 @interface ORKTaskViewController () <ORKViewControllerToolbarObserverDelegate, ORKScrollViewObserverDelegate> {
     NSMutableDictionary *_managedResults;
     NSMutableArray *_managedStepIdentifiers;
+    // Step results in `_managedStepIdentifiers` order, with NSNull for slots not looked up yet.
+    // Kept in step with the identifiers so a result change only touches its own slot.
+    NSMutableArray *_orderedManagedResults;
+    // Immutable snapshot of the results in `_orderedManagedResults`, handed out until the next change.
+    NSArray<ORKStepResult *> *_managedResultsSnapshot;
+    // Step results restored from archived state and not looked up since. Each key maps to an index in
+    // `_archivedResults`, so a result stored under several keys decodes to a single object.
+    NSMutableDictionary<NSString *, NSNumber *> *_pendingResultIndexes;
+    ORKArchivedStepResults *_archivedResults;
+    // Archive of each stored result, reused by state saves until the result is replaced
+    NSMapTable<ORKStepResult *, ORKStepResultArchive *> *_managedResultArchives;
     ORKViewControllerToolbarObserver *_stepViewControllerObserver;
     ORKScrollViewObserver *_scrollViewObserver;
     BOOL _hasSetProgressLabel;
@@ -247,6 +449,7 @@ static void *_ORKViewControllerToolbarObserverContext = &_ORKViewControllerToolb
     NSSet<HKObjectType *> *_requestedHealthTypesForRead;
     NSSet<HKObjectType *> *_requestedHealthTypesForWrite;
     NSURL *_outputDirectory;
+    NSData *_outputDirectoryBookmarkData;
     
     NSDate *_presentedDate;
     NSDate *_dismissedDate;
@@ -256,6 +459,8 @@ static void *_ORKViewControllerToolbarObserverContext = &_ORKViewControllerToolb
     
     BOOL _hasAudioSession; // does not need state restoration - temporary
     
+    dispatch_queue_t _stepPrefetchQueue;
+    
     NSString *_restoredTaskIdentifier;
     NSString *_restoredStepIdentifier;
 }
@@ -342,6 +547,7 @@ static NSString *const _ChildNavigationControllerRestorationKey = @"childNavigat
     
     _managedResults = [NSMutableDictionary dictionary];
     _managedStepIdentifiers = [NSMutableArray array];
+    _orderedManagedResults = [NSMutableArray array];
     
     self.taskRunUUID = taskRunUUID;
     
@@ -795,16 +1001,68 @@ static NSString *const _ChildNavigationControllerRestorationKey = @"childNavigat
 }
 
 - (NSArray *)managedResults {
-    NSMutableArray *results = [NSMutableArray new];
-    
-    [_managedStepIdentifiers enumerateObjectsUsingBlock:^(NSString *identifier, NSUInteger idx, BOOL *stop) {
-        id <NSCopying> key = [self uniqueManagedKey:identifier index:idx];
-        ORKResult *result = _managedResults[key];
-        NSAssert2(result, @"Result should not be nil for identifier %@ with key %@", identifier, key);
-        [results addObject:result];
-    }];
-    
-    return [results copy];
+    if (_managedResultsSnapshot == nil) {
+        NSUInteger count = _orderedManagedResults.count;
+        NSMutableArray *results = [NSMutableArray arrayWithCapacity:count];
+        NSMutableArray<NSString *> *stepIdentifiers = [NSMutableArray arrayWithCapacity:count];
+        BOOL hasArchivedResults = NO;
+        for (NSUInteger idx = 0; idx < count; idx++) {
+            id result = _orderedManagedResults[idx];
+            NSString *identifier = _managedStepIdentifiers[idx];
+            if (result == [NSNull null]) {
+                NSString *key = (NSString *)[self uniqueManagedKey:identifier index:idx];
+                result = _managedResults[key];
+                if (result != nil) {
+                    _orderedManagedResults[idx] = result;
+                } else {
+                    // Still archived: the snapshot decodes it when it is first read
+                    result = _pendingResultIndexes[key];
+                    hasArchivedResults = hasArchivedResults || (result != nil);
+                }
+                NSAssert2(result, @"Result should not be nil for identifier %@ with key %@", identifier, key);
+                if (result == nil) {
+                    // Leave the slot out; it is looked up again for the next snapshot
+                    continue;
+                }
+            }
+            [results addObject:result];
+            [stepIdentifiers addObject:identifier];
+        }
+        if (hasArchivedResults) {
+            _managedResultsSnapshot = [[ORKManagedStepResultArray alloc] initWithResults:results stepIdentifiers:stepIdentifiers archivedResults:_archivedResults];
+        } else {
+            _managedResultsSnapshot = [results copy];
+        }
+    }
+    return _managedResultsSnapshot;
+}
+
+- (void)addManagedStepIdentifier:(NSString *)identifier {
+    NSUInteger idx = _managedStepIdentifiers.count;
+    [_managedStepIdentifiers addObject:identifier];
+    // The result may already have been stored under the new slot's key.
+    [_orderedManagedResults addObject:_managedResults[[self uniqueManagedKey:identifier index:idx]] ? : [NSNull null]];
+    _managedResultsSnapshot = nil;
+}
+
+- (void)removeLastManagedStepIdentifier {
+    [_managedStepIdentifiers removeLastObject];
+    [_orderedManagedResults removeLastObject];
+    _managedResultsSnapshot = nil;
+}
+
+- (void)removeAllManagedStepIdentifiers {
+    [_managedStepIdentifiers removeAllObjects];
+    [_orderedManagedResults removeAllObjects];
+    _managedResultsSnapshot = nil;
+}
+
+- (void)resetOrderedManagedResults {
+    _orderedManagedResults = [NSMutableArray arrayWithCapacity:_managedStepIdentifiers.count];
+    for (NSUInteger idx = 0; idx < _managedStepIdentifiers.count; idx++) {
+        [_orderedManagedResults addObject:[NSNull null]];
+    }
+    _managedResultsSnapshot = nil;
 }
 
 - (void)setManagedResult:(ORKStepResult *)result forKey:(NSString *)aKey {
@@ -820,28 +1078,100 @@ static NSString *const _ChildNavigationControllerRestorationKey = @"childNavigat
     // Manage last result tracking (used in predicate navigation)
     // If the previous result and the replacement result are the same result then `isPreviousResult`
     // will be set to `NO` otherwise it will be marked with `YES`.
-    ORKStepResult *previousResult = _managedResults[aKey];
+    ORKStepResult *previousResult = [self managedResultForKey:aKey];
+    
+    // Also point to the object using a unique key
+    NSUInteger idx = _managedStepIdentifiers.count;
+    if ([_managedStepIdentifiers.lastObject isEqualToString:aKey]) {
+        idx--;
+    }
+    id <NSCopying> uniqueKey = [self uniqueManagedKey:aKey index:idx];
+    
+    // A step view controller builds a new result every time it is asked. Keep the result stored for
+    // this visit of the step while it is unchanged, and otherwise store a copy, so that changes the
+    // caller makes to its result later reach neither the stored result nor its archive.
+    ORKStepResult *visitResult = [self managedResultForKey:uniqueKey];
+    if (result != visitResult) {
+        if ([result isEqual:visitResult]) {
+            result = visitResult;
+        } else {
+            result = [result copy];
+            result.results = [self resultsBySharingResults:visitResult.results inResults:result.results];
+        }
+    }
     previousResult.isPreviousResult = YES;
     result.isPreviousResult = NO;
     
     if (_managedResults == nil) {
         _managedResults = [NSMutableDictionary new];
+        _managedResultArchives = [NSMapTable weakToStrongObjectsMapTable];
     }
     _managedResults[aKey] = result;
+    _managedResults[uniqueKey] = result;
+    [_pendingResultIndexes removeObjectsForKeys:@[aKey, uniqueKey]];
     
-    // Also point to the object using a unique key
-    NSUInteger idx = _managedStepIdentifiers.count;
-    if ([_managedStepIdentifiers.lastObject isEqualToString:aKey]) {
-        idx--;
+    if (idx < _orderedManagedResults.count && _orderedManagedResults[idx] != result) {
+        _orderedManagedResults[idx] = result;
+        _managedResultsSnapshot = nil;
     }
-    id <NSCopying> uniqueKey = [self uniqueManagedKey:aKey index:idx];
-    _managedResults[uniqueKey] = result;
+}
+
+// Child results equal to the ones stored for the same visit are shared with the stored result
+- (NSArray<ORKResult *> *)resultsBySharingResults:(NSArray<ORKResult *> *)visitResults inResults:(NSArray<ORKResult *> *)results {
+    if (visitResults.count == 0 || results.count == 0) {
+        return results;
+    }
+    
+    NSMutableArray<ORKResult *> *sharedResults = [results mutableCopy];
+    [results enumerateObjectsUsingBlock:^(ORKResult *result, NSUInteger idx, BOOL *stop) {
+        if (idx < visitResults.count && [result isEqual:visitResults[idx]]) {
+            sharedResults[idx] = visitResults[idx];
+        }
+    }];
+    return [sharedResults copy];
 }
 
 - (id <NSCopying>)uniqueManagedKey:(NSString*)stepIdentifier index:(NSUInteger)index {
     return [NSString stringWithFormat:@"%@:%@", stepIdentifier, @(index)];
 }
 
+- (ORKStepResult *)managedResultForKey:(id <NSCopying>)key {
+    ORKStepResult *result = _managedResults[key];
+    NSNumber *pendingIndex = _pendingResultIndexes[key];
+    if (result == nil && pendingIndex != nil) {
+        [_pendingResultIndexes removeObjectForKey:key];
+        result = [_archivedResults resultAtIndex:pendingIndex.unsignedIntegerValue];
+        if (result != nil) {
+            if (_managedResults == nil) {
+                _managedResults = [NSMutableDictionary new];
+                _managedResultArchives = [NSMapTable weakToStrongObjectsMapTable];
+            }
+            _managedResults[key] = result;
+            // Saving writes the archive the result was decoded from back as it is
+            [_managedResultArchives setObject:[_archivedResults archiveAtIndex:pendingIndex.unsignedIntegerValue] forKey:result];
+        }
+        if (_pendingResultIndexes.count == 0) {
+            _pendingResultIndexes = nil;
+            _archivedResults = nil;
+        }
+    }
+    return result;
+}
+
+- (BOOL)hasSaveableManagedResults {
+    for (ORKStepResult *result in _managedResults.objectEnumerator) {
+        if ([result isSaveable]) {
+            return YES;
+        }
+    }
+    for (NSNumber *pendingIndex in _pendingResultIndexes.objectEnumerator) {
+        if ([_archivedResults isSaveableAtIndex:pendingIndex.unsignedIntegerValue]) {
+            return YES;
+        }
+    }
+    return NO;
+}
+
 - (NSUUID *)taskRunUUID {
     if (_taskRunUUID == nil) {
         _taskRunUUID = [NSUUID UUID];
@@ -898,6 +1228,7 @@ static NSString *const _ChildNavigationControllerRestorationKey = @"childNavigat
     [self ensureDirectoryExists:outputDirectory];
     
     _outputDirectory = [outputDirectory copy];
+    _outputDirectoryBookmarkData = nil;
     
     [[self currentStepViewController] setOutputDirectory:_outputDirectory];
 }
@@ -1030,7 +1361,7 @@ static NSString *const _ChildNavigationControllerRestorationKey = @"childNavigat
     }
     
     if (step.identifier && ![_managedStepIdentifiers.lastObject isEqualToString:step.identifier]) {
-        [_managedStepIdentifiers addObject:step.identifier];
+        [self addManagedStepIdentifier:step.identifier];
     }
     if ([step isRestorable] && !(viewController.isBeingReviewed && viewController.parentReviewStep.isStandalone)) {
         _lastRestorableStepIdentifier = step.identifier;
@@ -1111,9 +1442,41 @@ static NSString *const _ChildNavigationControllerRestorationKey = @"childNavigat
         
         // Collect toolbarItems
         [strongSelf collectToolbarItemsFromViewController:viewController];
+        
+        [strongSelf prefetchResourcesForStepAfterStep:viewController.step];
     }];
 }
 
+- (void)prefetchResourcesForStepAfterStep:(ORKStep *)step {
+    if (step == nil || _currentStepViewController.step != step) {
+        return;
+    }
+    
+    // Asking the task for the next step would run navigation rules, step modifiers and app code against a result
+    // that is not final yet, and those can have side effects. The next step in the ordered list is only a guess,
+    // but a wrong guess just warms caches that go unused.
+    ORKOrderedTask *orderedTask = ORKDynamicCast(_task, ORKOrderedTask);
+    NSUInteger index = [orderedTask indexOfStep:step];
+    if (orderedTask == nil || index == NSNotFound || index + 1 >= orderedTask.steps.count) {
+        return;
+    }
+    ORKStep *nextStep = orderedTask.steps[index + 1];
+    Class stepViewControllerClass = [nextStep stepViewControllerClass];
+    if (![stepViewControllerClass isSubclassOfClass:[ORKStepViewController class]]) {
+        return;
+    }
+    
+    if (_stepPrefetchQueue == nil) {
+        _stepPrefetchQueue = dispatch_queue_create("_ork_stepPrefetchQueue", DISPATCH_QUEUE_SERIAL);
+    }
+    
+    // Step modifiers may change the step on the main queue before it is shown, so the background work reads a copy.
+    ORKStep *prefetchedStep = [nextStep copy];
+    dispatch_async(_stepPrefetchQueue, ^{
+        [stepViewControllerClass prefetchResourcesForStep:prefetchedStep];
+    });
+}
+
 - (BOOL)shouldPresentStep:(ORKStep *)step {
     BOOL shouldPresent = (step != nil);
     
@@ -1227,7 +1590,7 @@ static NSString *const _ChildNavigationControllerRestorationKey = @"childNavigat
             
             // Get the step result associated with this step
             ORKStepResult *result = nil;
-            ORKStepResult *previousResult = _managedResults[step.identifier];
+            ORKStepResult *previousResult = [self managedResultForKey:step.identifier];
             
             // Check the default source first
             BOOL alwaysCheckForDefaultResult = ([self.defaultResultSource respondsToSelector:@selector(alwaysCheckForDefaultResult)] &&
@@ -1238,7 +1601,8 @@ static NSString *const _ChildNavigationControllerRestorationKey = @"childNavigat
             
             // If nil, assign to the previous result (if available) otherwise create new instance
             if (!result) {
-                result = previousResult ? : [[ORKStepResult alloc] initWithIdentifier:step.identifier];
+                // The step view controller gets its own copy to change
+                result = [previousResult copy] ? : [[ORKStepResult alloc] initWithIdentifier:step.identifier];
             }
             
             // Allow the step to instantiate the view controller. This will allow either the default
@@ -1303,6 +1667,24 @@ static NSString *const _ChildNavigationControllerRestorationKey = @"childNavigat
 #pragma mark - internal action Handlers
 
 - (void)finishWithReason:(ORKTaskViewControllerFinishReason)reason error:(NSError *)error {
+    if (_resultArchiveWriter != nil) {
+        if (reason == ORKTaskViewControllerFinishReasonCompleted) {
+            // The delegate is told once the archive is written in the background
+            [_resultArchiveWriter finishWithTaskResult:[self result] completionHandler:^(NSError *archiveError) {
+                if (archiveError != nil) {
+                    [self notifyDelegateOfFinishWithReason:ORKTaskViewControllerFinishReasonFailed error:archiveError];
+                } else {
+                    [self notifyDelegateOfFinishWithReason:reason error:error];
+                }
+            }];
+            return;
+        }
+        [_resultArchiveWriter cancel];
+    }
+    [self notifyDelegateOfFinishWithReason:reason error:error];
+}
+
+- (void)notifyDelegateOfFinishWithReason:(ORKTaskViewControllerFinishReason)reason error:(NSError *)error {
     ORKStrongTypeOf(self.delegate) strongDelegate = self.delegate;
     if ([strongDelegate respondsToSelector:@selector(taskViewController:didFinishWithReason:error:)]) {
         [strongDelegate taskViewController:self didFinishWithReason:reason error:error];
@@ -1370,14 +1752,7 @@ static NSString *const _ChildNavigationControllerRestorationKey = @"childNavigat
     
     // [self result] would not include any results beyond current step.
     // Use _managedResults to get the completed result set.
-    NSArray *results = _managedResults.allValues;
-    BOOL saveable = NO;
-    for (ORKStepResult *result in results) {
-        if ([result isSaveable]) {
-            saveable = YES;
-            break;
-        }
-    }
+    BOOL saveable = [self hasSaveableManagedResults];
     
     BOOL isStandaloneReviewStep = NO;
     if ([self.currentStepViewController.step isKindOfClass:[ORKReviewStep class]]) {
@@ -1437,7 +1812,7 @@ static NSString *const _ChildNavigationControllerRestorationKey = @"childNavigat
         ORKStepViewController *stepViewController = [self viewControllerForStep:step];
         NSAssert(stepViewController != nil, @"A non-nil step should always generate a step view controller");
         if (fromController.isBeingReviewed) {
-            [_managedStepIdentifiers removeLastObject];
+            [self removeLastManagedStepIdentifier];
         }
         [self showViewController:stepViewController goForward:YES animated:YES];
     }
@@ -1449,7 +1824,7 @@ static NSString *const _ChildNavigationControllerRestorationKey = @"childNavigat
         ORKOrderedTask *orderedTask = (ORKOrderedTask *)self.task;
         ORKStep *firstStep = [[orderedTask steps] firstObject];
         if (firstStep) {
-            [_managedStepIdentifiers removeAllObjects];
+            [self removeAllManagedStepIdentifiers];
             [self showViewController:[self viewControllerForStep:firstStep] goForward:YES animated:NO];
         }
     }
@@ -1474,7 +1849,7 @@ static NSString *const _ChildNavigationControllerRestorationKey = @"childNavigat
         if (stepViewController) {
             // Remove the identifier from the list
             assert([itemId isEqualToString:_managedStepIdentifiers.lastObject]);
-            [_managedStepIdentifiers removeLastObject];
+            [self removeLastManagedStepIdentifier];
             
             [self showViewController:stepViewController goForward:NO animated:YES];
         }
@@ -1493,7 +1868,9 @@ static NSString *const _ChildNavigationControllerRestorationKey = @"childNavigat
     
     if (!stepViewController.readOnlyMode) {
         // Add step result object
-        [self setManagedResult:[stepViewController result] forKey:stepViewController.step.identifier];
+        ORKStepResult *stepResult = [stepViewController result];
+        [self setManagedResult:stepResult forKey:stepViewController.step.identifier];
+        [_resultArchiveWriter appendStepResult:stepResult];
     }
     
     // Alert the delegate that the step is finished 
@@ -1588,6 +1965,10 @@ static NSString *const _ChildNavigationControllerRestorationKey = @"childNavigat
 static NSString *const _ORKTaskRunUUIDRestoreKey = @"taskRunUUID";
 static NSString *const _ORKShowsProgressInNavigationBarRestoreKey = @"showsProgressInNavigationBar";
 static NSString *const _ORKManagedResultsRestoreKey = @"managedResults";
+static NSString *const _ORKManagedResultArchivesRestoreKey = @"managedResultArchives";
+static NSString *const _ORKManagedResultEntriesRestoreKey = @"managedResultEntries";
+static NSString *const _ORKManagedResultIndexesRestoreKey = @"managedResultIndexes";
+static NSString *const _ORKManagedResultSaveableIndexesRestoreKey = @"managedResultSaveableIndexes";
 static NSString *const _ORKManagedStepIdentifiersRestoreKey = @"managedStepIdentifiers";
 static NSString *const _ORKHasSetProgressLabelRestoreKey = @"hasSetProgressLabel";
 static NSString *const _ORKHasRequestedHealthDataRestoreKey = @"hasRequestedHealthData";
@@ -1604,14 +1985,17 @@ static NSString *const _ORKPresentedDate = @"presentedDate";
     
     [coder encodeObject:_taskRunUUID forKey:_ORKTaskRunUUIDRestoreKey];
     [coder encodeBool:self.showsProgressInNavigationBar forKey:_ORKShowsProgressInNavigationBarRestoreKey];
-    [coder encodeObject:_managedResults forKey:_ORKManagedResultsRestoreKey];
+    [self encodeManagedResultsWithCoder:coder];
     [coder encodeObject:_managedStepIdentifiers forKey:_ORKManagedStepIdentifiersRestoreKey];
     [coder encodeBool:_hasSetProgressLabel forKey:_ORKHasSetProgressLabelRestoreKey];
     [coder encodeObject:_requestedHealthTypesForRead forKey:_ORKRequestedHealthTypesForReadRestoreKey];
     [coder encodeObject:_requestedHealthTypesForWrite forKey:_ORKRequestedHealthTypesForWriteRestoreKey];
     [coder encodeObject:_presentedDate forKey:_ORKPresentedDate];
     
-    [coder encodeObject:ORKBookmarkDataFromURL(_outputDirectory) forKey:_ORKOutputDirectoryRestoreKey];
+    if (_outputDirectoryBookmarkData == nil) {
+        _outputDirectoryBookmarkData = ORKBookmarkDataFromURL(_outputDirectory);
+    }
+    [coder encodeObject:_outputDirectoryBookmarkData forKey:_ORKOutputDirectoryRestoreKey];
     [coder encodeObject:_lastBeginningInstructionStepIdentifier forKey:_ORKLastBeginningInstructionStepIdentifierKey];
     
     [coder encodeObject:_task.identifier forKey:_ORKTaskIdentifierRestoreKey];
@@ -1624,6 +2008,101 @@ static NSString *const _ORKPresentedDate = @"presentedDate";
     }
 }
 
+// Each distinct step result is stored as an entry holding the index of its archive, followed by the
+// start and end dates of the result and its child results. Archives leave the dates out, so visits
+// of a step that differ only in their timing refer to a single archive. A table maps result keys to
+// entry indexes, and the indexes of the saveable entries are stored with them.
+// A stored result keeps its archive until it is replaced, so saving again only archives results that
+// changed since the last save. Restoring decodes a result the first time it is looked up, and results
+// never looked up are written back from their archives as they are.
+- (void)encodeManagedResultsWithCoder:(NSCoder *)coder {
+    NSMutableArray<NSData *> *archives = [NSMutableArray new];
+    NSMutableDictionary<NSData *, NSNumber *> *indexesByArchive = [NSMutableDictionary new];
+    NSMutableArray<NSArray *> *entries = [NSMutableArray new];
+    NSMutableDictionary<NSString *, NSNumber *> *indexes = [NSMutableDictionary new];
+    NSMutableIndexSet *saveableIndexes = [NSMutableIndexSet new];
+    NSNumber *(^addEntry)(ORKStepResultArchive *, BOOL) = ^NSNumber *(ORKStepResultArchive *archive, BOOL saveable) {
+        NSNumber *archiveIndex = indexesByArchive[archive.data];
+        if (archiveIndex == nil) {
+            archiveIndex = @(archives.count);
+            [archives addObject:archive.data];
+            indexesByArchive[archive.data] = archiveIndex;
+        }
+        NSNumber *index = @(entries.count);
+        [entries addObject:[@[archiveIndex] arrayByAddingObjectsFromArray:archive.dates]];
+        if (saveable) {
+            [saveableIndexes addIndex:index.unsignedIntegerValue];
+        }
+        return index;
+    };
+    
+    NSMapTable<ORKStepResult *, NSNumber *> *indexesByResult = [NSMapTable mapTableWithKeyOptions:(NSPointerFunctionsStrongMemory | NSPointerFunctionsObjectPointerPersonality)
+                                                                                      valueOptions:NSPointerFunctionsStrongMemory];
+    [_managedResults enumerateKeysAndObjectsUsingBlock:^(NSString *key, ORKStepResult *result, BOOL *stop) {
+        NSNumber *index = [indexesByResult objectForKey:result];
+        if (index == nil) {
+            ORKStepResultArchive *archive = [self->_managedResultArchives objectForKey:result];
+            if (archive == nil) {
+                archive = [[ORKStepResultArchive alloc] initWithResult:result];
+                [self->_managedResultArchives setObject:archive forKey:result];
+            }
+            index = addEntry(archive, [result isSaveable]);
+            [indexesByResult setObject:index forKey:result];
+        }
+        indexes[key] = index;
+    }];
+    NSMutableDictionary<NSNumber *, NSNumber *> *indexesByPendingIndex = [NSMutableDictionary new];
+    [_pendingResultIndexes enumerateKeysAndObjectsUsingBlock:^(NSString *key, NSNumber *pendingIndex, BOOL *stop) {
+        // Another key may have looked up the same result already
+        ORKStepResult *decodedResult = [self->_archivedResults decodedResultAtIndex:pendingIndex.unsignedIntegerValue];
+        NSNumber *index = indexesByPendingIndex[pendingIndex] ? : (decodedResult ? [indexesByResult objectForKey:decodedResult] : nil);
+        if (index == nil) {
+            index = addEntry([self->_archivedResults archiveAtIndex:pendingIndex.unsignedIntegerValue],
+                             [self->_archivedResults isSaveableAtIndex:pendingIndex.unsignedIntegerValue]);
+            indexesByPendingIndex[pendingIndex] = index;
+        }
+        indexes[key] = index;
+    }];
+    
+    [coder encodeObject:archives forKey:_ORKManagedResultArchivesRestoreKey];
+    [coder encodeObject:entries forKey:_ORKManagedResultEntriesRestoreKey];
+    [coder encodeObject:indexes forKey:_ORKManagedResultIndexesRestoreKey];
+    [coder encodeObject:saveableIndexes forKey:_ORKManagedResultSaveableIndexesRestoreKey];
+}
+
+- (void)decodeManagedResultsWithCoder:(NSCoder *)coder {
+    NSArray *archives = [coder decodeObjectOfClass:[NSArray class] forKey:_ORKManagedResultArchivesRestoreKey];
+    NSArray *entries = [coder decodeObjectOfClass:[NSArray class] forKey:_ORKManagedResultEntriesRestoreKey];
+    NSDictionary *indexes = [coder decodeObjectOfClass:[NSDictionary class] forKey:_ORKManagedResultIndexesRestoreKey];
+    _managedResultArchives = [NSMapTable weakToStrongObjectsMapTable];
+    if (archives != nil && indexes != nil) {
+        NSMutableArray<ORKStepResultArchive *> *resultArchives = [NSMutableArray new];
+        if (entries != nil) {
+            for (id object in entries) {
+                NSArray *entry = ORKDynamicCast(object, NSArray);
+                NSNumber *archiveIndex = ORKDynamicCast(entry.firstObject, NSNumber);
+                NSData *data = (archiveIndex.unsignedIntegerValue < archives.count) ? ORKDynamicCast(archives[archiveIndex.unsignedIntegerValue], NSData) : nil;
+                NSArray *dates = (entry.count > 0) ? [entry subarrayWithRange:NSMakeRange(1, entry.count - 1)] : @[];
+                [resultArchives addObject:[[ORKStepResultArchive alloc] initWithData:data ? : [NSData data] dates:dates]];
+            }
+        } else {
+            // Restoration data with one archive per result, dates included
+            for (id data in archives) {
+                [resultArchives addObject:[[ORKStepResultArchive alloc] initWithData:ORKDynamicCast(data, NSData) ? : [NSData data] dates:@[]]];
+            }
+        }
+        NSIndexSet *saveableIndexes = [coder decodeObjectOfClass:[NSIndexSet class] forKey:_ORKManagedResultSaveableIndexesRestoreKey];
+        _managedResults = [NSMutableDictionary new];
+        _archivedResults = [[ORKArchivedStepResults alloc] initWithArchives:resultArchives saveableIndexes:saveableIndexes];
+        _pendingResultIndexes = [indexes mutableCopy];
+    } else {
+        // Restoration data saved before results were archived individually
+        _managedResults = [coder decodeObjectOfClass:[NSMutableDictionary class] forKey:_ORKManagedResultsRestoreKey];
+        _archivedResults = nil;
+        _pendingResultIndexes = nil;
+    }
+}
+
 - (void)decodeRestorableStateWithCoder:(NSCoder *)coder {
     [super decodeRestorableStateWithCoder:coder];
     
@@ -1631,14 +2110,16 @@ static NSString *const _ORKPresentedDate = @"presentedDate";
     self.showsProgressInNavigationBar = [coder decodeBoolForKey:_ORKShowsProgressInNavigationBarRestoreKey];
     
     _outputDirectory = ORKURLFromBookmarkData([coder decodeObjectOfClass:[NSData class] forKey:_ORKOutputDirectoryRestoreKey]);
+    _outputDirectoryBookmarkData = nil;
     [self ensureDirectoryExists:_outputDirectory];
     
     // Must have a task object already provided by this point in the restoration, in order to restore any other state.
     if (_task) {
         
         // Recover partially entered results, even if we may not be able to jump to the desired step.
-        _managedResults = [coder decodeObjectOfClass:[NSMutableDictionary class] forKey:_ORKManagedResultsRestoreKey];
+        [self decodeManagedResultsWithCoder:coder];
         _managedStepIdentifiers = [coder decodeObjectOfClass:[NSMutableArray class] forKey:_ORKManagedStepIdentifiersRestoreKey];
+        [self resetOrderedManagedResults];
         
         _restoredTaskIdentifier = [coder decodeObjectOfClass:[NSString class] forKey:_ORKTaskIdentifierRestoreKey];
         if (_restoredTaskIdentifier) {
@@ -46,6 +46,16 @@ NS_ASSUME_NONNULL_BEGIN
 @property (nonatomic, weak, nullable) UIScrollView *registeredScrollView;
 @property (nonatomic, assign) BOOL lastStepHadProgressBarHidden;
 
+- (void)setManagedResult:(ORKStepResult *)result forKey:(NSString *)aKey;
+- (nullable ORKStepResult *)managedResultForKey:(id <NSCopying>)key;
+- (NSArray *)managedResults;
+- (void)addManagedStepIdentifier:(NSString *)identifier;
+- (void)removeLastManagedStepIdentifier;
+- (void)removeAllManagedStepIdentifiers;
+
+- (void)encodeManagedResultsWithCoder:(NSCoder *)coder;
+- (void)decodeManagedResultsWithCoder:(NSCoder *)coder;
+
 @end
 
 NS_ASSUME_NONNULL_END
@@ -46,8 +46,22 @@ NS_ASSUME_NONNULL_BEGIN
 
 @property (nonatomic, strong, nullable) id answer;
 
+@property (nonatomic, readonly) BOOL immediateNavigation;
+
+// Restricts the rows to choices whose text or detail text matches the query, in their original order.
+// The search index is built the first time a non-empty query is set.
+@property (nonatomic, copy, nullable) NSString *filterQuery;
+
+// Returns a cell owned by the group, which keeps one cell per choice.
 - (nullable ORKChoiceViewCell *)cellAtIndexPath:(NSIndexPath *)indexPath withReuseIdentifier:(nullable NSString *)identifier;
 
+// Configures a cell dequeued by the table view, or a new one if `cell` is nil, so only visible rows hold cells.
+- (nullable ORKChoiceViewCell *)cellAtIndexPath:(NSIndexPath *)indexPath
+                                    reusingCell:(nullable ORKChoiceViewCell *)cell
+                            withReuseIdentifier:(NSString *)identifier;
+
+- (NSUInteger)choiceIndexAtIndexPath:(NSIndexPath *)indexPath;
+
 - (BOOL)containsIndexPath:(NSIndexPath *)indexPath;
 
 - (void)didSelectCellAtIndexPath:(NSIndexPath *)indexPath;
@@ -56,8 +70,11 @@ NS_ASSUME_NONNULL_BEGIN
 
 - (nullable id)answerForBoolean;
 
+// The number of rows, which is less than `choiceCount` while a filter is applied.
 - (NSUInteger)size;
 
+- (NSUInteger)choiceCount;
+
 @end
 
 NS_ASSUME_NONNULL_END
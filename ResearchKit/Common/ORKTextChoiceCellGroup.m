@@ -38,16 +38,23 @@
 
 #import "ORKAnswerFormat_Internal.h"
 #import "ORKChoiceAnswerFormatHelper.h"
+#import "ORKTextChoiceSearchIndex.h"
 
 
 @implementation ORKTextChoiceCellGroup {
     ORKChoiceAnswerFormatHelper *_helper;
+    ORKTextChoiceSearchIndex *_searchIndex;
     BOOL _singleChoice;
-    BOOL _immediateNavigation;
     NSIndexPath *_beginningIndexPath;
     ORKChoiceDescriptionStyle _descriptionStyle;
     
+    // Selection is kept by choice index, so it does not depend on which cells exist.
+    NSMutableIndexSet *_selectedIndexes;
+    // Choice indexes shown as rows while a filter is applied; nil shows every choice.
+    NSArray<NSNumber *> *_filteredChoiceIndexes;
+    
     NSMutableDictionary *_cells;
+    NSMapTable<ORKChoiceViewCell *, NSNumber *> *_reusedCells;
 }
 
 - (instancetype)initWithTextChoiceAnswerFormat:(ORKTextChoiceAnswerFormat *)answerFormat
@@ -57,10 +64,12 @@
     self = [super init];
     if (self) {
         _beginningIndexPath = indexPath;
-        _helper = [[ORKChoiceAnswerFormatHelper alloc] initWithAnswerFormat:answerFormat];
+        _helper = [ORKChoiceAnswerFormatHelper helperForAnswerFormat:answerFormat];
         _singleChoice = answerFormat.style == ORKChoiceAnswerStyleSingleChoice;
         _immediateNavigation = immediateNavigation;
+        _selectedIndexes = [NSMutableIndexSet new];
         _cells = [NSMutableDictionary new];
+        _reusedCells = [NSMapTable weakToStrongObjectsMapTable];
         _descriptionStyle = answerFormat.descriptionStyle;
         [self setAnswer:answer];
     }
@@ -68,6 +77,10 @@
 }
 
 - (NSUInteger)size {
+    return _filteredChoiceIndexes ? _filteredChoiceIndexes.count : [_helper choiceCount];
+}
+
+- (NSUInteger)choiceCount {
     return [_helper choiceCount];
 }
 
@@ -77,24 +90,80 @@
     [self setSelectedIndexes:[_helper selectedIndexesForAnswer:answer]];
 }
 
+- (void)setFilterQuery:(NSString *)filterQuery {
+    _filterQuery = [filterQuery copy];
+    
+    if (_filterQuery.length == 0) {
+        _filteredChoiceIndexes = nil;
+        return;
+    }
+    
+    if (!_searchIndex) {
+        NSMutableArray<ORKTextChoice *> *textChoices = [NSMutableArray arrayWithCapacity:[_helper choiceCount]];
+        for (NSUInteger index = 0; index < [_helper choiceCount]; index++) {
+            [textChoices addObject:[_helper textChoiceAtIndex:index]];
+        }
+        _searchIndex = [[ORKTextChoiceSearchIndex alloc] initWithTextChoices:textChoices];
+    }
+    
+    NSIndexSet *matchingIndexes = [_searchIndex indexesOfTextChoicesMatchingQuery:_filterQuery];
+    NSMutableArray<NSNumber *> *filteredChoiceIndexes = [NSMutableArray arrayWithCapacity:matchingIndexes.count];
+    [matchingIndexes enumerateIndexesUsingBlock:^(NSUInteger index, BOOL *stop) {
+        [filteredChoiceIndexes addObject:@(index)];
+    }];
+    _filteredChoiceIndexes = [filteredChoiceIndexes copy];
+}
+
+- (NSUInteger)choiceIndexAtIndexPath:(NSIndexPath *)indexPath {
+    if ([self containsIndexPath:indexPath] == NO) {
+        return NSNotFound;
+    }
+    
+    NSUInteger row = indexPath.row - _beginningIndexPath.row;
+    return _filteredChoiceIndexes ? _filteredChoiceIndexes[row].unsignedIntegerValue : row;
+}
+
 - (ORKChoiceViewCell *)cellAtIndexPath:(NSIndexPath *)indexPath withReuseIdentifier:(NSString *)identifier {
     if ([self containsIndexPath:indexPath] == NO) {
         return nil;
     }
     
-    return [self cellAtIndex:indexPath.row-_beginningIndexPath.row withReuseIdentifier:identifier];
+    return [self cellAtIndex:[self choiceIndexAtIndexPath:indexPath] withReuseIdentifier:identifier];
+}
+
+- (ORKChoiceViewCell *)cellAtIndexPath:(NSIndexPath *)indexPath reusingCell:(ORKChoiceViewCell *)cell withReuseIdentifier:(NSString *)identifier {
+    if ([self containsIndexPath:indexPath] == NO) {
+        return nil;
+    }
+    
+    NSUInteger index = [self choiceIndexAtIndexPath:indexPath];
+    if (cell == nil) {
+        cell = [self makeCellWithReuseIdentifier:identifier];
+    }
+    
+    // The cell may have shown another choice before being reused, so only the latest index is remembered.
+    [_reusedCells setObject:@(index) forKey:cell];
+    cell.selectedItem = [_selectedIndexes containsIndex:index];
+    [self updateLabelsForCell:cell atIndex:index];
+    
+    return cell;
+}
+
+- (ORKChoiceViewCell *)makeCellWithReuseIdentifier:(NSString *)identifier {
+    ORKChoiceViewCell *cell = [[ORKChoiceViewCell alloc] initWithStyle:UITableViewCellStyleDefault reuseIdentifier:identifier];
+    cell.immediateNavigation = _immediateNavigation;
+    return cell;
 }
 
 - (ORKChoiceViewCell *)cellAtIndex:(NSUInteger)index withReuseIdentifier:(NSString *)identifier {
     ORKChoiceViewCell *cell = _cells[@(index)];
     
     if (cell == nil) {
-        cell = [[ORKChoiceViewCell alloc] initWithStyle:UITableViewCellStyleDefault reuseIdentifier:identifier];
-        cell.immediateNavigation = _immediateNavigation;
+        cell = [self makeCellWithReuseIdentifier:identifier];
         
         _cells[@(index)] = cell;
         
-        [self setSelectedIndexes:[_helper selectedIndexesForAnswer:_answer]];
+        cell.selectedItem = [_selectedIndexes containsIndex:index];
     }
     
     [self updateLabelsForCell:cell atIndex:index];
@@ -126,29 +195,29 @@
 }
 
 - (void)didSelectCellAtIndex:(NSUInteger)index {
-    ORKChoiceViewCell *touchedCell = [self cellAtIndex:index withReuseIdentifier:nil];
-        
+    if (index >= [_helper choiceCount]) {
+        return;
+    }
+    
     if (_singleChoice) {
-        touchedCell.selectedItem = YES;
-        for (ORKChoiceViewCell *cell in _cells.allValues) {
-            if (cell != touchedCell) {
-                cell.selectedItem = NO;
-            }
-        }
+        [_selectedIndexes removeAllIndexes];
+        [_selectedIndexes addIndex:index];
+    } else if ([_selectedIndexes containsIndex:index]) {
+        [_selectedIndexes removeIndex:index];
     } else {
-        touchedCell.selectedItem = !touchedCell.selectedItem;
-        if (touchedCell.selectedItem) {
-            ORKTextChoice *touchedChoice = [_helper textChoiceAtIndex:index];
-            for (NSNumber *num in _cells.allKeys) {
-                ORKChoiceViewCell *cell = _cells[num];
-                ORKTextChoice *choice = [_helper textChoiceAtIndex:num.unsignedIntegerValue];
-                if (cell != touchedCell && (touchedChoice.exclusive || (cell.selectedItem && choice.exclusive))) {
-                    cell.selectedItem = NO;
-                }
-            }
+        ORKTextChoice *touchedChoice = [_helper textChoiceAtIndex:index];
+        if (touchedChoice.exclusive) {
+            [_selectedIndexes removeAllIndexes];
+        } else {
+            [_selectedIndexes removeIndexesPassingTest:^BOOL(NSUInteger selectedIndex, BOOL *stop) {
+                return [self->_helper textChoiceAtIndex:selectedIndex].exclusive;
+            }];
         }
+        [_selectedIndexes addIndex:index];
     }
     
+    [self updateSelectionForCells];
+    
     _answer = [_helper answerForSelectedIndexes:[self selectedIndexes]];
 }
 
@@ -156,11 +225,11 @@
     if ([self containsIndexPath:indexPath]== NO) {
         return;
     }
-    [self didSelectCellAtIndex:indexPath.row - _beginningIndexPath.row];
+    [self didSelectCellAtIndex:[self choiceIndexAtIndexPath:indexPath]];
 }
 
 - (BOOL)containsIndexPath:(NSIndexPath *)indexPath {
-    NSUInteger count = _helper.choiceCount;
+    NSUInteger count = self.size;
     
     return (indexPath.section == _beginningIndexPath.section) &&
             (indexPath.row >= _beginningIndexPath.row) &&
@@ -168,31 +237,30 @@
 }
 
 - (void)setSelectedIndexes:(NSArray *)indexes {
-    for (NSUInteger index = 0; index < self.size; index++ ) {
-        BOOL selected = [indexes containsObject:@(index)];
-        
-        if (selected) {
-            // In case the cell has not been created, need to create cell
-            ORKChoiceViewCell *cell = [self cellAtIndex:index withReuseIdentifier:nil];
-            cell.selectedItem = YES;
-        } else {
-            // It is ok to not create the cell at here
-            ORKChoiceViewCell *cell = _cells[@(index)];
-            cell.selectedItem = NO;
+    [_selectedIndexes removeAllIndexes];
+    for (NSNumber *index in indexes) {
+        if (index.unsignedIntegerValue < [_helper choiceCount]) {
+            [_selectedIndexes addIndex:index.unsignedIntegerValue];
         }
     }
+    
+    [self updateSelectionForCells];
 }
 
-- (NSArray *)selectedIndexes {
-    NSMutableArray *indexes = [NSMutableArray new];
-    
-    for (NSUInteger index = 0; index < self.size; index++ ) {
-        ORKChoiceViewCell *cell = _cells[@(index)];
-        if (cell.selectedItem) {
-            [indexes addObject:@(index)];
-        }
+- (void)updateSelectionForCells {
+    [_cells enumerateKeysAndObjectsUsingBlock:^(NSNumber *index, ORKChoiceViewCell *cell, BOOL *stop) {
+        cell.selectedItem = [self->_selectedIndexes containsIndex:index.unsignedIntegerValue];
+    }];
+    for (ORKChoiceViewCell *cell in _reusedCells) {
+        cell.selectedItem = [_selectedIndexes containsIndex:[_reusedCells objectForKey:cell].unsignedIntegerValue];
     }
-    
+}
+
+- (NSArray *)selectedIndexes {
+    NSMutableArray *indexes = [NSMutableArray arrayWithCapacity:_selectedIndexes.count];
+    [_selectedIndexes enumerateIndexesUsingBlock:^(NSUInteger index, BOOL *stop) {
+        [indexes addObject:@(index)];
+    }];
     return [indexes copy];
 }
 
@@ -0,0 +1,143 @@
+/*
+ Copyright (c) 2026, CareEvolution, Inc.
+ 
+ Redistribution and use in source and binary forms, with or without modification,
+ are permitted provided that the following conditions are met:
+ 
+ 1.  Redistributions of source code must retain the above copyright notice, this
+ list of conditions and the following disclaimer.
+ 
+ 2.  Redistributions in binary form must reproduce the above copyright notice,
+ this list of conditions and the following disclaimer in the documentation and/or
+ other materials provided with the distribution.
+ 
+ 3.  Neither the name of the copyright holder(s) nor the names of any contributors
+ may be used to endorse or promote products derived from this software without
+ specific prior written permission. No license is granted to the trademarks of
+ the copyright holders even if such marks are included in this software.
+ 
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE
+ FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#import "ORKTextChoiceSearchIndex.h"
+
+#import "ORKAnswerFormat.h"
+
+#import "ORKHelpers_Internal.h"
+
+
+static const NSUInteger ORKTextChoiceSearchGramLength = 3;
+
+static NSString *ORKTextChoiceSearchNormalizedString(NSString *string) {
+    if (string.length == 0) {
+        return @"";
+    }
+    return [string stringByFoldingWithOptions:NSCaseInsensitiveSearch | NSDiacriticInsensitiveSearch | NSWidthInsensitiveSearch
+                                       locale:[NSLocale currentLocale]];
+}
+
+@implementation ORKTextChoiceSearchIndex {
+    NSArray<NSString *> *_normalizedTexts;
+    NSDictionary<NSString *, NSIndexSet *> *_indexesForTrigram;
+    NSDictionary<NSString *, NSIndexSet *> *_indexesForWordPrefix;
+}
+
+- (instancetype)initWithTextChoices:(NSArray<ORKTextChoice *> *)textChoices {
+    self = [super init];
+    if (self) {
+        NSMutableArray<NSString *> *normalizedTexts = [NSMutableArray arrayWithCapacity:textChoices.count];
+        NSMutableDictionary<NSString *, NSMutableIndexSet *> *indexesForTrigram = [NSMutableDictionary new];
+        NSMutableDictionary<NSString *, NSMutableIndexSet *> *indexesForWordPrefix = [NSMutableDictionary new];
+        
+        [textChoices enumerateObjectsUsingBlock:^(ORKTextChoice *textChoice, NSUInteger idx, BOOL *stop) {
+            // Text and detail text are separated by a newline, which no query can span.
+            NSString *normalizedText = ORKTextChoiceSearchNormalizedString(textChoice.text);
+            NSString *normalizedDetailText = ORKTextChoiceSearchNormalizedString(textChoice.detailText);
+            if (normalizedDetailText.length > 0) {
+                normalizedText = [NSString stringWithFormat:@"%@\n%@", normalizedText, normalizedDetailText];
+            }
+            [normalizedTexts addObject:normalizedText];
+            
+            NSUInteger length = normalizedText.length;
+            for (NSUInteger location = 0; location + ORKTextChoiceSearchGramLength <= length; location++) {
+                NSString *trigram = [normalizedText substringWithRange:NSMakeRange(location, ORKTextChoiceSearchGramLength)];
+                NSMutableIndexSet *indexes = indexesForTrigram[trigram];
+                if (!indexes) {
+                    indexes = [NSMutableIndexSet new];
+                    indexesForTrigram[trigram] = indexes;
+                }
+                [indexes addIndex:idx];
+            }
+            
+            [normalizedText enumerateSubstringsInRange:NSMakeRange(0, length)
+                                               options:NSStringEnumerationByWords
+                                            usingBlock:^(NSString *word, NSRange wordRange, NSRange enclosingRange, BOOL *stopWords) {
+                for (NSUInteger prefixLength = 1; prefixLength < ORKTextChoiceSearchGramLength && prefixLength <= word.length; prefixLength++) {
+                    NSString *prefix = [word substringToIndex:prefixLength];
+                    NSMutableIndexSet *indexes = indexesForWordPrefix[prefix];
+                    if (!indexes) {
+                        indexes = [NSMutableIndexSet new];
+                        indexesForWordPrefix[prefix] = indexes;
+                    }
+                    [indexes addIndex:idx];
+                }
+            }];
+        }];
+        
+        _normalizedTexts = [normalizedTexts copy];
+        _indexesForTrigram = [indexesForTrigram copy];
+        _indexesForWordPrefix = [indexesForWordPrefix copy];
+    }
+    return self;
+}
+
+- (NSUInteger)count {
+    return _normalizedTexts.count;
+}
+
+- (NSIndexSet *)indexesOfTextChoicesMatchingQuery:(NSString *)query {
+    NSString *trimmedQuery = [query stringByTrimmingCharactersInSet:[NSCharacterSet whitespaceAndNewlineCharacterSet]];
+    NSString *normalizedQuery = ORKTextChoiceSearchNormalizedString(trimmedQuery);
+    NSUInteger length = normalizedQuery.length;
+    
+    if (length == 0) {
+        return [NSIndexSet indexSetWithIndexesInRange:NSMakeRange(0, _normalizedTexts.count)];
+    }
+    
+    if (length < ORKTextChoiceSearchGramLength) {
+        return [_indexesForWordPrefix[normalizedQuery] copy] ?: [NSIndexSet indexSet];
+    }
+    
+    // Every trigram of the query occurs in a matching choice, so the rarest one bounds the candidates.
+    NSIndexSet *candidates = nil;
+    for (NSUInteger location = 0; location + ORKTextChoiceSearchGramLength <= length; location++) {
+        NSString *trigram = [normalizedQuery substringWithRange:NSMakeRange(location, ORKTextChoiceSearchGramLength)];
+        NSIndexSet *indexes = _indexesForTrigram[trigram];
+        if (indexes.count == 0) {
+            return [NSIndexSet indexSet];
+        }
+        if (!candidates || indexes.count < candidates.count) {
+            candidates = indexes;
+        }
+    }
+    
+    NSMutableIndexSet *matchingIndexes = [NSMutableIndexSet new];
+    [candidates enumerateIndexesUsingBlock:^(NSUInteger index, BOOL *stop) {
+        if ([self->_normalizedTexts[index] rangeOfString:normalizedQuery options:NSLiteralSearch].location != NSNotFound) {
+            [matchingIndexes addIndex:index];
+        }
+    }];
+    return matchingIndexes;
+}
+
+@end
@@ -60,7 +60,7 @@ static const CGFloat PickerMinimumHeight = 34.0;
     if (self) {
         NSAssert([answerFormat isKindOfClass:[ORKValuePickerAnswerFormat class]], @"answerFormat should be ORKValuePickerAnswerFormat");
         
-        self.helper = [[ORKChoiceAnswerFormatHelper alloc] initWithAnswerFormat:answerFormat];
+        self.helper = [ORKChoiceAnswerFormatHelper helperForAnswerFormat:answerFormat];
         self.answer = answer;
         _pickerDelegate = delegate;
     
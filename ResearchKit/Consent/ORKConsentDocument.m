@@ -37,6 +37,7 @@
 #import "ORKHeadlineLabel.h"
 #import "ORKSubheadlineLabel.h"
 
+#import "ORKConsentPDFComposer.h"
 #import "ORKConsentSection_Private.h"
 #import "ORKConsentSectionFormatter.h"
 #import "ORKConsentSignature.h"
@@ -47,8 +48,24 @@
 #import "ORKErrors.h"
 
 
+@interface ORKConsentSectionHTMLFragment : NSObject
+
+@property (nonatomic) NSUInteger renderingVersion;
+@property (nonatomic, copy) NSString *html;
+
+@end
+
+
+@implementation ORKConsentSectionHTMLFragment
+
+@end
+
+
 @implementation ORKConsentDocument {
     NSMutableArray<ORKConsentSignature *> *_signatures;
+    
+    // Rendered section HTML, keyed by section identity and reused until the section changes.
+    NSMapTable<ORKConsentSection *, ORKConsentSectionHTMLFragment *> *_sectionHTMLFragments;
 }
 
 #pragma mark - Initializers
@@ -64,6 +81,7 @@
             consentSignatureFormatter:(ORKConsentSignatureFormatter *)signatureFormatter{
     if (self = [super init]) {
         _writer = writer;
+        _composer = [[ORKConsentPDFComposer alloc] init];
         _sectionFormatter = sectionFormatter;
         _signatureFormatter = signatureFormatter;
     }
@@ -72,6 +90,11 @@
 
 #pragma mark - Accessors
 
+- (void)setSectionFormatter:(ORKConsentSectionFormatter *)sectionFormatter {
+    _sectionFormatter = sectionFormatter;
+    [_sectionHTMLFragments removeAllObjects];
+}
+
 - (void)setSignatures:(NSArray<ORKConsentSignature *> *)signatures {
     _signatures = [signatures mutableCopy];
 }
@@ -90,6 +113,11 @@
 }
 
 - (void)makePDFWithCompletionHandler:(void (^)(NSData *data, NSError *error))completionBlock {
+    if ([self canComposeNativePDF]) {
+        [_composer composePDFForDocument:self completionBlock:completionBlock];
+        return;
+    }
+    
     [_writer writePDFFromHTML:[self htmlForMobile:NO title:nil detail:nil]
           completionBlock:^(NSData *data, NSError *error) {
         if (error) {
@@ -119,11 +147,63 @@
 
 #pragma mark - Private
 
+/*
+ The native composer only understands plain text. Anything that carries markup, or custom
+ formatters that may emit it, still goes through the HTML writer.
+ */
+- (BOOL)canComposeNativePDF {
+    if (_composer == nil || _htmlReviewContent != nil) {
+        return NO;
+    }
+    if ([_sectionFormatter class] != [ORKConsentSectionFormatter class] ||
+        [_signatureFormatter class] != [ORKConsentSignatureFormatter class]) {
+        return NO;
+    }
+    
+    NSCharacterSet *markupCharacters = [NSCharacterSet characterSetWithCharactersInString:@"<&"];
+    for (NSString *string in @[_title ? : @"", _signaturePageTitle ? : @"", _signaturePageContent ? : @""]) {
+        if ([string rangeOfCharacterFromSet:markupCharacters].location != NSNotFound) {
+            return NO;
+        }
+    }
+    for (ORKConsentSection *section in _sections) {
+        if (section.omitFromDocument) {
+            continue;
+        }
+        // The section formatter inserts titles into the HTML as they are, so they may carry markup too.
+        if (section.htmlContent != nil ||
+            [section.title rangeOfCharacterFromSet:markupCharacters].location != NSNotFound ||
+            [section.formalTitle rangeOfCharacterFromSet:markupCharacters].location != NSNotFound) {
+            return NO;
+        }
+    }
+    return YES;
+}
+
 - (NSString *)mobileHTMLWithTitle:(NSString *)title detail:(NSString *)detail {
     return [self htmlForMobile:YES title:title detail:detail];
 }
 
 + (NSString *)cssStyleSheet:(BOOL)mobile {
+    static NSCache<NSString *, NSString *> *cache;
+    static dispatch_once_t onceToken;
+    dispatch_once(&onceToken, ^{
+        cache = [NSCache new];
+    });
+    
+    // The mobile sheet only varies with the Dynamic Type sizes it reads, so key it on them.
+    NSString *key = mobile ? [NSString stringWithFormat:@"mobile-%g-%g",
+                              [[ORKHeadlineLabel defaultFont] pointSize],
+                              [[ORKSubheadlineLabel defaultFont] pointSize]] : @"print";
+    NSString *css = [cache objectForKey:key];
+    if (css == nil) {
+        css = [self makeCSSStyleSheet:mobile];
+        [cache setObject:css forKey:key];
+    }
+    return css;
+}
+
++ (NSString *)makeCSSStyleSheet:(BOOL)mobile {
     NSMutableString *css = [@"@media print { .pagebreak { page-break-before: always; } }\n" mutableCopy];
     if (mobile) {
         [css appendString:@".header { margin-top: 36px ; margin-bottom: 30px; text-align: center; }\n"];
@@ -167,7 +247,24 @@
     [css appendString:@".grid:after { content: \"\"; display: table; clear: both; }\n"];
     [css appendString:@".border { -webkit-box-sizing: border-box; box-sizing: border-box; }\n"];
     
-    return css;
+    return [css copy];
+}
+
+- (NSString *)HTMLForSection:(ORKConsentSection *)section {
+    if (_sectionHTMLFragments == nil) {
+        _sectionHTMLFragments = [[NSMapTable alloc] initWithKeyOptions:NSPointerFunctionsWeakMemory | NSPointerFunctionsObjectPointerPersonality
+                                                          valueOptions:NSPointerFunctionsStrongMemory
+                                                              capacity:_sections.count];
+    }
+    
+    ORKConsentSectionHTMLFragment *fragment = [_sectionHTMLFragments objectForKey:section];
+    if (fragment == nil || fragment.renderingVersion != section.renderingVersion) {
+        fragment = [ORKConsentSectionHTMLFragment new];
+        fragment.renderingVersion = section.renderingVersion;
+        fragment.html = [_sectionFormatter HTMLForSection:section] ? : @"";
+        [_sectionHTMLFragments setObject:fragment forKey:section];
+    }
+    return fragment.html;
 }
 
 + (NSString *)wrapHTMLBody:(NSString *)body mobile:(BOOL)mobile {
@@ -186,38 +283,47 @@
     NSMutableString *body = [NSMutableString new];
     
     // header
-    [body appendFormat:@"<div class='header'>"];
+    [body appendString:@"<div class='header'>"];
     if (title) {
-        [body appendFormat:@"<h1>%@</h1>", title];
+        [body appendString:@"<h1>"];
+        [body appendString:title];
+        [body appendString:@"</h1>"];
     }
     
     if (detail) {
-        [body appendFormat:@"<p>%@</p>", detail];
+        [body appendString:@"<p>"];
+        [body appendString:detail];
+        [body appendString:@"</p>"];
     }
-    [body appendFormat:@"</div>"];
+    [body appendString:@"</div>"];
     
     if (_htmlReviewContent) {
         [body appendString:_htmlReviewContent];
     } else {
         
         // title
-        [body appendFormat:@"<h3>%@</h3>", _title ? : @""];
+        [body appendString:@"<h3>"];
+        [body appendString:_title ? : @""];
+        [body appendString:@"</h3>"];
         
         // scenes
         for (ORKConsentSection *section in _sections) {
             if (!section.omitFromDocument) {
-                [body appendFormat:@"%@", [_sectionFormatter HTMLForSection:section]];
+                [body appendString:[self HTMLForSection:section]];
             }
         }
     }
     
     if (!mobile) {
         // page break
-        [body appendFormat:@"<h4 class=\"pagebreak\">%@</h4>", _signaturePageTitle ? : @""];
-        [body appendFormat:@"<p>%@</p>", _signaturePageContent ? : @""];
+        [body appendString:@"<h4 class=\"pagebreak\">"];
+        [body appendString:_signaturePageTitle ? : @""];
+        [body appendString:@"</h4><p>"];
+        [body appendString:_signaturePageContent ? : @""];
+        [body appendString:@"</p>"];
         
-        for (ORKConsentSignature *signature in self.signatures) {
-            [body appendFormat:@"%@", [_signatureFormatter HTMLForSignature:signature]];
+        for (ORKConsentSignature *signature in _signatures) {
+            [body appendString:[_signatureFormatter HTMLForSignature:signature]];
         }
     }
     
@@ -35,6 +35,7 @@
 
 NS_ASSUME_NONNULL_BEGIN
 
+@class ORKConsentPDFComposer;
 @class ORKHTMLPDFWriter;
 @class ORKConsentSectionFormatter;
 @class ORKConsentSignatureFormatter;
@@ -42,6 +43,7 @@ NS_ASSUME_NONNULL_BEGIN
 @interface ORKConsentDocument ()
 
 @property (nonatomic, strong, nullable) ORKHTMLPDFWriter *writer;
+@property (nonatomic, strong, nullable) ORKConsentPDFComposer *composer;
 @property (nonatomic, strong, nullable) ORKConsentSectionFormatter *sectionFormatter;
 @property (nonatomic, strong, nullable) ORKConsentSignatureFormatter *signatureFormatter;
 
@@ -0,0 +1,69 @@
+/*
+ Copyright (c) 2026, CareEvolution, Inc.
+ 
+ Redistribution and use in source and binary forms, with or without modification,
+ are permitted provided that the following conditions are met:
+ 
+ 1.  Redistributions of source code must retain the above copyright notice, this
+ list of conditions and the following disclaimer.
+ 
+ 2.  Redistributions in binary form must reproduce the above copyright notice,
+ this list of conditions and the following disclaimer in the documentation and/or
+ other materials provided with the distribution.
+ 
+ 3.  Neither the name of the copyright holder(s) nor the names of any contributors
+ may be used to endorse or promote products derived from this software without
+ specific prior written permission. No license is granted to the trademarks of
+ the copyright holders even if such marks are included in this software.
+ 
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE
+ FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+@import UIKit;
+#import "ORKDefines.h"
+
+
+NS_ASSUME_NONNULL_BEGIN
+
+@class ORKConsentDocument;
+
+/**
+ Lays out a consent document directly into PDF pages with TextKit, without going through HTML
+ and an offscreen web view.
+ 
+ The composer handles documents made of plain-text sections: it renders the document title,
+ each section's formal title and content, the signature page, and one row per signature using
+ the same page size, margins, and page-number footer as `ORKHTMLPDFWriter`. Documents that rely on
+ HTML (review content, section HTML, or custom formatters) must still go through the writer.
+ */
+@interface ORKConsentPDFComposer : NSObject
+
+/// Page size used for new documents. Defaults to `+[ORKHTMLPDFWriter defaultPageSize]`.
+@property (nonatomic) CGSize pageSize;
+
+/**
+ Returns the PDF data for the document. Safe to call from any thread, as long as the document is
+ not mutated concurrently.
+ */
+- (NSData *)PDFDataForDocument:(ORKConsentDocument *)document;
+
+/**
+ Snapshots the document on the calling thread, composes the PDF on a background queue, and calls
+ the completion block on the main queue.
+ */
+- (void)composePDFForDocument:(ORKConsentDocument *)document
+              completionBlock:(void (^)(NSData * _Nullable data, NSError * _Nullable error))completionBlock;
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,370 @@
+/*
+ Copyright (c) 2026, CareEvolution, Inc.
+ 
+ Redistribution and use in source and binary forms, with or without modification,
+ are permitted provided that the following conditions are met:
+ 
+ 1.  Redistributions of source code must retain the above copyright notice, this
+ list of conditions and the following disclaimer.
+ 
+ 2.  Redistributions in binary form must reproduce the above copyright notice,
+ this list of conditions and the following disclaimer in the documentation and/or
+ other materials provided with the distribution.
+ 
+ 3.  Neither the name of the copyright holder(s) nor the names of any contributors
+ may be used to endorse or promote products derived from this software without
+ specific prior written permission. No license is granted to the trademarks of
+ the copyright holders even if such marks are included in this software.
+ 
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE
+ FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#import "ORKConsentPDFComposer.h"
+
+#import "ORKConsentDocument.h"
+#import "ORKConsentSection_Private.h"
+#import "ORKConsentSignature.h"
+#import "ORKHTMLPDFWriter.h"
+
+#import "ORKHelpers_Internal.h"
+
+
+// Page geometry matches ORKHTMLPDFWriter so both paths produce the same page frames.
+static const CGFloat ORKConsentPDFHeaderHeight = 25.0;
+static const CGFloat ORKConsentPDFFooterHeight = 25.0;
+static const CGFloat ORKConsentPDFPageEdge = 72.0 / 4;
+
+// Print metrics of the non-mobile consent style sheet (1em = 12pt, h3 = 1.17em).
+static const CGFloat ORKConsentPDFBodyFontSize = 12.0;
+static const CGFloat ORKConsentPDFTitleFontSize = 14.0;
+static const CGFloat ORKConsentPDFTitleTopMargin = 3 * ORKConsentPDFTitleFontSize;
+static const CGFloat ORKConsentPDFHeadingTopMargin = 16.0;
+
+static const CGFloat ORKConsentPDFSignatureColumnSpacing = 20.0;
+static const CGFloat ORKConsentPDFSignatureSingleColumnWidth = 200.0;
+static const CGFloat ORKConsentPDFSignatureRowTopMargin = 36.0;
+static const CGFloat ORKConsentPDFSignatureBoxHeight = 100.0;
+static const CGFloat ORKConsentPDFSignatureValueInset = 10.0;
+static const CGFloat ORKConsentPDFSignatureLineWidth = 1.0;
+static const CGFloat ORKConsentPDFSignatureCaptionSpacing = 4.0;
+
+typedef void (^ORKConsentPDFDrawBlock)(void);
+
+
+@interface ORKConsentPDFSignatureElement : NSObject
+
+@property (nonatomic, copy, nullable) NSString *value;
+@property (nonatomic, nullable) UIImage *image;
+@property (nonatomic, copy) NSString *caption;
+
+@end
+
+
+@implementation ORKConsentPDFSignatureElement
+
+@end
+
+
+/*
+ Everything the composer needs from the document, copied on the calling thread so that layout
+ and rendering can run on a background queue.
+ */
+@interface ORKConsentPDFSnapshot : NSObject
+
+@property (nonatomic, copy) NSAttributedString *body;
+@property (nonatomic, copy) NSAttributedString *signaturePage;
+@property (nonatomic, copy) NSArray<NSArray<ORKConsentPDFSignatureElement *> *> *signatureRows;
+@property (nonatomic, copy) NSDictionary<NSAttributedStringKey, id> *signatureAttributes;
+@property (nonatomic, copy) NSString *pageNumberFormat;
+@property (nonatomic) UIFont *footerFont;
+
+@end
+
+
+@implementation ORKConsentPDFSnapshot
+
+@end
+
+
+static void ORKConsentPDFAppendParagraph(NSMutableAttributedString *string, NSString *text, UIFont *font, CGFloat topMargin) {
+    NSMutableParagraphStyle *style = [NSMutableParagraphStyle new];
+    style.paragraphSpacingBefore = topMargin;
+    style.paragraphSpacing = font.pointSize;
+    
+    // Hard line breaks stay inside the paragraph, like the <br/> emitted for section content.
+    NSString *lines = [(text ? : @"") stringByReplacingOccurrencesOfString:@"\n" withString:@"\u2028"];
+    NSString *paragraph = [lines stringByAppendingString:@"\n"];
+    [string appendAttributedString:[[NSAttributedString alloc] initWithString:paragraph
+                                                                   attributes:@{ NSFontAttributeName: font,
+                                                                                 NSParagraphStyleAttributeName: style,
+                                                                                 NSForegroundColorAttributeName: [UIColor blackColor] }]];
+}
+
+/*
+ Flows the text through as many page-sized containers as it needs, starting on a new page.
+ Returns the bottom of the text on the last page.
+ */
+static CGFloat ORKConsentPDFLayoutText(NSAttributedString *text, CGRect contentRect, NSMutableArray<NSMutableArray<ORKConsentPDFDrawBlock> *> *pages) {
+    NSTextStorage *storage = [[NSTextStorage alloc] initWithAttributedString:text];
+    NSLayoutManager *layoutManager = [NSLayoutManager new];
+    [storage addLayoutManager:layoutManager];
+    
+    NSUInteger numberOfGlyphs = layoutManager.numberOfGlyphs;
+    NSUInteger location = 0;
+    CGFloat maxY = CGRectGetMinY(contentRect);
+    do {
+        NSTextContainer *container = [[NSTextContainer alloc] initWithSize:contentRect.size];
+        container.lineFragmentPadding = 0;
+        [layoutManager addTextContainer:container];
+        
+        NSRange glyphRange = [layoutManager glyphRangeForTextContainer:container];
+        if (glyphRange.length == 0 && numberOfGlyphs > 0) {
+            // Nothing fits on an empty page; stop instead of adding blank pages forever.
+            break;
+        }
+        
+        CGPoint origin = contentRect.origin;
+        NSMutableArray<ORKConsentPDFDrawBlock> *page = [NSMutableArray new];
+        [page addObject:^{
+            // The text storage owns the layout manager, which only references the storage weakly.
+            NSLayoutManager *pageLayoutManager = storage.layoutManagers.firstObject;
+            [pageLayoutManager drawBackgroundForGlyphRange:glyphRange atPoint:origin];
+            [pageLayoutManager drawGlyphsForGlyphRange:glyphRange atPoint:origin];
+        }];
+        [pages addObject:page];
+        
+        maxY = origin.y + CGRectGetMaxY([layoutManager usedRectForTextContainer:container]);
+        location = NSMaxRange(glyphRange);
+    } while (location < numberOfGlyphs);
+    
+    return maxY;
+}
+
+static void ORKConsentPDFDrawSignatureElement(ORKConsentPDFSignatureElement *element, CGRect frame, NSDictionary<NSAttributedStringKey, id> *attributes) {
+    CGRect boxRect = CGRectMake(CGRectGetMinX(frame), CGRectGetMinY(frame), CGRectGetWidth(frame), ORKConsentPDFSignatureBoxHeight);
+    
+    if (element.image) {
+        CGSize imageSize = element.image.size;
+        if (imageSize.width > 0 && imageSize.height > 0) {
+            CGFloat scale = MIN(CGRectGetWidth(boxRect) / imageSize.width, CGRectGetHeight(boxRect) / imageSize.height);
+            CGSize drawSize = CGSizeMake(imageSize.width * scale, imageSize.height * scale);
+            [element.image drawInRect:CGRectMake(CGRectGetMinX(boxRect), CGRectGetMaxY(boxRect) - drawSize.height, drawSize.width, drawSize.height)];
+        }
+    } else if (element.value.length > 0) {
+        CGFloat lineHeight = ceil(((UIFont *)attributes[NSFontAttributeName]).lineHeight);
+        CGRect valueRect = CGRectMake(CGRectGetMinX(boxRect), CGRectGetMaxY(boxRect) - ORKConsentPDFSignatureValueInset - lineHeight, CGRectGetWidth(boxRect), lineHeight);
+        [element.value drawWithRect:valueRect
+                            options:NSStringDrawingUsesLineFragmentOrigin | NSStringDrawingTruncatesLastVisibleLine
+                         attributes:attributes
+                            context:nil];
+    }
+    
+    [[UIColor blackColor] setFill];
+    UIRectFill(CGRectMake(CGRectGetMinX(boxRect), CGRectGetMaxY(boxRect), CGRectGetWidth(boxRect), ORKConsentPDFSignatureLineWidth));
+    
+    CGFloat captionY = CGRectGetMaxY(boxRect) + ORKConsentPDFSignatureLineWidth + ORKConsentPDFSignatureCaptionSpacing;
+    [element.caption drawWithRect:CGRectMake(CGRectGetMinX(frame), captionY, CGRectGetWidth(frame), CGRectGetMaxY(frame) - captionY)
+                          options:NSStringDrawingUsesLineFragmentOrigin
+                       attributes:attributes
+                          context:nil];
+}
+
+
+@implementation ORKConsentPDFComposer
+
+- (instancetype)init {
+    self = [super init];
+    if (self) {
+        _pageSize = [ORKHTMLPDFWriter defaultPageSize];
+    }
+    return self;
+}
+
+#pragma mark - Public
+
+- (NSData *)PDFDataForDocument:(ORKConsentDocument *)document {
+    return [[self class] PDFDataForSnapshot:[[self class] snapshotForDocument:document] pageSize:_pageSize];
+}
+
+- (void)composePDFForDocument:(ORKConsentDocument *)document
+              completionBlock:(void (^)(NSData *data, NSError *error))completionBlock {
+    ORKConsentPDFSnapshot *snapshot = [[self class] snapshotForDocument:document];
+    CGSize pageSize = _pageSize;
+    dispatch_async(dispatch_get_global_queue(QOS_CLASS_USER_INITIATED, 0), ^{
+        NSData *data = [[self class] PDFDataForSnapshot:snapshot pageSize:pageSize];
+        dispatch_async(dispatch_get_main_queue(), ^{
+            completionBlock(data, nil);
+        });
+    });
+}
+
+#pragma mark - Snapshot
+
++ (ORKConsentPDFSnapshot *)snapshotForDocument:(ORKConsentDocument *)document {
+    UIFont *bodyFont = [UIFont fontWithName:@"Helvetica" size:ORKConsentPDFBodyFontSize];
+    UIFont *titleFont = [UIFont fontWithName:@"Helvetica-Bold" size:ORKConsentPDFTitleFontSize];
+    UIFont *headingFont = [UIFont fontWithName:@"Helvetica-Bold" size:ORKConsentPDFBodyFontSize];
+    
+    NSMutableAttributedString *body = [NSMutableAttributedString new];
+    ORKConsentPDFAppendParagraph(body, document.title, titleFont, ORKConsentPDFTitleTopMargin);
+    for (ORKConsentSection *section in document.sections) {
+        if (section.omitFromDocument) {
+            continue;
+        }
+        ORKConsentPDFAppendParagraph(body, section.formalTitle ? : section.title, headingFont, ORKConsentPDFHeadingTopMargin);
+        ORKConsentPDFAppendParagraph(body, section.content, bodyFont, 0);
+    }
+    
+    NSMutableAttributedString *signaturePage = [NSMutableAttributedString new];
+    ORKConsentPDFAppendParagraph(signaturePage, document.signaturePageTitle, headingFont, ORKConsentPDFHeadingTopMargin);
+    ORKConsentPDFAppendParagraph(signaturePage, document.signaturePageContent, bodyFont, 0);
+    
+    NSMutableArray<NSArray<ORKConsentPDFSignatureElement *> *> *signatureRows = [NSMutableArray new];
+    for (ORKConsentSignature *signature in document.signatures) {
+        NSArray<ORKConsentPDFSignatureElement *> *elements = [self signatureElementsForSignature:signature];
+        if (elements.count > 0) {
+            [signatureRows addObject:elements];
+        }
+    }
+    
+    ORKConsentPDFSnapshot *snapshot = [ORKConsentPDFSnapshot new];
+    snapshot.body = body;
+    snapshot.signaturePage = signaturePage;
+    snapshot.signatureRows = signatureRows;
+    snapshot.signatureAttributes = @{ NSFontAttributeName: bodyFont, NSForegroundColorAttributeName: [UIColor blackColor] };
+    snapshot.pageNumberFormat = ORKLocalizedString(@"CONSENT_PAGE_NUMBER_FORMAT", nil);
+    snapshot.footerFont = bodyFont;
+    return snapshot;
+}
+
+// Mirrors the name, signature and date columns of -[ORKConsentSignatureFormatter HTMLForSignature:].
++ (NSArray<ORKConsentPDFSignatureElement *> *)signatureElementsForSignature:(ORKConsentSignature *)signature {
+    if (signature.title == nil) {
+        @throw [NSException exceptionWithName:NSObjectNotAvailableException reason:@"Signature title is missing" userInfo:nil];
+    }
+    
+    NSMutableArray<ORKConsentPDFSignatureElement *> *elements = [NSMutableArray new];
+    
+    if (signature.requiresName || signature.familyName || signature.givenName) {
+        NSMutableArray<NSString *> *names = [NSMutableArray new];
+        if (signature.givenName) {
+            [names addObject:signature.givenName];
+        }
+        if (signature.familyName) {
+            [names addObject:signature.familyName];
+        }
+        if (ORKCurrentLocalePresentsFamilyNameFirst()) {
+            names = [[[names reverseObjectEnumerator] allObjects] mutableCopy];
+        }
+        
+        ORKConsentPDFSignatureElement *element = [ORKConsentPDFSignatureElement new];
+        element.value = [names componentsJoinedByString:@" "];
+        element.caption = [NSString stringWithFormat:ORKLocalizedString(@"CONSENT_DOC_LINE_PRINTED_NAME", nil), signature.title];
+        [elements addObject:element];
+    }
+    
+    if (signature.requiresSignatureImage || signature.signatureImage) {
+        ORKConsentPDFSignatureElement *element = [ORKConsentPDFSignatureElement new];
+        element.image = signature.signatureImage;
+        element.caption = [NSString stringWithFormat:ORKLocalizedString(@"CONSENT_DOC_LINE_SIGNATURE", nil), signature.title];
+        [elements addObject:element];
+    }
+    
+    if (elements.count > 0) {
+        ORKConsentPDFSignatureElement *element = [ORKConsentPDFSignatureElement new];
+        element.value = signature.signatureDate;
+        element.caption = ORKLocalizedString(@"CONSENT_DOC_LINE_DATE", nil);
+        [elements addObject:element];
+    }
+    
+    return elements;
+}
+
+#pragma mark - Layout
+
++ (NSArray<NSArray<ORKConsentPDFDrawBlock> *> *)pagesForSnapshot:(ORKConsentPDFSnapshot *)snapshot contentRect:(CGRect)contentRect {
+    NSMutableArray<NSMutableArray<ORKConsentPDFDrawBlock> *> *pages = [NSMutableArray new];
+    
+    ORKConsentPDFLayoutText(snapshot.body, contentRect, pages);
+    
+    // The signature page always starts on a fresh page.
+    CGFloat cursor = ORKConsentPDFLayoutText(snapshot.signaturePage, contentRect, pages);
+    NSMutableArray<ORKConsentPDFDrawBlock> *page = pages.lastObject;
+    
+    NSDictionary<NSAttributedStringKey, id> *attributes = snapshot.signatureAttributes;
+    for (NSArray<ORKConsentPDFSignatureElement *> *row in snapshot.signatureRows) {
+        CGFloat columnWidth = (row.count > 1 ?
+                               CGRectGetWidth(contentRect) / 3 - ORKConsentPDFSignatureColumnSpacing :
+                               ORKConsentPDFSignatureSingleColumnWidth);
+        
+        CGFloat captionHeight = 0;
+        for (ORKConsentPDFSignatureElement *element in row) {
+            CGRect captionRect = [element.caption boundingRectWithSize:CGSizeMake(columnWidth, CGFLOAT_MAX)
+                                                               options:NSStringDrawingUsesLineFragmentOrigin
+                                                            attributes:attributes
+                                                               context:nil];
+            captionHeight = MAX(captionHeight, ceil(CGRectGetHeight(captionRect)));
+        }
+        
+        CGFloat columnHeight = (ORKConsentPDFSignatureBoxHeight + ORKConsentPDFSignatureLineWidth +
+                                ORKConsentPDFSignatureCaptionSpacing + captionHeight);
+        CGFloat rowHeight = ORKConsentPDFSignatureRowTopMargin + columnHeight;
+        if (cursor + rowHeight > CGRectGetMaxY(contentRect) && cursor > CGRectGetMinY(contentRect)) {
+            page = [NSMutableArray new];
+            [pages addObject:page];
+            cursor = CGRectGetMinY(contentRect);
+        }
+        
+        CGFloat columnY = cursor + ORKConsentPDFSignatureRowTopMargin;
+        [row enumerateObjectsUsingBlock:^(ORKConsentPDFSignatureElement *element, NSUInteger column, BOOL *stop) {
+            CGRect frame = CGRectMake(CGRectGetMinX(contentRect) + column * (columnWidth + ORKConsentPDFSignatureColumnSpacing),
+                                      columnY, columnWidth, columnHeight);
+            [page addObject:^{
+                ORKConsentPDFDrawSignatureElement(element, frame, attributes);
+            }];
+        }];
+        cursor += rowHeight;
+    }
+    
+    return pages;
+}
+
+#pragma mark - Rendering
+
++ (NSData *)PDFDataForSnapshot:(ORKConsentPDFSnapshot *)snapshot pageSize:(CGSize)pageSize {
+    CGRect paperRect = (CGRect){ CGPointZero, pageSize };
+    CGRect printableRect = UIEdgeInsetsInsetRect(paperRect, UIEdgeInsetsMake(ORKConsentPDFPageEdge, ORKConsentPDFPageEdge, ORKConsentPDFPageEdge, ORKConsentPDFPageEdge));
+    CGRect contentRect = UIEdgeInsetsInsetRect(printableRect, UIEdgeInsetsMake(ORKConsentPDFHeaderHeight, 0, ORKConsentPDFFooterHeight, 0));
+    CGRect footerRect = CGRectMake(CGRectGetMinX(printableRect), CGRectGetMaxY(contentRect), CGRectGetWidth(printableRect), ORKConsentPDFFooterHeight);
+    
+    NSArray<NSArray<ORKConsentPDFDrawBlock> *> *pages = [self pagesForSnapshot:snapshot contentRect:contentRect];
+    NSDictionary<NSAttributedStringKey, id> *footerAttributes = @{ NSFontAttributeName: snapshot.footerFont };
+    
+    UIGraphicsPDFRenderer *renderer = [[UIGraphicsPDFRenderer alloc] initWithBounds:paperRect];
+    return [renderer PDFDataWithActions:^(UIGraphicsPDFRendererContext *context) {
+        [pages enumerateObjectsUsingBlock:^(NSArray<ORKConsentPDFDrawBlock> *page, NSUInteger pageIndex, BOOL *stop) {
+            [context beginPage];
+            for (ORKConsentPDFDrawBlock draw in page) {
+                draw();
+            }
+            
+            // Same centered footer as ORKHTMLPDFPageRenderer.
+            NSString *footer = [NSString stringWithFormat:snapshot.pageNumberFormat, (long)(pageIndex + 1), (long)pages.count];
+            CGSize size = [footer sizeWithAttributes:footerAttributes];
+            CGPoint drawPoint = CGPointMake(CGRectGetMidX(footerRect) - size.width / 2, CGRectGetMidY(footerRect) - size.height / 2);
+            [footer drawAtPoint:drawPoint withAttributes:footerAttributes];
+        }];
+    }];
+}
+
+@end
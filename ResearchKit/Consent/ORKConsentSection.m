@@ -171,9 +171,35 @@ static NSString *localizedTitleForConsentSectionType(ORKConsentSectionType secti
     return YES;
 }
 
+- (void)setTitle:(NSString *)title {
+    _title = [title copy];
+    _renderingVersion++;
+}
+
+- (void)setFormalTitle:(NSString *)formalTitle {
+    _formalTitle = [formalTitle copy];
+    _renderingVersion++;
+}
+
+- (void)setSummary:(NSString *)summary {
+    _summary = [summary copy];
+    _renderingVersion++;
+}
+
 - (void)setContent:(NSString *)content {
-    _content = content;
+    _content = [content copy];
     _escapedContent = nil;
+    _renderingVersion++;
+}
+
+- (void)setHtmlContent:(NSString *)htmlContent {
+    _htmlContent = [htmlContent copy];
+    _renderingVersion++;
+}
+
+- (void)setContentURL:(NSURL *)contentURL {
+    _contentURL = [contentURL copy];
+    _renderingVersion++;
 }
 
 - (NSString *)escapedContent {
@@ -182,7 +208,7 @@ static NSString *localizedTitleForConsentSectionType(ORKConsentSectionType secti
     }
     
     if (_escapedContent == nil) {
-        _escapedContent = (__bridge NSString *)(CFXMLCreateStringByEscapingEntities(NULL, (__bridge CFStringRef)(_content), NULL));
+        _escapedContent = (__bridge_transfer NSString *)(CFXMLCreateStringByEscapingEntities(NULL, (__bridge CFStringRef)(_content), NULL));
         
         // Use <br/> to replace "\n"
         _escapedContent = [_escapedContent stringByReplacingOccurrencesOfString:@"\n" withString:@"<br/>"];
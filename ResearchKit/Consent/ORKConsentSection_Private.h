@@ -42,6 +42,9 @@ NSURL *ORKMovieURLForConsentSectionType(ORKConsentSectionType type);
 
 @property (nonatomic, readonly, nullable) UIImage *image;
 
+/// Incremented whenever a property that can appear in the section's rendered HTML changes.
+@property (nonatomic, readonly) NSUInteger renderingVersion;
+
 @end
 
 NS_ASSUME_NONNULL_END
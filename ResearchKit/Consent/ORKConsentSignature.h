@@ -132,6 +132,14 @@ ORK_CLASS_AVAILABLE
 /// The image of the signature, if any.
 @property (nonatomic, copy, nullable) UIImage *signatureImage;
 
+/**
+ The PNG encoding of the signature image.
+ 
+ The image is encoded once when it is set, and these bytes are archived and embedded in the
+ consent document HTML.
+ */
+@property (nonatomic, copy, readonly, nullable) NSData *signatureImageData;
+
 /// The date associated with the signature.
 @property (nonatomic, copy, nullable) NSString *signatureDate;
 
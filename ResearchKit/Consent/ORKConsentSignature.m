@@ -72,6 +72,11 @@
     return self;
 }
 
+- (void)setSignatureImage:(UIImage *)signatureImage {
+    _signatureImageData = signatureImage ? ORKImagePNGRepresentation(signatureImage) : nil;
+    _signatureImage = [signatureImage copy];
+}
+
 - (void)setIdentifier:(NSString *)identifier {
     ORKThrowInvalidArgumentExceptionIfNil(identifier);
     
@@ -92,7 +97,14 @@
         ORK_DECODE_OBJ_CLASS(aDecoder, signatureDate, NSString);
         ORK_DECODE_BOOL(aDecoder, requiresName);
         ORK_DECODE_BOOL(aDecoder, requiresSignatureImage);
-        ORK_DECODE_IMAGE(aDecoder, signatureImage);
+        ORK_DECODE_OBJ_CLASS(aDecoder, signatureImageData, NSData);
+        if (_signatureImageData) {
+            _signatureImage = [UIImage imageWithData:_signatureImageData scale:[aDecoder decodeDoubleForKey:@"signatureImageScale"] ? : 1];
+        } else {
+            // Signatures archived before the PNG bytes were kept
+            ORK_DECODE_IMAGE(aDecoder, signatureImage);
+            _signatureImageData = _signatureImage ? ORKImagePNGRepresentation(_signatureImage) : nil;
+        }
         ORK_DECODE_OBJ_CLASS(aDecoder, signatureDateFormatString, NSString);
     }
     return self;
@@ -106,6 +118,11 @@
     ORK_ENCODE_OBJ(aCoder, signatureDate);
     ORK_ENCODE_BOOL(aCoder, requiresName);
     ORK_ENCODE_BOOL(aCoder, requiresSignatureImage);
+    ORK_ENCODE_OBJ(aCoder, signatureImageData);
+    if (_signatureImage) {
+        [aCoder encodeDouble:_signatureImage.scale forKey:@"signatureImageScale"];
+    }
+    // Also written under the legacy key, so versions that only read the image can decode this archive
     ORK_ENCODE_IMAGE(aCoder, signatureImage);
     ORK_ENCODE_OBJ(aCoder, signatureDateFormatString);
 }
@@ -121,7 +138,7 @@
             && ORKEqualObjects(self.givenName, castObject.givenName)
             && ORKEqualObjects(self.familyName, castObject.familyName)
             && ORKEqualObjects(self.signatureDate, castObject.signatureDate)
-            && ORKEqualObjects(self.signatureImage, castObject.signatureImage)
+            && ORKEqualObjects(self.signatureImageData, castObject.signatureImageData)
             && ORKEqualObjects(self.signatureDateFormatString, castObject.signatureDateFormatString)
             && (self.requiresName == castObject.requiresName)
             && (self.requiresSignatureImage == castObject.requiresSignatureImage));
@@ -139,7 +156,8 @@
     sig.familyName = [_familyName copy];
     sig->_requiresName = _requiresName;
     sig->_requiresSignatureImage = _requiresSignatureImage;
-    sig.signatureImage = _signatureImage;
+    sig->_signatureImage = _signatureImage;
+    sig->_signatureImageData = _signatureImageData;
     sig.signatureDateFormatString = [_signatureDateFormatString copy];
     sig.signatureDate = [_signatureDate copy];
     return sig;
@@ -82,7 +82,8 @@
         NSString *imageTag = nil;
 
         if (signature.signatureImage) {
-            NSString *base64 = [UIImagePNGRepresentation(signature.signatureImage) base64EncodedStringWithOptions:NSDataBase64Encoding64CharacterLineLength];
+            // The PNG bytes were encoded when the image was set on the signature
+            NSString *base64 = [signature.signatureImageData base64EncodedStringWithOptions:NSDataBase64Encoding64CharacterLineLength];
             imageTag = [NSString stringWithFormat:@"<img width='100%%' alt='star' src='data:image/png;base64,%@' />", base64];
         } else {
             [body appendString:@"<br/>"];
@@ -73,9 +73,12 @@
 #import <ResearchKit/ORKPasscodeResult.h>
 #import <ResearchKit/ORKQuestionResult.h>
 #import <ResearchKit/ORKSignatureResult.h>
+#import <ResearchKit/ORKStroke.h>
 #import <ResearchKit/ORKVideoInstructionStepResult.h>
 #import <ResearchKit/ORKWebViewStepResult.h>
 #import <ResearchKit/ORKResultPredicate.h>
+#import <ResearchKit/ORKJSONSerializer.h>
+#import <ResearchKit/ORKResultArchiveWriter.h>
 
 #import <ResearchKit/ORKTextButton.h>
 #import <ResearchKit/ORKBorderedButton.h>
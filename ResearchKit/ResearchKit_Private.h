@@ -44,6 +44,7 @@
 #import <ResearchKit/ORKOrderedTask_Private.h>
 #import <ResearchKit/ORKPageStep_Private.h>
 #import <ResearchKit/ORKRecorder_Private.h>
+#import <ResearchKit/ORKResultPredicate_Private.h>
 #import <ResearchKit/ORKStepNavigationRule_Private.h>
 
 #import <ResearchKit/ORKAudioLevelNavigationRule.h>
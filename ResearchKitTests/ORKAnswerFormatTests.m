@@ -32,6 +32,8 @@
 @import XCTest;
 @import ResearchKit.Private;
 
+#import "ORKAnswerFormat_Internal.h"
+
 
 @interface ORKAnswerFormatTests : XCTestCase
 
@@ -85,6 +87,66 @@
     XCTAssertTrue([answerFormat isAnswerValidWithString:@"ABCD1234FFED0987654321"]);
 }
 
+- (void)testRegularExpressionsAreShared {
+    NSRegularExpression *firstExpression = [NSRegularExpression regularExpressionWithPattern:@"^[0-9]+$"
+                                                                                    options:(NSRegularExpressionOptions)0
+                                                                                      error:nil];
+    NSRegularExpression *secondExpression = [NSRegularExpression regularExpressionWithPattern:@"^[0-9]+$"
+                                                                                     options:(NSRegularExpressionOptions)0
+                                                                                       error:nil];
+    ORKTextAnswerFormat *firstFormat = [ORKAnswerFormat textAnswerFormatWithValidationRegularExpression:firstExpression
+                                                                                         invalidMessage:@"Digits only"];
+    ORKTextAnswerFormat *secondFormat = [ORKAnswerFormat textAnswerFormat];
+    secondFormat.validationRegularExpression = secondExpression;
+    XCTAssertEqual(firstFormat.validationRegularExpression, secondFormat.validationRegularExpression);
+    XCTAssertTrue([secondFormat isAnswerValidWithString:@"1234"]);
+    XCTAssertFalse([secondFormat isAnswerValidWithString:@"12a4"]);
+}
+
+- (void)testScaleNumberFormattersBelongToEachAnswerFormat {
+    ORKScaleAnswerFormat *firstScale = [ORKAnswerFormat scaleAnswerFormatWithMaximumValue:10 minimumValue:0 defaultValue:5 step:1 vertical:NO maximumValueDescription:nil minimumValueDescription:nil];
+    ORKScaleAnswerFormat *secondScale = [ORKAnswerFormat scaleAnswerFormatWithMaximumValue:5 minimumValue:1 defaultValue:3 step:1 vertical:YES maximumValueDescription:nil minimumValueDescription:nil];
+    NSString *secondLabel = [secondScale localizedStringForNumber:@(5)];
+    XCTAssertNotEqual(firstScale.numberFormatter, secondScale.numberFormatter);
+    XCTAssertEqual(firstScale.numberFormatter, firstScale.numberFormatter);
+    
+    // Customizing one answer format's formatter changes its labels only
+    firstScale.numberFormatter.positivePrefix = @"+";
+    XCTAssertEqualObjects([firstScale localizedStringForNumber:@(5)], [@"+" stringByAppendingString:secondLabel]);
+    XCTAssertEqualObjects([secondScale localizedStringForNumber:@(5)], secondLabel);
+    
+    ORKContinuousScaleAnswerFormat *firstContinuousScale = [ORKAnswerFormat continuousScaleAnswerFormatWithMaximumValue:10 minimumValue:0 defaultValue:5 maximumFractionDigits:1 vertical:NO maximumValueDescription:nil minimumValueDescription:nil];
+    ORKContinuousScaleAnswerFormat *secondContinuousScale = [ORKAnswerFormat continuousScaleAnswerFormatWithMaximumValue:10 minimumValue:0 defaultValue:5 maximumFractionDigits:1 vertical:NO maximumValueDescription:nil minimumValueDescription:nil];
+    XCTAssertNotEqual(firstContinuousScale.numberFormatter, secondContinuousScale.numberFormatter);
+    firstContinuousScale.numberFormatter.maximumFractionDigits = 0;
+    XCTAssertEqualObjects([secondContinuousScale localizedStringForNumber:@(2.5)], [secondContinuousScale.numberFormatter stringFromNumber:@(2.5)]);
+    XCTAssertNotEqualObjects([firstContinuousScale localizedStringForNumber:@(2.5)], [secondContinuousScale localizedStringForNumber:@(2.5)]);
+}
+
+- (void)testFormStepInvalidAnswers {
+    ORKTextAnswerFormat *textFormat = [ORKAnswerFormat textAnswerFormatWithValidationRegularExpression:[NSRegularExpression regularExpressionWithPattern:@"^[0-9]+$" options:(NSRegularExpressionOptions)0 error:nil]
+                                                                                        invalidMessage:@"Digits only"];
+    ORKNumericAnswerFormat *numericFormat = [ORKAnswerFormat decimalAnswerFormatWithUnit:nil];
+    numericFormat.minimum = @(0);
+    numericFormat.maximum = @(10);
+    ORKFormStep *step = [[ORKFormStep alloc] initWithIdentifier:@"form" title:nil text:nil];
+    step.formItems = @[[[ORKFormItem alloc] initWithSectionTitle:@"Section"],
+                       [[ORKFormItem alloc] initWithIdentifier:@"text" text:nil answerFormat:textFormat],
+                       [[ORKFormItem alloc] initWithIdentifier:@"number" text:nil answerFormat:numericFormat],
+                       [[ORKFormItem alloc] initWithIdentifier:@"email" text:nil answerFormat:[ORKAnswerFormat emailAnswerFormat]]];
+    
+    NSSet *invalidIdentifiers = [step identifiersOfFormItemsWithInvalidAnswers:@{@"text": @"12a", @"number": @(5), @"email": @"nobody"}];
+    XCTAssertEqualObjects(invalidIdentifiers, ([NSSet setWithObjects:@"text", @"email", nil]));
+    
+    ORKTextQuestionResult *textResult = [[ORKTextQuestionResult alloc] initWithIdentifier:@"text"];
+    textResult.textAnswer = @"123";
+    ORKNumericQuestionResult *numericResult = [[ORKNumericQuestionResult alloc] initWithIdentifier:@"number"];
+    numericResult.numericAnswer = @(42);
+    ORKStepResult *stepResult = [[ORKStepResult alloc] initWithStepIdentifier:@"form" results:@[textResult, numericResult]];
+    XCTAssertEqualObjects([step identifiersOfFormItemsWithInvalidAnswersInResult:stepResult], [NSSet setWithObject:@"number"]);
+    XCTAssertEqual([step identifiersOfFormItemsWithInvalidAnswers:nil].count, 0);
+}
+
 - (void)testConfirmAnswerFormat {
     
     // Setup an answer format
@@ -0,0 +1,199 @@
+/*
+ Copyright (c) 2026, CareEvolution, Inc.
+ 
+ Redistribution and use in source and binary forms, with or without modification,
+ are permitted provided that the following conditions are met:
+ 
+ 1.  Redistributions of source code must retain the above copyright notice, this
+ list of conditions and the following disclaimer.
+ 
+ 2.  Redistributions in binary form must reproduce the above copyright notice,
+ this list of conditions and the following disclaimer in the documentation and/or
+ other materials provided with the distribution.
+ 
+ 3.  Neither the name of the copyright holder(s) nor the names of any contributors
+ may be used to endorse or promote products derived from this software without
+ specific prior written permission. No license is granted to the trademarks of
+ the copyright holders even if such marks are included in this software.
+ 
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE
+ FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#import <XCTest/XCTest.h>
+#import "ORKChartLayoutEngine.h"
+
+
+static NSArray<NSString *> *ORKChartPrimitiveDescriptions(NSArray<ORKChartPrimitive *> *primitives) {
+    return [primitives valueForKey:@"description"];
+}
+
+
+@interface ORKChartLayoutEngineTests : XCTestCase
+
+@end
+
+
+@implementation ORKChartLayoutEngineTests
+
+- (void)testYAxisPrimitives {
+    NSArray<NSNumber *> *labelFactors = [ORKChartLayoutEngine defaultYAxisLabelFactorsForMinimumValue:0 maximumValue:100];
+    NSArray<ORKChartPrimitive *> *primitives = [ORKChartLayoutEngine yAxisPrimitivesWithLabelFactors:labelFactors
+                                                                                        minimumValue:0
+                                                                                        maximumValue:100
+                                                                                       decimalPlaces:0
+                                                                                                size:CGSizeMake(45, 200)];
+    NSArray<NSString *> *expected = @[ @"line (33.00, 160.00) (45.00, 160.00) 1.00",
+                                       @"label \"20\" right (31.00, 160.00)",
+                                       @"line (33.00, 0.00) (45.00, 0.00) 1.00",
+                                       @"label \"100\" right (31.00, 0.00)" ];
+    XCTAssertEqualObjects(ORKChartPrimitiveDescriptions(primitives), expected);
+    
+    // A single centered tick, without text for a zero value
+    labelFactors = [ORKChartLayoutEngine defaultYAxisLabelFactorsForMinimumValue:0 maximumValue:0];
+    primitives = [ORKChartLayoutEngine yAxisPrimitivesWithLabelFactors:labelFactors
+                                                          minimumValue:0
+                                                          maximumValue:0
+                                                         decimalPlaces:2
+                                                                  size:CGSizeMake(45, 200)];
+    expected = @[ @"line (33.00, 100.00) (45.00, 100.00) 1.00",
+                  @"label \"\" right (31.00, 100.00)" ];
+    XCTAssertEqualObjects(ORKChartPrimitiveDescriptions(primitives), expected);
+    XCTAssertNil(primitives[1].text);
+}
+
+- (void)testXAxisPrimitives {
+    NSArray<ORKChartPrimitive *> *primitives = [ORKChartLayoutEngine xAxisPrimitivesWithNumberOfPoints:3
+                                                                                                  size:CGSizeMake(100, 30)
+                                                                                       pixelAdjustment:0.5];
+    NSArray<NSString *> *expected = @[ @"line (0.00, 0.00) (100.00, 0.00) 1.00",
+                                       @"line (0.00, -11.50) (0.00, 0.50) 1.00",
+                                       @"line (50.00, -11.50) (50.00, 0.50) 1.00",
+                                       @"line (100.00, -11.50) (100.00, 0.50) 1.00" ];
+    XCTAssertEqualObjects(ORKChartPrimitiveDescriptions(primitives), expected);
+}
+
+- (void)testNormalizeValues {
+    const double values[] = { 0, 50, 100 };
+    double normalizedValues[3];
+    [ORKChartLayoutEngine normalizeValues:values count:3 minimumValue:0 maximumValue:100 canvasHeight:200 normalizedValues:normalizedValues];
+    XCTAssertEqualWithAccuracy(normalizedValues[0], 200, 0.001);
+    XCTAssertEqualWithAccuracy(normalizedValues[1], 100, 0.001);
+    XCTAssertEqualWithAccuracy(normalizedValues[2], 0, 0.001);
+    
+    // A flat range maps every value to the middle of the canvas
+    [ORKChartLayoutEngine normalizeValues:values count:3 minimumValue:50 maximumValue:50 canvasHeight:200 normalizedValues:normalizedValues];
+    XCTAssertEqual(normalizedValues[0], 100);
+    XCTAssertEqual(normalizedValues[2], 100);
+}
+
+- (void)testNormalizedStackedValues {
+    NSArray<NSNumber *> *normalizedValues = [ORKChartLayoutEngine normalizedStackedValues:@[ @10, @10, @20 ]
+                                                                             minimumValue:0
+                                                                             maximumValue:40
+                                                                             canvasHeight:100];
+    XCTAssertEqualObjects(normalizedValues, (@[ @75, @50, @0 ]));
+    
+    // Positions are measured from the minimum value
+    normalizedValues = [ORKChartLayoutEngine normalizedStackedValues:@[ @15, @10 ] minimumValue:10 maximumValue:30 canvasHeight:200];
+    XCTAssertEqualObjects(normalizedValues, (@[ @150, @50 ]));
+    
+    // Fractional positions are rounded down, towards the top of the canvas
+    normalizedValues = [ORKChartLayoutEngine normalizedStackedValues:@[ @1, @1 ] minimumValue:0 maximumValue:3 canvasHeight:100];
+    XCTAssertEqualObjects(normalizedValues, (@[ @66, @33 ]));
+    
+    XCTAssertEqualObjects([ORKChartLayoutEngine normalizedStackedValues:@[] minimumValue:0 maximumValue:1 canvasHeight:100], @[]);
+}
+
+- (void)testPiePrimitives {
+    NSArray<NSNumber *> *normalizedValues = [ORKChartLayoutEngine normalizedPieValues:@[ @1, @1, @2 ]];
+    XCTAssertEqualObjects(normalizedValues, (@[ @0.25, @0.25, @0.5 ]));
+    XCTAssertEqualObjects([ORKChartLayoutEngine normalizedPieValues:@[ @0, @0 ]], (@[ @0, @0 ]));
+    
+    ORKChartPrimitive *circle = [ORKChartLayoutEngine pieCirclePrimitiveWithSize:CGSizeMake(200, 200)
+                                                               radiusScaleFactor:0.5
+                                                                       lineWidth:10
+                                                                     labelHeight:20
+                                                           showsPercentageLabels:YES
+                                                                  drawsClockwise:YES];
+    XCTAssertEqualObjects(circle.description, @"arc (100.00, 100.00) r=65.00 -1.5708>4.7124 10.00");
+    
+    NSArray<ORKChartPrimitive *> *labels = [ORKChartLayoutEngine piePercentageLabelPrimitivesForNormalizedValues:@[ @0.5, @0.5 ]
+                                                                                                       pieRadius:70
+                                                                                                            size:CGSizeMake(200, 200)
+                                                                                                  drawsClockwise:YES
+                                                                                               labelSizeProvider:^CGSize(NSUInteger segmentIndex, NSString *text) {
+        return CGSizeMake(20, 10);
+    }];
+    NSArray<NSString *> *expected = @[ @"label \"50%\" center (190.00, 100.00)",
+                  @"label \"50%\" center (10.00, 100.00)" ];
+    XCTAssertEqualObjects(ORKChartPrimitiveDescriptions(labels), expected);
+}
+
+- (void)testPiePercentageLabelsDoNotOverlap {
+    NSArray<NSNumber *> *normalizedValues = [ORKChartLayoutEngine normalizedPieValues:@[ @1, @1, @1, @37, @60 ]];
+    CGSize labelSize = CGSizeMake(30, 15);
+    NSArray<ORKChartPrimitive *> *labels = [ORKChartLayoutEngine piePercentageLabelPrimitivesForNormalizedValues:normalizedValues
+                                                                                                       pieRadius:70
+                                                                                                            size:CGSizeMake(200, 200)
+                                                                                                  drawsClockwise:YES
+                                                                                               labelSizeProvider:^CGSize(NSUInteger segmentIndex, NSString *text) {
+        return labelSize;
+    }];
+    XCTAssertEqual(labels.count, 5);
+    for (NSUInteger index = 0; index + 1 < labels.count; index++) {
+        CGRect frame = CGRectMake(labels[index].position.x - labelSize.width / 2, labels[index].position.y - labelSize.height / 2, labelSize.width, labelSize.height);
+        CGRect nextFrame = CGRectMake(labels[index + 1].position.x - labelSize.width / 2, labels[index + 1].position.y - labelSize.height / 2, labelSize.width, labelSize.height);
+        XCTAssertFalse(CGRectIntersectsRect(frame, nextFrame), @"labels %lu and %lu overlap", (unsigned long)index, (unsigned long)index + 1);
+    }
+}
+
+- (void)testLayoutPerformance {
+    const NSUInteger pointCount = 100000;
+    double *values = malloc(pointCount * sizeof(double));
+    double *normalizedValues = malloc(pointCount * sizeof(double));
+    for (NSUInteger index = 0; index < pointCount; index++) {
+        values[index] = sin(index / 100.0) * 50 + 50;
+    }
+    NSMutableArray<NSArray<NSNumber *> *> *stacks = [NSMutableArray new];
+    for (NSUInteger index = 0; index < 1000; index++) {
+        [stacks addObject:@[ @(index % 10), @(index % 7), @(index % 3) ]];
+    }
+    NSMutableArray<NSNumber *> *pieValues = [NSMutableArray new];
+    for (NSUInteger index = 1; index <= 12; index++) {
+        [pieValues addObject:@(index)];
+    }
+    
+    [self measureBlock:^{
+        [ORKChartLayoutEngine normalizeValues:values count:pointCount minimumValue:0 maximumValue:100 canvasHeight:300 normalizedValues:normalizedValues];
+        for (NSArray<NSNumber *> *stack in stacks) {
+            [ORKChartLayoutEngine normalizedStackedValues:stack minimumValue:0 maximumValue:20 canvasHeight:300];
+        }
+        NSArray<NSNumber *> *labelFactors = [ORKChartLayoutEngine defaultYAxisLabelFactorsForMinimumValue:0 maximumValue:100];
+        [ORKChartLayoutEngine yAxisPrimitivesWithLabelFactors:labelFactors minimumValue:0 maximumValue:100 decimalPlaces:0 size:CGSizeMake(45, 300)];
+        [ORKChartLayoutEngine xAxisPrimitivesWithNumberOfPoints:1000 size:CGSizeMake(1000, 30) pixelAdjustment:0.5];
+        NSArray<NSNumber *> *normalizedPieValues = [ORKChartLayoutEngine normalizedPieValues:pieValues];
+        [ORKChartLayoutEngine pieCirclePrimitiveWithSize:CGSizeMake(300, 300) radiusScaleFactor:0.5 lineWidth:10 labelHeight:15 showsPercentageLabels:YES drawsClockwise:YES];
+        [ORKChartLayoutEngine piePercentageLabelPrimitivesForNormalizedValues:normalizedPieValues
+                                                                    pieRadius:100
+                                                                         size:CGSizeMake(300, 300)
+                                                               drawsClockwise:YES
+                                                            labelSizeProvider:^CGSize(NSUInteger segmentIndex, NSString *text) {
+            return CGSizeMake(30, 15);
+        }];
+    }];
+    
+    free(values);
+    free(normalizedValues);
+}
+
+@end
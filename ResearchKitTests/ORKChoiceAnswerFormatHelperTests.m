@@ -349,4 +349,32 @@
     }
 }
 
+- (void)testLargeChoiceListLookup {
+    NSMutableArray *textChoices = [NSMutableArray new];
+    for (NSUInteger index = 0; index < 500; index++) {
+        NSString *text = [NSString stringWithFormat:@"choice %lu", (unsigned long)index];
+        [textChoices addObject:[ORKTextChoice choiceWithText:text value:@(index * 10)]];
+    }
+    // A later choice reusing a value never wins over the first one.
+    [textChoices addObject:[ORKTextChoice choiceWithText:@"duplicate" value:@(20)]];
+    
+    ORKTextChoiceAnswerFormat *answerFormat = [ORKAnswerFormat choiceAnswerFormatWithStyle:ORKChoiceAnswerStyleMultipleChoice
+                                                                               textChoices:textChoices];
+    ORKChoiceAnswerFormatHelper *formatHelper = [ORKChoiceAnswerFormatHelper helperForAnswerFormat:answerFormat];
+    XCTAssertEqual(formatHelper, [ORKChoiceAnswerFormatHelper helperForAnswerFormat:answerFormat]);
+    
+    NSArray *indexes = [formatHelper selectedIndexesForAnswer:@[@(4990), @(20), @(0)]];
+    XCTAssertEqualObjects(indexes, (@[@(499), @(2), @(0)]));
+    XCTAssertEqual([formatHelper indexForChoiceValue:@(1230)], 123);
+    XCTAssertEqual([formatHelper indexForChoiceValue:@(1231)], NSNotFound);
+    XCTAssertEqual([formatHelper indexForChoiceValue:nil], NSNotFound);
+    XCTAssertEqualObjects([formatHelper answerForSelectedIndexes:indexes], (@[@(4990), @(20), @(0)]));
+    
+    // Answer formats decoded from an archive create their helper on first use.
+    NSData *data = [NSKeyedArchiver archivedDataWithRootObject:answerFormat];
+    ORKTextChoiceAnswerFormat *decodedFormat = [NSKeyedUnarchiver unarchiveObjectWithData:data];
+    ORKChoiceAnswerFormatHelper *decodedHelper = [ORKChoiceAnswerFormatHelper helperForAnswerFormat:decodedFormat];
+    XCTAssertEqualObjects([decodedHelper stringForChoiceAnswer:@[@(10)]], @"choice 1");
+}
+
 @end
@@ -69,6 +69,23 @@
 @end
 
 
+@interface ORKCountingConsentSectionFormatter : ORKConsentSectionFormatter
+
+@property (nonatomic) NSInteger callCount;
+
+@end
+
+
+@implementation ORKCountingConsentSectionFormatter
+
+- (NSString *)HTMLForSection:(ORKConsentSection *)section {
+    self.callCount++;
+    return [super HTMLForSection:section];
+}
+
+@end
+
+
 @interface ORKMockConsentSignatureFormatter : ORKConsentSignatureFormatter
 
 @end
@@ -190,4 +207,24 @@ body, p, h1, h2, h3 { font-family: Helvetica; }\n\
     XCTAssertEqualObjects(passedError, error);
 }
 
+- (void)testMakePDFWithCompletionHandler_reusesSectionHTMLUntilSectionChanges {
+    ORKCountingConsentSectionFormatter *formatter = [[ORKCountingConsentSectionFormatter alloc] init];
+    self.document = [[ORKConsentDocument alloc] initWithHTMLPDFWriter:self.mockWriter
+                                              consentSectionFormatter:formatter
+                                            consentSignatureFormatter:[[ORKMockConsentSignatureFormatter alloc] init]];
+    ORKConsentSection *section = [[ORKConsentSection alloc] initWithType:ORKConsentSectionTypeCustom];
+    section.title = @"Title";
+    section.content = @"first";
+    self.document.sections = @[section, [[ORKConsentSection alloc] init]];
+    
+    [self.document makePDFWithCompletionHandler:^(NSData *data, NSError *error) {}];
+    [self.document makePDFWithCompletionHandler:^(NSData *data, NSError *error) {}];
+    XCTAssertEqual(formatter.callCount, 2);
+    
+    section.content = @"second";
+    [self.document makePDFWithCompletionHandler:^(NSData *data, NSError *error) {}];
+    XCTAssertEqual(formatter.callCount, 3);
+    XCTAssertTrue([self.mockWriter.html containsString:@"<h4>Title</h4><p>second</p>"]);
+}
+
 @end
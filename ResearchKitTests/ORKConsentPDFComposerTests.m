@@ -0,0 +1,192 @@
+/*
+ Copyright (c) 2026, CareEvolution, Inc.
+ 
+ Redistribution and use in source and binary forms, with or without modification,
+ are permitted provided that the following conditions are met:
+ 
+ 1.  Redistributions of source code must retain the above copyright notice, this
+ list of conditions and the following disclaimer.
+ 
+ 2.  Redistributions in binary form must reproduce the above copyright notice,
+ this list of conditions and the following disclaimer in the documentation and/or
+ other materials provided with the distribution.
+ 
+ 3.  Neither the name of the copyright holder(s) nor the names of any contributors
+ may be used to endorse or promote products derived from this software without
+ specific prior written permission. No license is granted to the trademarks of
+ the copyright holders even if such marks are included in this software.
+ 
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE
+ FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+@import XCTest;
+@import ResearchKit.Private;
+
+#import "ORKConsentPDFComposer.h"
+#import "ORKConsentSectionFormatter.h"
+#import "ORKConsentSignatureFormatter.h"
+#import "ORKHTMLPDFWriter.h"
+
+
+@interface ORKRecordingHTMLPDFWriter : ORKHTMLPDFWriter
+
+@property (nonatomic, copy) NSString *html;
+
+@end
+
+
+@implementation ORKRecordingHTMLPDFWriter
+
+- (void)writePDFFromHTML:(NSString *)html completionBlock:(void (^)(NSData *, NSError *))completionBlock {
+    self.html = html;
+    completionBlock([NSData data], nil);
+}
+
+@end
+
+
+@interface ORKConsentPDFComposerTests : XCTestCase
+
+@property (nonatomic, strong) ORKConsentPDFComposer *composer;
+@property (nonatomic, strong) ORKConsentDocument *document;
+
+@end
+
+
+@implementation ORKConsentPDFComposerTests
+
+- (void)setUp {
+    [super setUp];
+    
+    self.composer = [[ORKConsentPDFComposer alloc] init];
+    self.composer.pageSize = CGSizeMake(612, 792);
+    
+    ORKConsentSection *section = [[ORKConsentSection alloc] initWithType:ORKConsentSectionTypeOverview];
+    section.content = @"Some content.\nA second line.";
+    
+    ORKConsentSignature *signature = [ORKConsentSignature signatureForPersonWithTitle:@"Participant"
+                                                                     dateFormatString:nil
+                                                                           identifier:@"participant"];
+    signature.givenName = @"Jane";
+    signature.familyName = @"Doe";
+    signature.signatureDate = @"1/1/2026";
+    
+    self.document = [[ORKConsentDocument alloc] init];
+    self.document.title = @"A Title";
+    self.document.sections = @[section];
+    self.document.signaturePageTitle = @"Signature Page Title";
+    self.document.signaturePageContent = @"signature page content";
+    self.document.signatures = @[signature];
+}
+
+- (void)tearDown {
+    self.composer = nil;
+    self.document = nil;
+    [super tearDown];
+}
+
+- (size_t)pageCountForPDFData:(NSData *)data {
+    CGDataProviderRef provider = CGDataProviderCreateWithCFData((__bridge CFDataRef)data);
+    CGPDFDocumentRef pdf = CGPDFDocumentCreateWithProvider(provider);
+    size_t count = CGPDFDocumentGetNumberOfPages(pdf);
+    CGPDFDocumentRelease(pdf);
+    CGDataProviderRelease(provider);
+    return count;
+}
+
+- (void)testPDFDataForDocument_startsSignaturePageOnNewPage {
+    NSData *data = [self.composer PDFDataForDocument:self.document];
+    XCTAssertGreaterThan(data.length, 0);
+    XCTAssertEqual([self pageCountForPDFData:data], 2);
+}
+
+- (void)testPDFDataForDocument_paginatesLongSections {
+    NSMutableString *content = [NSMutableString new];
+    for (NSInteger i = 0; i < 2000; i++) {
+        [content appendString:@"Lorem ipsum dolor sit amet, consectetur adipiscing elit. "];
+    }
+    ORKConsentSection *section = [[ORKConsentSection alloc] initWithType:ORKConsentSectionTypeCustom];
+    section.title = @"Long";
+    section.content = content;
+    self.document.sections = @[section];
+    
+    XCTAssertGreaterThan([self pageCountForPDFData:[self.composer PDFDataForDocument:self.document]], 3);
+}
+
+- (void)testPDFDataForDocument_whenSignatureTitleIsMissing_throws {
+    ORKConsentSignature *signature = [[ORKConsentSignature alloc] init];
+    self.document.signatures = @[signature];
+    XCTAssertThrowsSpecificNamed([self.composer PDFDataForDocument:self.document], NSException, NSObjectNotAvailableException);
+}
+
+- (void)testComposePDFForDocument_callsCompletionOnMainQueue {
+    XCTestExpectation *expectation = [self expectationWithDescription:@"compose"];
+    [self.composer composePDFForDocument:self.document completionBlock:^(NSData *data, NSError *error) {
+        XCTAssertTrue([NSThread isMainThread]);
+        XCTAssertNil(error);
+        XCTAssertEqual([self pageCountForPDFData:data], 2);
+        [expectation fulfill];
+    }];
+    [self waitForExpectationsWithTimeout:10 handler:nil];
+}
+
+- (ORKConsentDocument *)documentWithWriter:(ORKHTMLPDFWriter *)writer {
+    ORKConsentDocument *document = [[ORKConsentDocument alloc] initWithHTMLPDFWriter:writer
+                                                             consentSectionFormatter:[[ORKConsentSectionFormatter alloc] init]
+                                                           consentSignatureFormatter:[[ORKConsentSignatureFormatter alloc] init]];
+    document.title = self.document.title;
+    document.sections = self.document.sections;
+    document.signaturePageTitle = self.document.signaturePageTitle;
+    document.signaturePageContent = self.document.signaturePageContent;
+    document.signatures = self.document.signatures;
+    return document;
+}
+
+- (void)testMakePDFWithCompletionHandler_withPlainTextDocument_usesComposer {
+    ORKRecordingHTMLPDFWriter *writer = [[ORKRecordingHTMLPDFWriter alloc] init];
+    ORKConsentDocument *document = [self documentWithWriter:writer];
+    
+    XCTestExpectation *expectation = [self expectationWithDescription:@"make PDF"];
+    [document makePDFWithCompletionHandler:^(NSData *data, NSError *error) {
+        XCTAssertNil(error);
+        XCTAssertEqual([self pageCountForPDFData:data], 2);
+        [expectation fulfill];
+    }];
+    [self waitForExpectationsWithTimeout:10 handler:nil];
+    XCTAssertNil(writer.html);
+}
+
+- (void)testMakePDFWithCompletionHandler_withMarkupInSectionTitle_usesHTMLWriter {
+    ORKConsentSection *section = [[ORKConsentSection alloc] initWithType:ORKConsentSectionTypeCustom];
+    section.title = @"<b>Bold</b> title";
+    section.content = @"Plain content.";
+    self.document.sections = @[section];
+    ORKRecordingHTMLPDFWriter *writer = [[ORKRecordingHTMLPDFWriter alloc] init];
+    ORKConsentDocument *document = [self documentWithWriter:writer];
+    
+    [document makePDFWithCompletionHandler:^(NSData *data, NSError *error) {}];
+    XCTAssertTrue([writer.html containsString:@"<b>Bold</b> title"]);
+    
+    ORKConsentSection *formalSection = [[ORKConsentSection alloc] initWithType:ORKConsentSectionTypeCustom];
+    formalSection.title = @"Plain title";
+    formalSection.formalTitle = @"Formal &amp; title";
+    formalSection.content = @"Plain content.";
+    self.document.sections = @[formalSection];
+    writer = [[ORKRecordingHTMLPDFWriter alloc] init];
+    document = [self documentWithWriter:writer];
+    
+    [document makePDFWithCompletionHandler:^(NSData *data, NSError *error) {}];
+    XCTAssertTrue([writer.html containsString:@"Formal &amp; title"]);
+}
+
+@end
@@ -182,4 +182,37 @@
     XCTAssertEqualObjects([self.formatter HTMLForSignature:self.signature], html);
 }
 
+- (void)testSignatureImageDataIsEncodedOnceAndArchived {
+    UIGraphicsBeginImageContext(CGSizeMake(4, 4));
+    [[UIColor blackColor] setFill];
+    UIRectFill(CGRectMake(0, 0, 2, 2));
+    UIImage *image = UIGraphicsGetImageFromCurrentImageContext();
+    UIGraphicsEndImageContext();
+    
+    self.signature.signatureImage = image;
+    NSData *imageData = self.signature.signatureImageData;
+    XCTAssertEqualObjects(imageData, UIImagePNGRepresentation(image));
+    XCTAssertEqual(self.signature.signatureImageData, imageData);
+    
+    NSString *base64 = [imageData base64EncodedStringWithOptions:NSDataBase64Encoding64CharacterLineLength];
+    XCTAssertTrue([[self.formatter HTMLForSignature:self.signature] containsString:base64]);
+    
+    ORKConsentSignature *decodedSignature = [NSKeyedUnarchiver unarchiveObjectWithData:[NSKeyedArchiver archivedDataWithRootObject:self.signature]];
+    XCTAssertEqualObjects(decodedSignature.signatureImageData, imageData);
+    XCTAssertEqualObjects(decodedSignature, self.signature);
+    XCTAssertEqual(decodedSignature.signatureImage.size.width, image.size.width);
+    
+    // Archives keep the legacy image key for versions that predate signatureImageData
+    for (id<NSCoding> object in @[ self.signature, [[ORKSignatureResult alloc] initWithSignatureImage:image signaturePath:@[]] ]) {
+        NSKeyedArchiver *archiver = [[NSKeyedArchiver alloc] initRequiringSecureCoding:NO];
+        [object encodeWithCoder:archiver];
+        [archiver finishEncoding];
+        NSKeyedUnarchiver *unarchiver = [[NSKeyedUnarchiver alloc] initForReadingFromData:archiver.encodedData error:NULL];
+        unarchiver.requiresSecureCoding = NO;
+        UIImage *legacyImage = [unarchiver decodeObjectForKey:@"signatureImage"];
+        XCTAssertEqual(legacyImage.size.width, image.size.width);
+        XCTAssertEqualObjects([unarchiver decodeObjectForKey:@"signatureImageData"], imageData);
+    }
+}
+
 @end
@@ -32,6 +32,8 @@
 @import XCTest;
 @import ResearchKit.Private;
 
+#import "ORKJSONWriter.h"
+
 
 @interface ORKDataLoggerTests : XCTestCase <ORKDataLoggerDelegate> {
     NSURL *_directory;
@@ -371,4 +373,40 @@
     }
 }
 
+- (void)testJSONWriterWrite {
+    ORKJSONWriter *writer = [ORKJSONWriter new];
+    for (int i = 0; i < 3; i++) {
+        [writer beginObject];
+        [writer writeKey:"val" integer:i];
+        [writer writeKey:"x" double:0.1 * i];
+        [writer writeKey:"s" string:@"a\"b/c\n"];
+        [writer writeKey:"nested"];
+        [writer writeObject:@{@"flag": @YES, @"list": @[@1, @2.5, [NSNull null]]}];
+        [writer endObject];
+    }
+    XCTAssertEqual(writer.itemCount, 3);
+    
+    NSError *error = nil;
+    XCTAssertTrue([_dataLogger append:@{@"val": @(-1)} error:&error]);
+    XCTAssertTrue([_dataLogger appendJSONWriter:writer error:&error]);
+    XCTAssertNil(error);
+    
+    NSDictionary *jsonOut = [NSJSONSerialization JSONObjectWithData:[NSData dataWithContentsOfURL:[_dataLogger currentLogFileURL]] options:(NSJSONReadingOptions)0 error:&error];
+    XCTAssertNil(error);
+    NSArray *items = jsonOut[@"items"];
+    XCTAssertEqual(items.count, 4);
+    XCTAssertEqualObjects(items[0], @{@"val": @(-1)});
+    for (int i = 0; i < 3; i++) {
+        NSDictionary *expected = @{@"val": @(i),
+                                   @"x": @(0.1 * i),
+                                   @"s": @"a\"b/c\n",
+                                   @"nested": @{@"flag": @YES, @"list": @[@1, @2.5, [NSNull null]]}};
+        XCTAssertEqualObjects(items[i + 1], expected);
+    }
+    
+    [writer reset];
+    XCTAssertEqual(writer.itemCount, 0);
+    XCTAssertEqual(writer.data.length, 0);
+}
+
 @end
@@ -0,0 +1,453 @@
+/*
+ Copyright (c) 2026, CareEvolution, Inc.
+ 
+ Redistribution and use in source and binary forms, with or without modification,
+ are permitted provided that the following conditions are met:
+ 
+ 1.  Redistributions of source code must retain the above copyright notice, this
+ list of conditions and the following disclaimer.
+ 
+ 2.  Redistributions in binary form must reproduce the above copyright notice,
+ this list of conditions and the following disclaimer in the documentation and/or
+ other materials provided with the distribution.
+ 
+ 3.  Neither the name of the copyright holder(s) nor the names of any contributors
+ may be used to endorse or promote products derived from this software without
+ specific prior written permission. No license is granted to the trademarks of
+ the copyright holders even if such marks are included in this software.
+ 
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE
+ FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+@import XCTest;
+@import ResearchKit.Private;
+
+#import "ORKGraphChartView_Internal.h"
+#import "ORKHelpers_Internal.h"
+
+
+// Provides its values one point at a time; NSNull values are unset points, ORKValueRange values are used as-is
+@interface ORKTestPerPointLineGraphChartViewDataSource : NSObject <ORKValueRangeGraphChartViewDataSource>
+
+@property (nonatomic) NSMutableArray *values;
+
+@property (nonatomic) NSInteger numberOfDivisions;
+
+@property (nonatomic) NSUInteger perPointRequestCount;
+
+@end
+
+
+@implementation ORKTestPerPointLineGraphChartViewDataSource
+
+- (instancetype)init {
+    self = [super init];
+    if (self) {
+        _values = [NSMutableArray new];
+    }
+    return self;
+}
+
+- (NSInteger)numberOfPlotsInGraphChartView:(ORKGraphChartView *)graphChartView {
+    return 1;
+}
+
+- (NSInteger)numberOfDivisionsInXAxisForGraphChartView:(ORKGraphChartView *)graphChartView {
+    return _numberOfDivisions;
+}
+
+- (NSInteger)graphChartView:(ORKGraphChartView *)graphChartView numberOfDataPointsForPlotIndex:(NSInteger)plotIndex {
+    return _values.count;
+}
+
+- (ORKValueRange *)graphChartView:(ORKGraphChartView *)graphChartView dataPointForPointIndex:(NSInteger)pointIndex plotIndex:(NSInteger)plotIndex {
+    _perPointRequestCount++;
+    if ([_values[pointIndex] isKindOfClass:[ORKValueRange class]]) {
+        return _values[pointIndex];
+    }
+    NSNumber *value = ORKDynamicCast(_values[pointIndex], NSNumber);
+    return value ? [[ORKValueRange alloc] initWithValue:value.doubleValue] : [ORKValueRange new];
+}
+
+@end
+
+
+// Also fills the chart's buffers in bulk
+@interface ORKTestLineGraphChartViewDataSource : ORKTestPerPointLineGraphChartViewDataSource
+
+@property (nonatomic) NSMutableArray<NSValue *> *requestedRanges;
+
+@end
+
+
+@implementation ORKTestLineGraphChartViewDataSource
+
+- (instancetype)init {
+    self = [super init];
+    if (self) {
+        _requestedRanges = [NSMutableArray new];
+    }
+    return self;
+}
+
+- (void)graphChartView:(ORKGraphChartView *)graphChartView
+      getMinimumValues:(double *)minimumValues
+         maximumValues:(double *)maximumValues
+             unsetMask:(BOOL *)unsetMask
+                 range:(NSRange)range
+             plotIndex:(NSInteger)plotIndex {
+    [_requestedRanges addObject:[NSValue valueWithRange:range]];
+    for (NSUInteger index = 0; index < range.length; index++) {
+        NSNumber *value = ORKDynamicCast(self.values[range.location + index], NSNumber);
+        if (value == nil) {
+            unsetMask[index] = YES;
+        } else {
+            minimumValues[index] = maximumValues[index] = value.doubleValue;
+        }
+    }
+}
+
+@end
+
+
+@interface ORKTestBarGraphChartViewDataSource : NSObject <ORKValueStackGraphChartViewDataSource>
+
+@property (nonatomic) NSMutableArray<ORKValueStack *> *stacks;
+
+@end
+
+
+@implementation ORKTestBarGraphChartViewDataSource
+
+- (instancetype)init {
+    self = [super init];
+    if (self) {
+        _stacks = [NSMutableArray new];
+    }
+    return self;
+}
+
+- (NSInteger)numberOfPlotsInGraphChartView:(ORKGraphChartView *)graphChartView {
+    return 1;
+}
+
+- (NSInteger)graphChartView:(ORKGraphChartView *)graphChartView numberOfDataPointsForPlotIndex:(NSInteger)plotIndex {
+    return _stacks.count;
+}
+
+- (ORKValueStack *)graphChartView:(ORKGraphChartView *)graphChartView dataPointForPointIndex:(NSInteger)pointIndex plotIndex:(NSInteger)plotIndex {
+    return _stacks[pointIndex];
+}
+
+@end
+
+
+typedef struct {
+    __unsafe_unretained NSMutableArray<NSString *> *segments;
+    CGPoint currentPoint;
+} ORKPathSegmentContext;
+
+static void ORKAddPathSegment(void *info, const CGPathElement *element) {
+    ORKPathSegmentContext *context = info;
+    switch (element->type) {
+        case kCGPathElementMoveToPoint:
+            context->currentPoint = element->points[0];
+            break;
+        case kCGPathElementAddLineToPoint:
+            [context->segments addObject:[NSString stringWithFormat:@"%@-%@", NSStringFromCGPoint(context->currentPoint), NSStringFromCGPoint(element->points[0])]];
+            context->currentPoint = element->points[0];
+            break;
+        default:
+            break;
+    }
+}
+
+// The line segments drawn by the plot's line layers, grouped by stroke color and dash pattern
+static NSDictionary<NSString *, NSArray<NSString *> *> *ORKLineSegmentsForPlot(ORKGraphChartView *chartView, NSInteger plotIndex) {
+    NSMutableDictionary<NSString *, NSMutableArray<NSString *> *> *segmentsByStyle = [NSMutableDictionary new];
+    for (NSArray<CAShapeLayer *> *lineLayers in chartView.lineLayers[plotIndex]) {
+        for (CAShapeLayer *lineLayer in lineLayers) {
+            NSString *style = [NSString stringWithFormat:@"%@ %@", [UIColor colorWithCGColor:lineLayer.strokeColor], lineLayer.lineDashPattern];
+            if (!segmentsByStyle[style]) {
+                segmentsByStyle[style] = [NSMutableArray new];
+            }
+            if (lineLayer.path) {
+                ORKPathSegmentContext context = { .segments = segmentsByStyle[style], .currentPoint = CGPointZero };
+                CGPathApply(lineLayer.path, &context, ORKAddPathSegment);
+            }
+        }
+    }
+    NSMutableDictionary<NSString *, NSArray<NSString *> *> *sortedSegmentsByStyle = [NSMutableDictionary new];
+    [segmentsByStyle enumerateKeysAndObjectsUsingBlock:^(NSString *style, NSMutableArray<NSString *> *segments, BOOL *stop) {
+        if (segments.count > 0) {
+            sortedSegmentsByStyle[style] = [segments sortedArrayUsingSelector:@selector(compare:)];
+        }
+    }];
+    return sortedSegmentsByStyle;
+}
+
+
+@interface ORKGraphChartViewTests : XCTestCase
+
+@end
+
+
+@implementation ORKGraphChartViewTests
+
+- (void)assertDataPoints:(NSArray<ORKValueRange *> *)dataPoints equalDataPoints:(NSArray<ORKValueRange *> *)expectedDataPoints {
+    XCTAssertEqual(dataPoints.count, expectedDataPoints.count);
+    for (NSUInteger index = 0; index < MIN(dataPoints.count, expectedDataPoints.count); index++) {
+        XCTAssertEqual(dataPoints[index].isUnset, expectedDataPoints[index].isUnset);
+        if (!dataPoints[index].isUnset) {
+            XCTAssertEqual(dataPoints[index].minimumValue, expectedDataPoints[index].minimumValue);
+            XCTAssertEqual(dataPoints[index].maximumValue, expectedDataPoints[index].maximumValue);
+        }
+    }
+}
+
+- (void)testBulkDataSourceMatchesPerPointDataSource {
+    ORKTestLineGraphChartViewDataSource *bulkDataSource = [ORKTestLineGraphChartViewDataSource new];
+    ORKTestPerPointLineGraphChartViewDataSource *perPointDataSource = [ORKTestPerPointLineGraphChartViewDataSource new];
+    for (ORKTestPerPointLineGraphChartViewDataSource *dataSource in @[ bulkDataSource, perPointDataSource ]) {
+        [dataSource.values addObjectsFromArray:@[ @1, [NSNull null], @3 ]];
+        // Two more x axis divisions than points, so each plot is padded with unset points
+        dataSource.numberOfDivisions = 5;
+    }
+    
+    ORKLineGraphChartView *bulkChartView = [[ORKLineGraphChartView alloc] initWithFrame:CGRectMake(0, 0, 320, 200)];
+    bulkChartView.dataSource = bulkDataSource;
+    ORKLineGraphChartView *perPointChartView = [[ORKLineGraphChartView alloc] initWithFrame:CGRectMake(0, 0, 320, 200)];
+    perPointChartView.dataSource = perPointDataSource;
+    
+    XCTAssertEqual(bulkDataSource.perPointRequestCount, 0);
+    XCTAssertEqualObjects(bulkDataSource.requestedRanges.lastObject, [NSValue valueWithRange:NSMakeRange(0, 3)]);
+    NSArray<ORKValueRange *> *dataPoints = bulkChartView.dataPoints[0];
+    XCTAssertEqual(dataPoints.count, 5);
+    XCTAssertEqual(dataPoints[0].minimumValue, 1);
+    XCTAssertTrue(dataPoints[1].isUnset);
+    XCTAssertEqual(dataPoints[2].maximumValue, 3);
+    XCTAssertTrue(dataPoints[3].isUnset);
+    XCTAssertTrue(dataPoints[4].isUnset);
+    [self assertDataPoints:dataPoints equalDataPoints:perPointChartView.dataPoints[0]];
+    XCTAssertEqual(bulkChartView.minimumValue, perPointChartView.minimumValue);
+    XCTAssertEqual(bulkChartView.maximumValue, perPointChartView.maximumValue);
+    
+    // Appending an unset point fetches only that point, and keeps the padding
+    [bulkDataSource.values addObject:[NSNull null]];
+    [perPointDataSource.values addObject:[NSNull null]];
+    [bulkChartView reloadDataAppendingPointCount:1 removingPointCount:0];
+    [perPointChartView reloadDataAppendingPointCount:1 removingPointCount:0];
+    XCTAssertEqualObjects(bulkDataSource.requestedRanges.lastObject, [NSValue valueWithRange:NSMakeRange(3, 1)]);
+    XCTAssertEqual(bulkChartView.dataPoints[0].count, 5);
+    [self assertDataPoints:bulkChartView.dataPoints[0] equalDataPoints:perPointChartView.dataPoints[0]];
+}
+
+- (void)testDecimatedPointIndexes {
+    // 21 points over 2.5 points of width put 8 points in each of the first two pixel columns
+    NSMutableArray<ORKValueRange *> *points = [NSMutableArray new];
+    for (id value in @[ @3, @5, @9, @2, @7, @1, @6, @4,
+                        @5, @5, @5, @5, @5, @5, @5, @5,
+                        @0, [NSNull null], @10, [NSNull null], [NSNull null] ]) {
+        ORKValueRange *point = [value isKindOfClass:[NSNumber class]] ? [[ORKValueRange alloc] initWithValue:[value doubleValue]] : [ORKValueRange new];
+        [points addObject:point];
+    }
+    
+    // Each column keeps its first, highest, lowest and last set point; a flat column keeps only its ends
+    NSMutableIndexSet *expectedIndexes = [NSMutableIndexSet new];
+    for (NSNumber *index in @[ @0, @2, @5, @7, @8, @15, @16, @18 ]) {
+        [expectedIndexes addIndex:index.unsignedIntegerValue];
+    }
+    NSIndexSet *indexes = ORKDecimatedPointIndexes(points, points.count, 2.5, 1);
+    XCTAssertEqual(indexes.count, 8);
+    XCTAssertEqualObjects(indexes, expectedIndexes);
+    
+    // The lowest and highest values of the full series survive
+    __block double lowestValue = DBL_MAX;
+    __block double highestValue = -DBL_MAX;
+    [indexes enumerateIndexesUsingBlock:^(NSUInteger index, BOOL *stop) {
+        lowestValue = MIN(lowestValue, points[index].minimumValue);
+        highestValue = MAX(highestValue, points[index].maximumValue);
+    }];
+    XCTAssertEqual(lowestValue, 0);
+    XCTAssertEqual(highestValue, 10);
+    
+    XCTAssertEqual(ORKDecimatedPointIndexes(@[], 0, 2.5, 1).count, 0);
+}
+
+- (void)testXPositionLookupsWithoutPoints {
+    ORKTestPerPointLineGraphChartViewDataSource *dataSource = [ORKTestPerPointLineGraphChartViewDataSource new];
+    ORKLineGraphChartView *chartView = [[ORKLineGraphChartView alloc] initWithFrame:CGRectMake(0, 0, 320, 200)];
+    chartView.dataSource = dataSource;
+    [chartView layoutIfNeeded];
+    
+    XCTAssertEqual(chartView.numberOfXAxisPoints, 0);
+    XCTAssertEqual([chartView xAxisPointIndexForXPosition:10 strictlyAfter:NO], 0);
+    XCTAssertEqual([chartView pointIndexForXPosition:10 plotIndex:0], 0);
+    XCTAssertFalse([chartView isXPositionSnapped:0 plotIndex:0]);
+    XCTAssertEqual([chartView snappedXPosition:10 plotIndex:0], 10);
+    XCTAssertEqual([chartView numberOfValidValuesForPlotIndex:0], 0);
+    XCTAssertEqual([chartView validPointIndexesForPlotIndex:0].count, 0);
+}
+
+- (void)testXPositionLookups {
+    ORKTestPerPointLineGraphChartViewDataSource *dataSource = [ORKTestPerPointLineGraphChartViewDataSource new];
+    [dataSource.values addObjectsFromArray:@[ @1, [NSNull null], @3, @4, [NSNull null] ]];
+    ORKLineGraphChartView *chartView = [[ORKLineGraphChartView alloc] initWithFrame:CGRectMake(0, 0, 320, 200)];
+    chartView.dataSource = dataSource;
+    [chartView layoutIfNeeded];
+    
+    NSInteger numberOfPoints = dataSource.values.count;
+    XCTAssertEqual(chartView.numberOfXAxisPoints, numberOfPoints);
+    CGFloat positions[5];
+    for (NSInteger pointIndex = 0; pointIndex < numberOfPoints; pointIndex++) {
+        positions[pointIndex] = [chartView xAxisPointForPointIndex:pointIndex];
+        XCTAssertEqual(positions[pointIndex], xAxisPoint(pointIndex, numberOfPoints, CGRectGetWidth(chartView.plotView.bounds)));
+    }
+    XCTAssertLessThan(positions[0], positions[numberOfPoints - 1]);
+    
+    NSMutableIndexSet *expectedValidIndexes = [NSMutableIndexSet indexSetWithIndex:0];
+    [expectedValidIndexes addIndexesInRange:NSMakeRange(2, 2)];
+    XCTAssertEqualObjects([chartView validPointIndexesForPlotIndex:0], expectedValidIndexes);
+    XCTAssertEqual([chartView numberOfValidValuesForPlotIndex:0], 3);
+    
+    // Exact hits
+    for (NSInteger pointIndex = 0; pointIndex < numberOfPoints; pointIndex++) {
+        XCTAssertEqual([chartView pointIndexForXPosition:positions[pointIndex] plotIndex:0], pointIndex);
+        XCTAssertEqual([chartView xAxisPointIndexForXPosition:positions[pointIndex] strictlyAfter:YES], MIN(pointIndex + 1, numberOfPoints - 1));
+        XCTAssertTrue([chartView isXPositionSnapped:positions[pointIndex] plotIndex:0]);
+    }
+    
+    // Between two points, both lookups find the later one
+    CGFloat betweenPosition = (positions[1] + positions[2]) / 2;
+    XCTAssertEqual([chartView pointIndexForXPosition:betweenPosition plotIndex:0], 2);
+    XCTAssertEqual([chartView xAxisPointIndexForXPosition:betweenPosition strictlyAfter:YES], 2);
+    XCTAssertFalse([chartView isXPositionSnapped:betweenPosition plotIndex:0]);
+    
+    // Positions snap to a nearby valid point only; an unset point is too far from its valid neighbors
+    XCTAssertEqual([chartView snappedXPosition:positions[2] - 1 plotIndex:0], positions[2]);
+    XCTAssertEqual([chartView snappedXPosition:positions[2] + 1 plotIndex:0], positions[2]);
+    XCTAssertEqual([chartView snappedXPosition:positions[1] plotIndex:0], positions[1]);
+    XCTAssertEqual([chartView snappedXPosition:betweenPosition plotIndex:0], betweenPosition);
+    
+    // Out of range positions fall back to the first and last points
+    XCTAssertEqual([chartView pointIndexForXPosition:positions[0] - 100 plotIndex:0], 0);
+    XCTAssertEqual([chartView pointIndexForXPosition:positions[numberOfPoints - 1] + 100 plotIndex:0], numberOfPoints - 1);
+    XCTAssertEqual([chartView xAxisPointIndexForXPosition:positions[numberOfPoints - 1] + 100 strictlyAfter:YES], numberOfPoints - 1);
+    XCTAssertFalse([chartView isXPositionSnapped:positions[0] - 100 plotIndex:0]);
+    XCTAssertFalse([chartView isXPositionSnapped:positions[numberOfPoints - 1] + 100 plotIndex:0]);
+}
+
+- (void)assertCombinedPathsOfChartView:(ORKGraphChartView *)chartView matchSegmentsOfChartView:(ORKGraphChartView *)segmentedChartView {
+    chartView.drawsCombinedPlotPaths = YES;
+    [chartView layoutIfNeeded];
+    [segmentedChartView layoutIfNeeded];
+    
+    NSDictionary<NSString *, NSArray<NSString *> *> *segments = ORKLineSegmentsForPlot(chartView, 0);
+    NSDictionary<NSString *, NSArray<NSString *> *> *expectedSegments = ORKLineSegmentsForPlot(segmentedChartView, 0);
+    XCTAssertGreaterThan(expectedSegments.count, 0);
+    XCTAssertEqualObjects(segments, expectedSegments);
+}
+
+- (void)testCombinedLineGraphMatchesSegments {
+    ORKTestPerPointLineGraphChartViewDataSource *dataSource = [ORKTestPerPointLineGraphChartViewDataSource new];
+    // Segments after unset points are dashed, the others solid
+    [dataSource.values addObjectsFromArray:@[ @1, @5, [NSNull null], @3, @2, [NSNull null], [NSNull null], @4 ]];
+    ORKLineGraphChartView *chartView = [[ORKLineGraphChartView alloc] initWithFrame:CGRectMake(0, 0, 320, 200)];
+    chartView.dataSource = dataSource;
+    ORKLineGraphChartView *segmentedChartView = [[ORKLineGraphChartView alloc] initWithFrame:CGRectMake(0, 0, 320, 200)];
+    segmentedChartView.dataSource = dataSource;
+    
+    [self assertCombinedPathsOfChartView:chartView matchSegmentsOfChartView:segmentedChartView];
+    NSDictionary<NSString *, NSArray<NSString *> *> *segments = ORKLineSegmentsForPlot(chartView, 0);
+    XCTAssertEqual(segments.count, 2);
+    XCTAssertEqual([[segments.allValues valueForKeyPath:@"@sum.count"] integerValue], 4);
+}
+
+- (void)testCombinedDiscreteGraphMatchesSegments {
+    ORKTestPerPointLineGraphChartViewDataSource *dataSource = [ORKTestPerPointLineGraphChartViewDataSource new];
+    // Single values are empty ranges and draw no line
+    [dataSource.values addObjectsFromArray:@[ [[ORKValueRange alloc] initWithMinimumValue:1 maximumValue:4],
+                                              [NSNull null],
+                                              @2,
+                                              [[ORKValueRange alloc] initWithMinimumValue:0 maximumValue:6] ]];
+    ORKDiscreteGraphChartView *chartView = [[ORKDiscreteGraphChartView alloc] initWithFrame:CGRectMake(0, 0, 320, 200)];
+    chartView.dataSource = dataSource;
+    ORKDiscreteGraphChartView *segmentedChartView = [[ORKDiscreteGraphChartView alloc] initWithFrame:CGRectMake(0, 0, 320, 200)];
+    segmentedChartView.dataSource = dataSource;
+    
+    [self assertCombinedPathsOfChartView:chartView matchSegmentsOfChartView:segmentedChartView];
+    XCTAssertEqual(ORKLineSegmentsForPlot(chartView, 0).allValues.firstObject.count, 2);
+}
+
+- (void)testCombinedBarGraphMatchesSegments {
+    ORKTestBarGraphChartViewDataSource *dataSource = [ORKTestBarGraphChartViewDataSource new];
+    [dataSource.stacks addObjectsFromArray:@[ [[ORKValueStack alloc] initWithStackedValues:@[ @1, @2 ]],
+                                              [ORKValueStack new],
+                                              [[ORKValueStack alloc] initWithStackedValues:@[ @3 ]],
+                                              [[ORKValueStack alloc] initWithStackedValues:@[ @2, @1 ]] ]];
+    ORKBarGraphChartView *chartView = [[ORKBarGraphChartView alloc] initWithFrame:CGRectMake(0, 0, 320, 200)];
+    chartView.dataSource = dataSource;
+    ORKBarGraphChartView *segmentedChartView = [[ORKBarGraphChartView alloc] initWithFrame:CGRectMake(0, 0, 320, 200)];
+    segmentedChartView.dataSource = dataSource;
+    
+    [self assertCombinedPathsOfChartView:chartView matchSegmentsOfChartView:segmentedChartView];
+    XCTAssertEqual([[ORKLineSegmentsForPlot(chartView, 0).allValues valueForKeyPath:@"@sum.count"] integerValue], 5);
+}
+
+- (void)testCombinedLineGraphAppendingToEmptyPlot {
+    ORKTestLineGraphChartViewDataSource *dataSource = [ORKTestLineGraphChartViewDataSource new];
+    ORKLineGraphChartView *chartView = [[ORKLineGraphChartView alloc] initWithFrame:CGRectMake(0, 0, 320, 200)];
+    chartView.drawsCombinedPlotPaths = YES;
+    chartView.dataSource = dataSource;
+    [chartView layoutIfNeeded];
+    XCTAssertEqual(chartView.lineLayers[0].count, 0);
+    
+    [dataSource.values addObjectsFromArray:@[ @1, @2, @3 ]];
+    XCTAssertNoThrow([chartView reloadDataAppendingPointCount:3 removingPointCount:0]);
+    XCTAssertNoThrow([chartView layoutIfNeeded]);
+    NSArray<CAShapeLayer *> *combinedLineLayers = chartView.lineLayers[0].firstObject;
+    XCTAssertEqual(combinedLineLayers.count, 2);
+    XCTAssertNotNil((__bridge id)combinedLineLayers[0].path);
+    
+    // Appending keeps the layers and only fetches the new points
+    [dataSource.values addObject:@4];
+    [chartView reloadDataAppendingPointCount:1 removingPointCount:0];
+    [chartView layoutIfNeeded];
+    XCTAssertEqual(chartView.lineLayers[0].firstObject, combinedLineLayers);
+    XCTAssertEqualObjects(dataSource.requestedRanges.lastObject, [NSValue valueWithRange:NSMakeRange(3, 1)]);
+    XCTAssertEqual(chartView.dataPoints[0][3].maximumValue, 4);
+}
+
+- (void)testCombinedBarGraphAppendingNewStackSize {
+    ORKTestBarGraphChartViewDataSource *dataSource = [ORKTestBarGraphChartViewDataSource new];
+    ORKBarGraphChartView *chartView = [[ORKBarGraphChartView alloc] initWithFrame:CGRectMake(0, 0, 320, 200)];
+    chartView.drawsCombinedPlotPaths = YES;
+    chartView.dataSource = dataSource;
+    [chartView layoutIfNeeded];
+    XCTAssertEqual(chartView.lineLayers[0].firstObject.count, 0);
+    
+    [dataSource.stacks addObject:[[ORKValueStack alloc] initWithStackedValues:@[ @1 ]]];
+    [chartView reloadDataAppendingPointCount:1 removingPointCount:0];
+    XCTAssertNoThrow([chartView layoutIfNeeded]);
+    XCTAssertEqual(chartView.lineLayers[0].firstObject.count, 1);
+    
+    // A stack of two values adds two color runs, each with its own layer and color
+    [dataSource.stacks addObject:[[ORKValueStack alloc] initWithStackedValues:@[ @1, @2 ]]];
+    [chartView reloadDataAppendingPointCount:1 removingPointCount:0];
+    XCTAssertNoThrow([chartView layoutIfNeeded]);
+    NSArray<CAShapeLayer *> *lineLayers = chartView.lineLayers[0].firstObject;
+    XCTAssertEqual(lineLayers.count, 3);
+    XCTAssertFalse(CGColorEqualToColor(lineLayers[1].strokeColor, lineLayers[2].strokeColor));
+}
+
+@end
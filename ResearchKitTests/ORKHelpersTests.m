@@ -71,4 +71,11 @@
     }
 }
 
+- (void)testImagePNGRepresentationIsCachedPerImage {
+    UIImage *image = ORKImageWithColor([UIColor redColor]);
+    NSData *data = ORKImagePNGRepresentation(image);
+    XCTAssertEqualObjects(data, UIImagePNGRepresentation(image));
+    XCTAssertEqual(ORKImagePNGRepresentation(image), data);
+}
+
 @end
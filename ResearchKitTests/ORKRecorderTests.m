@@ -32,6 +32,12 @@
 @import XCTest;
 @import ResearchKit.Private;
 
+#import "CLLocation+ORKJSONDictionary.h"
+#import "CMAccelerometerData+ORKJSONDictionary.h"
+#import "CMDeviceMotion+ORKJSONDictionary.h"
+#import "ORKJSONWriter.h"
+#import "ORKMotionSensorHub.h"
+
 @import CoreLocation;
 @import CoreMotion;
 
@@ -86,6 +92,30 @@
 @end
 
 
+@interface ORKMockPositionedTouch : UITouch
+
+@property (nonatomic) CGPoint location;
+
+@end
+
+
+@implementation ORKMockPositionedTouch
+
+- (CGPoint)locationInView:(UIView *)view {
+    return self.location;
+}
+
+- (NSTimeInterval)timestamp {
+    return 3000.0;
+}
+
+- (UITouchPhase)phase {
+    return UITouchPhaseMoved;
+}
+
+@end
+
+
 @interface ORKMockMotionManager : CMMotionManager
 
 - (void)injectMotion:(CMDeviceMotion *)motion;
@@ -189,6 +219,22 @@
 @end
 
 
+@interface ORKMockTimedAccelerometerData : ORKMockAccelerometerData
+
+@property (nonatomic) NSTimeInterval mockTimestamp;
+
+@end
+
+
+@implementation ORKMockTimedAccelerometerData
+
+- (NSTimeInterval)timestamp {
+    return _mockTimestamp;
+}
+
+@end
+
+
 @interface ORKMockPedometerRecorder : ORKPedometerRecorder
 
 @property (nonatomic, strong) ORKMockPedometer* mockPedometer;
@@ -370,6 +416,10 @@ static const NSInteger kNumberOfSamples = 5;
 }
 
 - (void)checkResult {
+    [self checkResultWithItemCount:kNumberOfSamples];
+}
+
+- (void)checkResultWithItemCount:(NSUInteger)itemCount {
     
     XCTAssertNotNil(_result, @"");
     XCTAssert([_result isKindOfClass:[ORKFileResult class]], @"");
@@ -383,7 +433,7 @@ static const NSInteger kNumberOfSamples = 5;
     XCTAssertNotNil(dict, @"");
     
     NSArray *items = dict[@"items"];
-    XCTAssertEqual(items.count, kNumberOfSamples, @"");
+    XCTAssertEqual(items.count, itemCount, @"");
     
     _items = items;
 }
@@ -440,6 +490,48 @@ static const NSInteger kNumberOfSamples = 5;
     }
 }
 
+- (void)testLocationRecorderDecimation {
+    ORKLocationRecorderConfiguration *recorderConfiguration = [[ORKLocationRecorderConfiguration alloc] initWithIdentifier:@"location"];
+    recorderConfiguration.minimumDistance = 10.0;
+    recorderConfiguration.minimumTimeInterval = 60.0;
+    recorderConfiguration.maximumHorizontalAccuracy = 50.0;
+    ORKLocationRecorder *recorder = (ORKLocationRecorder *)[self createRecorder:recorderConfiguration];
+    XCTAssertEqual(recorder.minimumDistance, 10.0);
+    
+    ORKLocationRecorder *mockRecorder = [[ORKMockLocationRecorder alloc] initWithIdentifier:@"location"
+                                                                                       step:recorder.step
+                                                                            outputDirectory:recorder.outputDirectory];
+    mockRecorder.minimumDistance = recorder.minimumDistance;
+    mockRecorder.minimumTimeInterval = recorder.minimumTimeInterval;
+    mockRecorder.maximumHorizontalAccuracy = recorder.maximumHorizontalAccuracy;
+    mockRecorder.delegate = self;
+    [mockRecorder start];
+    
+    id<CLLocationManagerDelegate> clDelegate = (id<CLLocationManagerDelegate>)mockRecorder;
+    NSDate *start = [NSDate date];
+    CLLocation *(^makeLocation)(double, double, NSTimeInterval) = ^(double latitudeOffset, double horizontalAccuracy, NSTimeInterval time) {
+        return [[CLLocation alloc] initWithCoordinate:CLLocationCoordinate2DMake(37.31317 + latitudeOffset, -122.07238159997)
+                                             altitude:11.0
+                                   horizontalAccuracy:horizontalAccuracy
+                                     verticalAccuracy:13.0
+                                               course:14.0
+                                                speed:15.0
+                                            timestamp:[start dateByAddingTimeInterval:time]];
+    };
+    
+    // 0.0001 degrees of latitude is about 11 m
+    NSArray *locations = @[makeLocation(0, 12.0, 0),           // recorded: first fix
+                           makeLocation(0.00001, 12.0, 1),     // dropped: ~1 m, 1 s
+                           makeLocation(0.0002, 12.0, 2),      // recorded: ~22 m
+                           makeLocation(0.0004, 100.0, 3),     // dropped: inaccurate
+                           makeLocation(0.0002, 12.0, 70)];    // recorded: 68 s
+    [clDelegate locationManager:mockRecorder.locationManager didUpdateLocations:locations];
+    
+    [mockRecorder stop];
+    [self checkResultWithItemCount:3];
+    XCTAssertEqualObjects(_items[2][@"timestamp"], ORKStringFromDateISO8601([start dateByAddingTimeInterval:70]));
+}
+
 - (void)testAccelerometerRecorder {
     
     ORKAccelerometerRecorderConfiguration *recorderConfiguration = [[ORKAccelerometerRecorderConfiguration alloc] initWithIdentifier:@"accelerometer" frequency:60.0];
@@ -522,6 +614,119 @@ static const NSInteger kNumberOfSamples = 5;
     }
 }
 
+// Numbers are compared by value, since the dictionaries hold NSDecimalNumbers and parsed JSON holds doubles
+- (void)assertJSONObject:(id)object equalsJSONObject:(id)expectedObject path:(NSString *)path {
+    if ([expectedObject isKindOfClass:[NSDictionary class]]) {
+        XCTAssertTrue([object isKindOfClass:[NSDictionary class]], @"%@", path);
+        XCTAssertEqualObjects([NSSet setWithArray:[object allKeys]], [NSSet setWithArray:[expectedObject allKeys]], @"%@", path);
+        for (NSString *key in expectedObject) {
+            [self assertJSONObject:object[key] equalsJSONObject:expectedObject[key] path:[path stringByAppendingFormat:@".%@", key]];
+        }
+    } else if ([expectedObject isKindOfClass:[NSNumber class]]) {
+        XCTAssertTrue([object isKindOfClass:[NSNumber class]], @"%@", path);
+        XCTAssertTrue(ork_doubleEqual([object doubleValue], [expectedObject doubleValue]), @"%@: %@ != %@", path, object, expectedObject);
+    } else {
+        XCTAssertEqualObjects(object, expectedObject, @"%@", path);
+    }
+}
+
+- (void)testJSONWriterMatchesJSONDictionary {
+    CLLocation *location = [[CLLocation alloc] initWithCoordinate:CLLocationCoordinate2DMake(37.331705, -122.030237)
+                                                         altitude:61.5
+                                               horizontalAccuracy:5.0
+                                                 verticalAccuracy:3.25
+                                                           course:271.4
+                                                            speed:1.7
+                                                        timestamp:[NSDate dateWithTimeIntervalSinceReferenceDate:500000000.125]];
+    // Invalid accuracies, course and speed leave their keys out
+    CLLocation *partialLocation = [[CLLocation alloc] initWithCoordinate:CLLocationCoordinate2DMake(0.1, 0.2)
+                                                                altitude:0
+                                                      horizontalAccuracy:-1
+                                                        verticalAccuracy:-1
+                                                                  course:-1
+                                                                   speed:-1
+                                                               timestamp:[NSDate dateWithTimeIntervalSinceReferenceDate:0]];
+    NSArray *samples = @[ [ORKMockAccelerometerData new], [ORKMockDeviceMotion new], location, partialLocation ];
+    
+    ORKJSONWriter *writer = [ORKJSONWriter new];
+    for (id sample in samples) {
+        [sample ork_writeJSONToWriter:writer];
+    }
+    XCTAssertEqual(writer.itemCount, samples.count);
+    
+    // The writer separates items, so its output is the contents of a JSON array
+    NSMutableData *arrayData = [[@"[" dataUsingEncoding:NSUTF8StringEncoding] mutableCopy];
+    [arrayData appendData:writer.data];
+    [arrayData appendData:[@"]" dataUsingEncoding:NSUTF8StringEncoding]];
+    NSError *error = nil;
+    NSArray *items = [NSJSONSerialization JSONObjectWithData:arrayData options:(NSJSONReadingOptions)0 error:&error];
+    XCTAssertNil(error);
+    XCTAssertEqual(items.count, samples.count);
+    
+    for (NSUInteger index = 0; index < MIN(items.count, samples.count); index++) {
+        NSDictionary *expected = [samples[index] ork_JSONDictionary];
+        [self assertJSONObject:items[index] equalsJSONObject:expected path:NSStringFromClass([samples[index] class])];
+    }
+    XCTAssertNil(items.lastObject[@"coordinate"]);
+    XCTAssertNil(items.lastObject[@"speed"]);
+}
+
+- (void)testMotionSensorHub {
+    ORKMockMotionManager *manager = [ORKMockMotionManager new];
+    ORKMotionSensorHub *hub = [ORKMotionSensorHub hubForMotionManager:manager];
+    XCTAssertEqual(hub, [ORKMotionSensorHub hubForMotionManager:manager]);
+    XCTAssertNotEqual(hub, [ORKMotionSensorHub sharedHub]);
+    
+    __block NSInteger fastCount = 0;
+    __block NSInteger slowCount = 0;
+    id fastObserver = [hub addAccelerometerObserverWithFrequency:100.0 handler:^(CMAccelerometerData *data, NSError *error) {
+        fastCount++;
+    }];
+    id slowObserver = [hub addAccelerometerObserverWithFrequency:25.0 handler:^(CMAccelerometerData *data, NSError *error) {
+        slowCount++;
+    }];
+    XCTAssertTrue(ork_doubleEqual(manager.accelerometerUpdateInterval, 0.01));
+    
+    // One second of samples at the sensor rate reaches the slower observer at a quarter of the rate
+    ORKMockTimedAccelerometerData *data = [ORKMockTimedAccelerometerData new];
+    for (NSInteger i = 0; i < 100; i++) {
+        data.mockTimestamp = 1000.0 + i * 0.01;
+        [manager injectAccelerometerData:data];
+    }
+    XCTAssertEqual(fastCount, 100);
+    XCTAssertEqual(slowCount, 25);
+    
+    [hub removeObserver:fastObserver];
+    XCTAssertTrue(ork_doubleEqual(manager.accelerometerUpdateInterval, 0.04));
+    
+    [hub removeObserver:slowObserver];
+    data.mockTimestamp = 2000.0;
+    [manager injectAccelerometerData:data];
+    XCTAssertEqual(slowCount, 25);
+}
+
+- (void)testMotionSensorHubDropsSamplesForRemovedObservers {
+    ORKMockMotionManager *manager = [ORKMockMotionManager new];
+    ORKMotionSensorHub *hub = [ORKMotionSensorHub hubForMotionManager:manager];
+    
+    // The first observer removes the second while a sample is being delivered to both
+    __block NSInteger removedCount = 0;
+    __block id removedObserver = nil;
+    id observer = [hub addAccelerometerObserverWithFrequency:100.0 handler:^(CMAccelerometerData *data, NSError *error) {
+        [hub removeObserver:removedObserver];
+    }];
+    removedObserver = [hub addAccelerometerObserverWithFrequency:100.0 handler:^(CMAccelerometerData *data, NSError *error) {
+        removedCount++;
+    }];
+    
+    ORKMockTimedAccelerometerData *data = [ORKMockTimedAccelerometerData new];
+    data.mockTimestamp = 1000.0;
+    [manager injectAccelerometerData:data];
+    XCTAssertEqual(removedCount, 0);
+    
+    [hub removeObserver:observer];
+}
+
 - (void)testPedometerRecorder {
     
     Class recorderClass = [ORKPedometerRecorder class];
@@ -593,6 +798,57 @@ static const NSInteger kNumberOfSamples = 5;
     }
 }
 
+- (void)testTouchRecorderMultiTouch {
+    ORKTouchRecorder *recorder = (ORKTouchRecorder *)[self createRecorder:[[ORKTouchRecorderConfiguration alloc] initWithIdentifier:@"touch"]];
+    
+    UIView *view = [[UIView alloc] initWithFrame:CGRectMake(0, 0, 300, 400)];
+    [recorder viewController:[UIViewController new] willStartStepWithView:view];
+    [recorder start];
+    
+    ORKMockPositionedTouch *firstTouch = [ORKMockPositionedTouch new];
+    firstTouch.location = CGPointMake(10.0, 10.0);
+    ORKMockPositionedTouch *secondTouch = [ORKMockPositionedTouch new];
+    secondTouch.location = CGPointMake(20.0, 20.0);
+    ORKMockPositionedTouch *thirdTouch = [ORKMockPositionedTouch new];
+    thirdTouch.location = CGPointMake(30.0, 30.0);
+    
+    NSArray<NSSet<UITouch *> *> *frames = @[[NSSet setWithObjects:firstTouch, secondTouch, nil],
+                                            [NSSet setWithObjects:secondTouch, firstTouch, nil],
+                                            [NSSet setWithObjects:thirdTouch, secondTouch, nil]];
+    
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wundeclared-selector"
+    
+    for (NSSet<UITouch *> *touches in frames) {
+        [recorder performSelector:@selector(view:didDetectTouches:) withObject:view withObject:touches];
+        
+        // Touches from one frame are buffered together and written after the run loop pass
+        ORKJSONWriter *writer = [recorder valueForKey:@"writer"];
+        XCTAssertEqual(writer.itemCount, touches.count);
+        [[NSRunLoop mainRunLoop] runUntilDate:[NSDate dateWithTimeIntervalSinceNow:0.05]];
+        XCTAssertEqual(writer.itemCount, 0);
+    }
+    
+#pragma clang diagnostic pop
+    
+    [recorder stop];
+    [self checkResultWithItemCount:6];
+    
+    // A touch keeps the index of its first appearance in every later frame
+    NSMutableDictionary<NSNumber *, NSNumber *> *indexForX = [NSMutableDictionary new];
+    for (NSDictionary *sample in _items) {
+        NSNumber *x = @(((NSNumber *)sample[@"x"]).integerValue);
+        NSNumber *index = @(((NSNumber *)sample[@"index"]).integerValue);
+        if (indexForX[x]) {
+            XCTAssertEqualObjects(indexForX[x], index);
+        }
+        indexForX[x] = index;
+    }
+    XCTAssertEqual(indexForX.count, 3);
+    XCTAssertEqual([NSSet setWithArray:indexForX.allValues].count, 3);
+    XCTAssertEqualObjects(indexForX[@30], @2);
+}
+
 - (void)testAudioRecorder {
     
     ORKAudioRecorderConfiguration *recorderConfiguration = [[ORKAudioRecorderConfiguration alloc] initWithIdentifier:@"audio" recorderSettings:@{}];
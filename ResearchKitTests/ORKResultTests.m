@@ -33,6 +33,28 @@
 @import ResearchKit.Private;
 
 
+// Returns the uncompressed contents of the entry at `path`, walking the local headers of the archive
+static NSData *ORKArchiveEntryData(NSData *archive, NSString *path) API_AVAILABLE(ios(13.0)) {
+    const uint8_t *bytes = archive.bytes;
+    NSUInteger offset = 0;
+    while (offset + 30 <= archive.length && memcmp(bytes + offset, "PK\x03\x04", 4) == 0) {
+        const uint8_t *header = bytes + offset;
+        uint16_t method = header[8] | (header[9] << 8);
+        uint32_t compressedSize = header[18] | (header[19] << 8) | (header[20] << 16) | ((uint32_t)header[21] << 24);
+        uint16_t nameLength = header[26] | (header[27] << 8);
+        uint16_t extraLength = header[28] | (header[29] << 8);
+        NSString *name = [[NSString alloc] initWithBytes:header + 30 length:nameLength encoding:NSUTF8StringEncoding];
+        NSUInteger dataOffset = offset + 30 + nameLength + extraLength;
+        if ([name isEqualToString:path]) {
+            NSData *data = [archive subdataWithRange:NSMakeRange(dataOffset, compressedSize)];
+            return (method == 0) ? data : [data decompressedDataUsingAlgorithm:NSDataCompressionAlgorithmZlib error:nil];
+        }
+        offset = dataOffset + compressedSize;
+    }
+    return nil;
+}
+
+
 @interface ORKResultTests : XCTestCase
 
 @end
@@ -194,4 +216,126 @@
     XCTAssertEqualObjects(inputResult.results, flattedResults);
 }
 
+- (void)testResultArchiveWriter {
+    NSURL *directory = [NSURL fileURLWithPath:[NSTemporaryDirectory() stringByAppendingPathComponent:[NSUUID UUID].UUIDString] isDirectory:YES];
+    [[NSFileManager defaultManager] createDirectoryAtURL:directory withIntermediateDirectories:YES attributes:nil error:nil];
+    
+    NSData *audioData = [@"already-compressed-audio" dataUsingEncoding:NSUTF8StringEncoding];
+    NSURL *audioURL = [directory URLByAppendingPathComponent:@"audio.m4a"];
+    [audioData writeToURL:audioURL atomically:YES];
+    NSURL *logURL = [directory URLByAppendingPathComponent:@"accel.json"];
+    [[@"{\"items\":[]}" dataUsingEncoding:NSUTF8StringEncoding] writeToURL:logURL atomically:YES];
+    
+    ORKFileResult *audioResult = [[ORKFileResult alloc] initWithIdentifier:@"audio"];
+    audioResult.fileURL = audioURL;
+    ORKFileResult *logResult = [[ORKFileResult alloc] initWithIdentifier:@"accel"];
+    logResult.fileURL = logURL;
+    ORKStepResult *stepResult = [[ORKStepResult alloc] initWithStepIdentifier:@"walk" results:@[audioResult, logResult]];
+    ORKTaskResult *taskResult = [[ORKTaskResult alloc] initWithTaskIdentifier:@"task" taskRunUUID:[NSUUID UUID] outputDirectory:directory];
+    taskResult.results = @[stepResult];
+    
+    NSURL *archiveURL = [directory URLByAppendingPathComponent:@"run.zip"];
+    ORKResultArchiveWriter *writer = [[ORKResultArchiveWriter alloc] initWithArchiveURL:archiveURL];
+    [writer appendStepResult:stepResult];
+    [writer appendStepResult:stepResult];
+    XCTestExpectation *expectation = [self expectationWithDescription:@"finish"];
+    [writer finishWithTaskResult:taskResult completionHandler:^(NSError *error) {
+        XCTAssertNil(error);
+        XCTAssertTrue([NSThread isMainThread]);
+        [expectation fulfill];
+    }];
+    [self waitForExpectationsWithTimeout:5.0 handler:nil];
+    
+    NSData *archive = [NSData dataWithContentsOfURL:archiveURL];
+    XCTAssertGreaterThan(archive.length, 22);
+    const uint8_t *bytes = archive.bytes;
+    XCTAssertEqual(memcmp(bytes, "PK\x03\x04", 4), 0);
+    
+    // The end of central directory record has no comment, so it is the last 22 bytes
+    const uint8_t *endRecord = bytes + archive.length - 22;
+    XCTAssertEqual(memcmp(endRecord, "PK\x05\x06", 4), 0);
+    uint16_t entryCount = endRecord[10] | (endRecord[11] << 8);
+    XCTAssertEqual(entryCount, 4, @"Two files, the result, and the manifest, each archived once");
+    
+    // Audio is stored, not deflated
+    XCTAssertNotEqual([archive rangeOfData:audioData options:0 range:NSMakeRange(0, archive.length)].location, NSNotFound);
+    
+    ORKResultArchiveWriter *cancelledWriter = [[ORKResultArchiveWriter alloc] initWithArchiveURL:[directory URLByAppendingPathComponent:@"cancelled.zip"]];
+    [cancelledWriter appendStepResult:stepResult];
+    [cancelledWriter cancel];
+    XCTAssertFalse([[NSFileManager defaultManager] fileExistsAtPath:cancelledWriter.archiveURL.path]);
+    
+    // A missing file fails the archive with an error instead of an exception
+    ORKFileResult *missingResult = [[ORKFileResult alloc] initWithIdentifier:@"missing"];
+    missingResult.fileURL = [directory URLByAppendingPathComponent:@"missing.json"];
+    ORKTaskResult *missingTaskResult = [[ORKTaskResult alloc] initWithTaskIdentifier:@"task" taskRunUUID:[NSUUID UUID] outputDirectory:directory];
+    missingTaskResult.results = @[[[ORKStepResult alloc] initWithStepIdentifier:@"walk" results:@[missingResult]]];
+    ORKResultArchiveWriter *failingWriter = [[ORKResultArchiveWriter alloc] initWithArchiveURL:[directory URLByAppendingPathComponent:@"failed.zip"]];
+    XCTestExpectation *failureExpectation = [self expectationWithDescription:@"fail"];
+    [failingWriter finishWithTaskResult:missingTaskResult completionHandler:^(NSError *error) {
+        XCTAssertNotNil(error);
+        [failureExpectation fulfill];
+    }];
+    [self waitForExpectationsWithTimeout:5.0 handler:nil];
+    XCTAssertFalse([[NSFileManager defaultManager] fileExistsAtPath:failingWriter.archiveURL.path]);
+    
+    [[NSFileManager defaultManager] removeItemAtURL:directory error:nil];
+}
+
+- (void)testResultArchiveWriterRearchivesRewrittenFiles {
+    if (@available(iOS 13.0, *)) {
+        NSURL *directory = [NSURL fileURLWithPath:[NSTemporaryDirectory() stringByAppendingPathComponent:[NSUUID UUID].UUIDString] isDirectory:YES];
+        [[NSFileManager defaultManager] createDirectoryAtURL:directory withIntermediateDirectories:YES attributes:nil error:nil];
+        
+        NSData *firstAudioData = [@"first-recording" dataUsingEncoding:NSUTF8StringEncoding];
+        NSData *secondAudioData = [@"second-longer-recording" dataUsingEncoding:NSUTF8StringEncoding];
+        NSURL *audioURL = [directory URLByAppendingPathComponent:@"audio.m4a"];
+        [firstAudioData writeToURL:audioURL atomically:YES];
+        NSURL *discardedURL = [directory URLByAppendingPathComponent:@"discarded.m4a"];
+        [[@"discarded-recording" dataUsingEncoding:NSUTF8StringEncoding] writeToURL:discardedURL atomically:YES];
+        
+        ORKFileResult *audioResult = [[ORKFileResult alloc] initWithIdentifier:@"audio"];
+        audioResult.fileURL = audioURL;
+        ORKStepResult *stepResult = [[ORKStepResult alloc] initWithStepIdentifier:@"record" results:@[audioResult]];
+        ORKFileResult *discardedResult = [[ORKFileResult alloc] initWithIdentifier:@"audio"];
+        discardedResult.fileURL = discardedURL;
+        ORKStepResult *discardedStepResult = [[ORKStepResult alloc] initWithStepIdentifier:@"retake" results:@[discardedResult]];
+        ORKTaskResult *taskResult = [[ORKTaskResult alloc] initWithTaskIdentifier:@"task" taskRunUUID:[NSUUID UUID] outputDirectory:directory];
+        taskResult.results = @[stepResult];
+        
+        NSURL *archiveURL = [directory URLByAppendingPathComponent:@"run.zip"];
+        ORKResultArchiveWriter *writer = [[ORKResultArchiveWriter alloc] initWithArchiveURL:archiveURL];
+        [writer appendStepResult:discardedStepResult];
+        [writer appendStepResult:stepResult];
+        
+        // Wait for the first version to be archived, which is stored as is, before rewriting the file
+        NSPredicate *archivedPredicate = [NSPredicate predicateWithBlock:^BOOL(NSURL *url, NSDictionary *bindings) {
+            NSData *archive = [NSData dataWithContentsOfURL:url];
+            return archive && [archive rangeOfData:firstAudioData options:0 range:NSMakeRange(0, archive.length)].location != NSNotFound;
+        }];
+        [self expectationForPredicate:archivedPredicate evaluatedWithObject:archiveURL handler:nil];
+        [self waitForExpectationsWithTimeout:5.0 handler:nil];
+        [secondAudioData writeToURL:audioURL atomically:YES];
+        
+        XCTestExpectation *expectation = [self expectationWithDescription:@"finish"];
+        [writer finishWithTaskResult:taskResult completionHandler:^(NSError *error) {
+            XCTAssertNil(error);
+            [expectation fulfill];
+        }];
+        [self waitForExpectationsWithTimeout:5.0 handler:nil];
+        
+        NSData *archive = [NSData dataWithContentsOfURL:archiveURL];
+        XCTAssertNotEqual([archive rangeOfData:secondAudioData options:0 range:NSMakeRange(0, archive.length)].location, NSNotFound);
+        NSData *manifestData = ORKArchiveEntryData(archive, @"manifest.json");
+        XCTAssertNotNil(manifestData);
+        NSDictionary *manifest = [NSJSONSerialization JSONObjectWithData:manifestData options:0 error:nil];
+        NSArray<NSDictionary *> *fileEntries = [manifest[@"entries"] filteredArrayUsingPredicate:[NSPredicate predicateWithFormat:@"fileURL != nil"]];
+        XCTAssertEqualObjects([fileEntries valueForKey:@"path"], (@[@"files/discarded.m4a", @"files/audio.m4a", @"files/audio-2.m4a"]));
+        XCTAssertEqualObjects([fileEntries valueForKey:@"abandoned"], (@[@YES, @YES, @NO]));
+        XCTAssertEqualObjects(fileEntries[2][@"size"], @(secondAudioData.length));
+        
+        [[NSFileManager defaultManager] removeItemAtURL:directory error:nil];
+    }
+}
+
 @end
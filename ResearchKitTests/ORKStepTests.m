@@ -32,6 +32,8 @@
 @import XCTest;
 @import ResearchKit.Private;
 
+#import "ORKTappingIntervalStepViewController_Internal.h"
+
 
 @interface ORKStepTests : XCTestCase
 
@@ -161,6 +163,59 @@
     XCTAssertEqualObjects([pageStep stepWithIdentifier:@"step3"], step3);
 }
 
+- (void)testTappingIntervalSampleBuffers {
+    ORKTappingIntervalStep *step = [[ORKTappingIntervalStep alloc] initWithIdentifier:@"tapping"];
+    ORKTappingIntervalStepViewController *stepViewController = [[ORKTappingIntervalStepViewController alloc] initWithStep:step];
+    XCTAssertNil([stepViewController samples]);
+    
+    [stepViewController resetSamples];
+    XCTAssertEqualObjects([stepViewController samples], @[]);
+    
+    [stepViewController appendSampleWithButton:ORKTappingButtonIdentifierLeft location:CGPointMake(10, 20) timestamp:1.0];
+    [stepViewController appendSampleWithButton:ORKTappingButtonIdentifierRight location:CGPointMake(30, 40) timestamp:1.5];
+    [stepViewController appendSampleWithButton:ORKTappingButtonIdentifierLeft location:CGPointMake(11, 21) timestamp:2.0];
+    [stepViewController appendSampleWithButton:ORKTappingButtonIdentifierNone location:CGPointMake(50, 60) timestamp:2.5];
+    
+    // Releases outside the buttons complete nothing; a release completes the latest sample held on its button
+    [stepViewController completePendingSampleForButton:ORKTappingButtonIdentifierNone mediaTime:3.0];
+    [stepViewController completePendingSampleForButton:ORKTappingButtonIdentifierLeft mediaTime:2.25];
+    [stepViewController completePendingSampleForButton:ORKTappingButtonIdentifierRight mediaTime:1.75];
+    [stepViewController completePendingSampleForButton:ORKTappingButtonIdentifierLeft mediaTime:3.0];
+    [stepViewController completePendingSampleForButton:ORKTappingButtonIdentifierLeft mediaTime:4.0];
+    
+    NSArray<ORKTappingSample *> *samples = [stepViewController samples];
+    XCTAssertEqual(samples.count, 4);
+    const ORKTappingButtonIdentifier expectedButtons[] = { ORKTappingButtonIdentifierLeft, ORKTappingButtonIdentifierRight, ORKTappingButtonIdentifierLeft, ORKTappingButtonIdentifierNone };
+    const CGPoint expectedLocations[] = { CGPointMake(10, 20), CGPointMake(30, 40), CGPointMake(11, 21), CGPointMake(50, 60) };
+    const NSTimeInterval expectedTimestamps[] = { 1.0, 1.5, 2.0, 2.5 };
+    const NSTimeInterval expectedDurations[] = { 2.0, 0.25, 0.25, 0 };
+    for (NSUInteger index = 0; index < MIN(samples.count, 4); index++) {
+        XCTAssertEqual(samples[index].buttonIdentifier, expectedButtons[index]);
+        XCTAssertTrue(CGPointEqualToPoint(samples[index].location, expectedLocations[index]));
+        XCTAssertEqual(samples[index].timestamp, expectedTimestamps[index]);
+        XCTAssertEqual(samples[index].duration, expectedDurations[index]);
+    }
+    
+    // The materialized samples are reused until the buffers change
+    XCTAssertEqual([stepViewController samples], samples);
+    
+    // The buffers grow past their initial capacity
+    for (NSUInteger index = 0; index < 1000; index++) {
+        [stepViewController appendSampleWithButton:ORKTappingButtonIdentifierRight location:CGPointMake(index, index) timestamp:3.0 + index];
+    }
+    [stepViewController completePendingSampleForButton:ORKTappingButtonIdentifierRight mediaTime:1003.5];
+    NSArray<ORKTappingSample *> *grownSamples = [stepViewController samples];
+    XCTAssertNotEqual(grownSamples, samples);
+    XCTAssertEqual(grownSamples.count, 1004);
+    XCTAssertEqual(grownSamples.lastObject.timestamp, 1002.0);
+    XCTAssertEqual(grownSamples.lastObject.duration, 1.5);
+    XCTAssertEqual(grownSamples[1002].duration, 0);
+    XCTAssertTrue(CGPointEqualToPoint(grownSamples.lastObject.location, CGPointMake(999, 999)));
+    
+    [stepViewController resetSamples];
+    XCTAssertEqualObjects([stepViewController samples], @[]);
+}
+
 @end
 
 
@@ -0,0 +1,132 @@
+/*
+ Copyright (c) 2026, CareEvolution, Inc.
+ 
+ Redistribution and use in source and binary forms, with or without modification,
+ are permitted provided that the following conditions are met:
+ 
+ 1.  Redistributions of source code must retain the above copyright notice, this
+ list of conditions and the following disclaimer.
+ 
+ 2.  Redistributions in binary form must reproduce the above copyright notice,
+ this list of conditions and the following disclaimer in the documentation and/or
+ other materials provided with the distribution.
+ 
+ 3.  Neither the name of the copyright holder(s) nor the names of any contributors
+ may be used to endorse or promote products derived from this software without
+ specific prior written permission. No license is granted to the trademarks of
+ the copyright holders even if such marks are included in this software.
+ 
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE
+ FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+@import XCTest;
+@import ResearchKit;
+
+
+@interface ORKStrokeTests : XCTestCase
+
+@end
+
+
+@implementation ORKStrokeTests
+
+- (ORKStroke *)strokeWithCount:(NSUInteger)count startingAt:(NSTimeInterval)timestamp {
+    ORKStrokePoint *points = calloc(count, sizeof(ORKStrokePoint));
+    for (NSUInteger i = 0; i < count; i++) {
+        points[i] = (ORKStrokePoint){
+            .location = CGPointMake(10 + i * 2.125, 40 - i * 0.5),
+            .timestamp = timestamp + i * 0.008,
+            .force = (i % 4) * 0.25
+        };
+    }
+    ORKStroke *stroke = [[ORKStroke alloc] initWithPoints:points count:count];
+    free(points);
+    return stroke;
+}
+
+- (void)testInitWithPoints_quantizesSamples {
+    ORKStrokePoint points[] = {
+        { CGPointMake(1.06, 2.2), 1000.00049, 0.505 },
+    };
+    ORKStrokePoint point = [[[ORKStroke alloc] initWithPoints:points count:1] pointAtIndex:0];
+    XCTAssertEqual(point.location.x, 1.0);
+    XCTAssertEqual(point.location.y, 2.25);
+    XCTAssertEqual(point.timestamp, 1000.0);
+    XCTAssertEqual(point.force, 0.5);
+}
+
+- (void)testDataWithStrokes_roundTripsSamples {
+    NSArray<ORKStroke *> *strokes = @[[self strokeWithCount:50 startingAt:1000.0],
+                                      [self strokeWithCount:0 startingAt:0],
+                                      [self strokeWithCount:20 startingAt:1001.5],
+                                      [self strokeWithCount:20 startingAt:86400.0123456]];
+    NSData *data = [ORKStroke dataWithStrokes:strokes];
+    
+    NSError *error = nil;
+    NSArray<ORKStroke *> *decoded = [ORKStroke strokesWithData:data error:&error];
+    XCTAssertNil(error);
+    XCTAssertEqualObjects(decoded, strokes);
+}
+
+- (void)testDataWithStrokes_isSmallerThanRawSamples {
+    ORKStroke *stroke = [self strokeWithCount:500 startingAt:1000.0];
+    NSData *data = [ORKStroke dataWithStrokes:@[stroke]];
+    XCTAssertLessThan(data.length, 500 * 8);
+}
+
+- (void)testStrokesWithData_rejectsMalformedData {
+    NSError *error = nil;
+    XCTAssertNil([ORKStroke strokesWithData:[@"not strokes" dataUsingEncoding:NSUTF8StringEncoding] error:&error]);
+    XCTAssertEqualObjects(error.domain, ORKErrorDomain);
+    
+    NSData *data = [ORKStroke dataWithStrokes:@[[self strokeWithCount:10 startingAt:0]]];
+    error = nil;
+    XCTAssertNil([ORKStroke strokesWithData:[data subdataWithRange:NSMakeRange(0, data.length - 3)] error:&error]);
+    XCTAssertEqual(error.code, ORKErrorInvalidObject);
+}
+
+- (void)testStrokeBySmoothing_averagesInteriorLocations {
+    ORKStrokePoint points[] = {
+        { CGPointMake(0, 0), 0, 0 },
+        { CGPointMake(3, 3), 1, 0 },
+        { CGPointMake(0, 0), 2, 0 },
+        { CGPointMake(3, 3), 3, 0 },
+    };
+    ORKStroke *smoothed = [[[ORKStroke alloc] initWithPoints:points count:4] strokeBySmoothingWithWindowSize:3];
+    XCTAssertEqual([smoothed pointAtIndex:0].location.x, 0);
+    XCTAssertEqual([smoothed pointAtIndex:1].location.x, 1);
+    XCTAssertEqual([smoothed pointAtIndex:2].location.x, 2);
+    XCTAssertEqual([smoothed pointAtIndex:3].location.x, 3);
+    XCTAssertEqual([smoothed pointAtIndex:2].timestamp, 2);
+}
+
+- (void)testSignatureResultArchivesStrokes {
+    ORKSignatureResult *result = [[ORKSignatureResult alloc] initWithIdentifier:@"signature"];
+    result.strokes = @[[self strokeWithCount:8 startingAt:0]];
+    
+    NSData *archive = [NSKeyedArchiver archivedDataWithRootObject:result];
+    ORKSignatureResult *decoded = [NSKeyedUnarchiver unarchiveObjectWithData:archive];
+    XCTAssertEqualObjects(decoded.strokes, result.strokes);
+    XCTAssertEqualObjects(decoded, result);
+}
+
+- (void)testAmslerGridResultArchivesStrokes {
+    ORKAmslerGridResult *result = [[ORKAmslerGridResult alloc] initWithIdentifier:@"amslerGrid"];
+    result.strokes = @[[self strokeWithCount:8 startingAt:500.25], [self strokeWithCount:3 startingAt:501.0]];
+    
+    NSData *archive = [NSKeyedArchiver archivedDataWithRootObject:result];
+    ORKAmslerGridResult *decoded = [NSKeyedUnarchiver unarchiveObjectWithData:archive];
+    XCTAssertEqualObjects(decoded, result);
+}
+
+@end
@@ -32,6 +32,8 @@
 @import XCTest;
 @import ResearchKit.Private;
 
+#import "ORKTaskViewController_Internal.h"
+
 
 @interface ORKTaskTests : XCTestCase
 
@@ -1419,6 +1421,29 @@ static ORKStepResult *(^getConsentStepResult)(NSString *, NSString *, BOOL) = ^O
                                      taskResults:taskResults];
 }
 
+- (void)testResultIdentifiersReferencedByPredicate {
+    ORKResultSelector *resultSelector = [ORKResultSelector selectorWithStepIdentifier:@"form" resultIdentifier:@"smoker"];
+    NSPredicate *predicate = [ORKResultPredicate predicateForBooleanQuestionResultWithResultSelector:resultSelector
+                                                                                      expectedAnswer:NO];
+    NSSet *identifiers = [ORKResultPredicate resultIdentifiersReferencedByPredicate:predicate];
+    XCTAssertTrue([identifiers containsObject:@"form"]);
+    XCTAssertTrue([identifiers containsObject:@"smoker"]);
+    
+    ORKResultSelector *otherSelector = [ORKResultSelector selectorWithStepIdentifier:@"form" resultIdentifier:@"age"];
+    NSPredicate *compoundPredicate = [NSCompoundPredicate orPredicateWithSubpredicates:@[predicate, [ORKResultPredicate predicateForNilQuestionResultWithResultSelector:otherSelector]]];
+    identifiers = [ORKResultPredicate resultIdentifiersReferencedByPredicate:compoundPredicate];
+    XCTAssertTrue([identifiers containsObject:@"smoker"]);
+    XCTAssertTrue([identifiers containsObject:@"age"]);
+    
+    XCTAssertEqualObjects([ORKResultPredicate resultIdentifiersReferencedByPredicate:[NSPredicate predicateWithValue:YES]], [NSSet set]);
+    
+    NSPredicate *blockPredicate = [NSPredicate predicateWithBlock:^BOOL(id evaluatedObject, NSDictionary *bindings) {
+        return YES;
+    }];
+    XCTAssertNil([ORKResultPredicate resultIdentifiersReferencedByPredicate:blockPredicate]);
+    XCTAssertNil([ORKResultPredicate resultIdentifiersReferencedByPredicate:[NSPredicate predicateWithFormat:@"SUBQUERY(SELF, $x, $x.identifier BEGINSWITH 'sm').@count > 0"]]);
+}
+
 - (void)testStepViewControllerWillDisappear {
     TestTaskViewControllerDelegate *delegate = [[TestTaskViewControllerDelegate alloc] init];
     ORKOrderedTask *task = [ORKOrderedTask twoFingerTappingIntervalTaskWithIdentifier:@"test" intendedUseDescription:nil duration:30 handOptions:0 options:0];
@@ -1437,6 +1462,237 @@ static ORKStepResult *(^getConsentStepResult)(NSString *, NSString *, BOOL) = ^O
     
 }
 
+- (void)testConsecutiveResultsShareUnchangedQuestionResults {
+    ORKStep *step = [ORKQuestionStep questionStepWithIdentifier:@"question" title:nil answer:[ORKAnswerFormat booleanAnswerFormat]];
+    ORKOrderedTask *task = [[ORKOrderedTask alloc] initWithIdentifier:@"task" steps:@[step]];
+    ORKTaskViewController *taskViewController = [[ORKTaskViewController alloc] initWithTask:task taskRunUUID:nil];
+    [taskViewController addManagedStepIdentifier:@"question"];
+    
+    NSDate *answerDate = [NSDate dateWithTimeIntervalSinceReferenceDate:0];
+    ORKStepResult *(^makeStepResult)(NSNumber *) = ^(NSNumber *answer) {
+        ORKBooleanQuestionResult *questionResult = [[ORKBooleanQuestionResult alloc] initWithIdentifier:@"question"];
+        questionResult.booleanAnswer = answer;
+        questionResult.startDate = answerDate;
+        questionResult.endDate = answerDate;
+        return [[ORKStepResult alloc] initWithStepIdentifier:@"question" results:@[questionResult]];
+    };
+    
+    // Each call stands in for `-result` asking the step view controller for a new result, whose own
+    // end date moves on while the answer is unchanged.
+    [taskViewController setManagedResult:makeStepResult(@YES) forKey:@"question"];
+    ORKTaskResult *firstResult = [taskViewController result];
+    ORKStepResult *laterStepResult = makeStepResult(@YES);
+    laterStepResult.endDate = [NSDate dateWithTimeIntervalSinceNow:1];
+    [taskViewController setManagedResult:laterStepResult forKey:@"question"];
+    ORKTaskResult *secondResult = [taskViewController result];
+    
+    ORKResult *firstQuestionResult = [firstResult stepResultForStepIdentifier:@"question"].firstResult;
+    XCTAssertNotNil(firstQuestionResult);
+    XCTAssertEqual(firstQuestionResult, [secondResult stepResultForStepIdentifier:@"question"].firstResult);
+    XCTAssertEqualObjects([secondResult stepResultForStepIdentifier:@"question"].endDate, laterStepResult.endDate);
+    
+    // An equal result keeps the stored one
+    ORKStepResult *storedResult = [taskViewController managedResultForKey:@"question"];
+    [taskViewController setManagedResult:[laterStepResult copy] forKey:@"question"];
+    XCTAssertEqual([taskViewController managedResultForKey:@"question"], storedResult);
+    
+    [taskViewController setManagedResult:makeStepResult(@NO) forKey:@"question"];
+    ORKTaskResult *changedResult = [taskViewController result];
+    ORKBooleanQuestionResult *changedQuestionResult = (ORKBooleanQuestionResult *)[changedResult stepResultForStepIdentifier:@"question"].firstResult;
+    XCTAssertNotEqual(firstQuestionResult, changedQuestionResult);
+    XCTAssertEqualObjects(changedQuestionResult.booleanAnswer, @NO);
+}
+
+static NSData *ORKManagedResultsArchive(ORKTaskViewController *taskViewController) {
+    NSMutableData *data = [NSMutableData new];
+    NSKeyedArchiver *archiver = [[NSKeyedArchiver alloc] initForWritingWithMutableData:data];
+    [taskViewController encodeManagedResultsWithCoder:archiver];
+    [archiver finishEncoding];
+    return data;
+}
+
+static ORKTaskViewController *ORKManagedResultsTaskViewController(void) {
+    ORKOrderedTask *task = [[ORKOrderedTask alloc] initWithIdentifier:@"task" steps:@[[[ORKInstructionStep alloc] initWithIdentifier:@"step"]]];
+    return [[ORKTaskViewController alloc] initWithTask:task taskRunUUID:nil];
+}
+
+static ORKTaskViewController *ORKTaskViewControllerRestoringManagedResults(NSData *data) {
+    ORKTaskViewController *taskViewController = ORKManagedResultsTaskViewController();
+    NSKeyedUnarchiver *unarchiver = [[NSKeyedUnarchiver alloc] initForReadingWithData:data];
+    [taskViewController decodeManagedResultsWithCoder:unarchiver];
+    [unarchiver finishDecoding];
+    return taskViewController;
+}
+
+- (void)testRevisitedStepResultsKeepTheirOwnDates {
+    ORKTaskViewController *taskViewController = ORKManagedResultsTaskViewController();
+    ORKStepResult *(^makeStepResult)(NSString *, NSTimeInterval) = ^(NSString *identifier, NSTimeInterval interval) {
+        ORKBooleanQuestionResult *questionResult = [[ORKBooleanQuestionResult alloc] initWithIdentifier:@"question"];
+        questionResult.booleanAnswer = @YES;
+        questionResult.startDate = [NSDate dateWithTimeIntervalSinceReferenceDate:interval];
+        questionResult.endDate = [NSDate dateWithTimeIntervalSinceReferenceDate:interval + 1];
+        ORKStepResult *stepResult = [[ORKStepResult alloc] initWithStepIdentifier:identifier results:@[questionResult]];
+        stepResult.startDate = questionResult.startDate;
+        stepResult.endDate = questionResult.endDate;
+        return stepResult;
+    };
+    
+    // A loop visits "loop", "other" and then "loop" again with the same answer
+    ORKStepResult *firstVisitResult = makeStepResult(@"loop", 0);
+    ORKStepResult *otherResult = makeStepResult(@"other", 10);
+    ORKStepResult *secondVisitResult = makeStepResult(@"loop", 20);
+    [taskViewController addManagedStepIdentifier:@"loop"];
+    [taskViewController setManagedResult:firstVisitResult forKey:@"loop"];
+    [taskViewController addManagedStepIdentifier:@"other"];
+    [taskViewController setManagedResult:otherResult forKey:@"other"];
+    [taskViewController addManagedStepIdentifier:@"loop"];
+    [taskViewController setManagedResult:secondVisitResult forKey:@"loop"];
+    
+    ORKStepResult *storedFirstVisit = [taskViewController managedResultForKey:@"loop:0"];
+    ORKStepResult *storedSecondVisit = [taskViewController managedResultForKey:@"loop:2"];
+    XCTAssertEqualObjects(storedFirstVisit, firstVisitResult);
+    XCTAssertEqualObjects(storedSecondVisit, secondVisitResult);
+    XCTAssertNotEqual(storedFirstVisit.firstResult, storedSecondVisit.firstResult);
+    XCTAssertEqual([taskViewController managedResultForKey:@"loop"], storedSecondVisit);
+    XCTAssertTrue(storedFirstVisit.isPreviousResult);
+    // The results handed over keep their dates and children
+    XCTAssertEqualObjects(secondVisitResult.startDate, [NSDate dateWithTimeIntervalSinceReferenceDate:20]);
+    XCTAssertEqualObjects(secondVisitResult.firstResult.startDate, [NSDate dateWithTimeIntervalSinceReferenceDate:20]);
+    
+    // Both visits refer to one archive, and restoring gives each visit its own dates back
+    NSData *data = ORKManagedResultsArchive(taskViewController);
+    NSKeyedUnarchiver *unarchiver = [[NSKeyedUnarchiver alloc] initForReadingWithData:data];
+    XCTAssertEqual([[unarchiver decodeObjectForKey:@"managedResultArchives"] count], 2);
+    XCTAssertEqual([[unarchiver decodeObjectForKey:@"managedResultEntries"] count], 3);
+    [unarchiver finishDecoding];
+    
+    ORKTaskViewController *restoredViewController = ORKTaskViewControllerRestoringManagedResults(data);
+    XCTAssertEqualObjects([restoredViewController managedResultForKey:@"loop:0"], firstVisitResult);
+    XCTAssertEqualObjects([restoredViewController managedResultForKey:@"loop:2"], secondVisitResult);
+    XCTAssertEqualObjects([restoredViewController managedResultForKey:@"other:1"], otherResult);
+    XCTAssertEqual([restoredViewController managedResultForKey:@"loop"], [restoredViewController managedResultForKey:@"loop:2"]);
+}
+
+- (void)testManagedResultsRestoration {
+    ORKTaskViewController *taskViewController = ORKManagedResultsTaskViewController();
+    [taskViewController addManagedStepIdentifier:@"step"];
+    ORKBooleanQuestionResult *questionResult = [[ORKBooleanQuestionResult alloc] initWithIdentifier:@"question"];
+    questionResult.booleanAnswer = @YES;
+    ORKStepResult *stepResult = [[ORKStepResult alloc] initWithStepIdentifier:@"step" results:@[questionResult]];
+    [taskViewController setManagedResult:stepResult forKey:@"step"];
+    
+    ORKTaskViewController *restoredViewController = ORKTaskViewControllerRestoringManagedResults(ORKManagedResultsArchive(taskViewController));
+    ORKStepResult *restoredResult = [restoredViewController managedResultForKey:@"step"];
+    XCTAssertEqualObjects(restoredResult, stepResult);
+    // Both keys of the slot decode to one object
+    XCTAssertEqual([restoredViewController managedResultForKey:@"step:0"], restoredResult);
+    XCTAssertNil([restoredViewController managedResultForKey:@"other"]);
+}
+
+- (void)testManagedResultsStoreCopiesOfResults {
+    ORKTaskViewController *taskViewController = ORKManagedResultsTaskViewController();
+    ORKStepResult *stepResult = [[ORKStepResult alloc] initWithStepIdentifier:@"step" results:nil];
+    [taskViewController setManagedResult:stepResult forKey:@"step"];
+    ORKManagedResultsArchive(taskViewController);
+    
+    // Changing the result after handing it over reaches neither the stored result nor its archive
+    ORKTextQuestionResult *questionResult = [[ORKTextQuestionResult alloc] initWithIdentifier:@"question"];
+    questionResult.textAnswer = @"changed";
+    stepResult.results = @[questionResult];
+    XCTAssertEqualObjects([taskViewController managedResultForKey:@"step"].results, @[]);
+    
+    ORKTaskViewController *restoredViewController = ORKTaskViewControllerRestoringManagedResults(ORKManagedResultsArchive(taskViewController));
+    XCTAssertEqualObjects([restoredViewController managedResultForKey:@"step"].results, @[]);
+    
+    // A replaced result is archived again
+    [taskViewController setManagedResult:stepResult forKey:@"step"];
+    restoredViewController = ORKTaskViewControllerRestoringManagedResults(ORKManagedResultsArchive(taskViewController));
+    XCTAssertEqualObjects([restoredViewController managedResultForKey:@"step"].results, @[questionResult]);
+}
+
+- (void)testManagedResultsRestorationKeepsResultsNotLookedUp {
+    ORKTaskViewController *taskViewController = ORKManagedResultsTaskViewController();
+    ORKStepResult *firstResult = [[ORKStepResult alloc] initWithStepIdentifier:@"first" results:nil];
+    ORKStepResult *secondResult = [[ORKStepResult alloc] initWithStepIdentifier:@"second" results:nil];
+    [taskViewController setManagedResult:firstResult forKey:@"first"];
+    [taskViewController setManagedResult:secondResult forKey:@"second"];
+    
+    // Only one result is decoded before saving again; the other is written back from its archive
+    ORKTaskViewController *restoredViewController = ORKTaskViewControllerRestoringManagedResults(ORKManagedResultsArchive(taskViewController));
+    XCTAssertEqualObjects([restoredViewController managedResultForKey:@"first"], firstResult);
+    
+    ORKTaskViewController *resavedViewController = ORKTaskViewControllerRestoringManagedResults(ORKManagedResultsArchive(restoredViewController));
+    XCTAssertEqualObjects([resavedViewController managedResultForKey:@"second"], secondResult);
+    XCTAssertEqualObjects([resavedViewController managedResultForKey:@"first"], firstResult);
+}
+
+- (void)testTaskResultDecodesArchivedResultsWhenRead {
+    ORKStepResult *firstResult = [[ORKStepResult alloc] initWithStepIdentifier:@"first" results:nil];
+    NSMutableData *data = [NSMutableData new];
+    NSKeyedArchiver *archiver = [[NSKeyedArchiver alloc] initForWritingWithMutableData:data];
+    // The second archive does not hold a step result, so reading its slot is visible in the task result
+    [archiver encodeObject:@[[NSKeyedArchiver archivedDataWithRootObject:firstResult], [NSKeyedArchiver archivedDataWithRootObject:@"second"]]
+                    forKey:@"managedResultArchives"];
+    [archiver encodeObject:@{ @"first" : @0, @"first:0" : @0, @"second" : @1, @"second:0" : @1 } forKey:@"managedResultIndexes"];
+    [archiver finishEncoding];
+    
+    ORKTaskViewController *restoredViewController = ORKTaskViewControllerRestoringManagedResults(data);
+    [restoredViewController addManagedStepIdentifier:@"first"];
+    [restoredViewController addManagedStepIdentifier:@"second"];
+    NSArray<ORKStepResult *> *results = [restoredViewController result].results;
+    XCTAssertEqual(results.count, 2);
+    XCTAssertEqualObjects(results.firstObject, firstResult);
+    XCTAssertEqual(results.firstObject, [restoredViewController managedResultForKey:@"first"]);
+    XCTAssertEqualObjects(results.lastObject.identifier, @"second");
+    XCTAssertEqualObjects(results.lastObject.results, @[]);
+    XCTAssertNil([restoredViewController managedResultForKey:@"second"]);
+}
+
+- (void)testManagedResultsRestorationFromLegacyArchive {
+    ORKStepResult *stepResult = [[ORKStepResult alloc] initWithStepIdentifier:@"step" results:nil];
+    NSMutableData *data = [NSMutableData new];
+    NSKeyedArchiver *archiver = [[NSKeyedArchiver alloc] initForWritingWithMutableData:data];
+    [archiver encodeObject:[@{ @"step" : stepResult, @"step:0" : stepResult } mutableCopy] forKey:@"managedResults"];
+    [archiver finishEncoding];
+    
+    ORKTaskViewController *restoredViewController = ORKTaskViewControllerRestoringManagedResults(data);
+    ORKStepResult *restoredResult = [restoredViewController managedResultForKey:@"step"];
+    XCTAssertEqualObjects(restoredResult, stepResult);
+    XCTAssertEqual([restoredViewController managedResultForKey:@"step:0"], restoredResult);
+}
+
+- (void)testManagedResultsSnapshot {
+    ORKOrderedTask *task = [[ORKOrderedTask alloc] initWithIdentifier:@"task" steps:@[[[ORKInstructionStep alloc] initWithIdentifier:@"first"],
+                                                                                     [[ORKInstructionStep alloc] initWithIdentifier:@"second"]]];
+    ORKTaskViewController *taskViewController = [[ORKTaskViewController alloc] initWithTask:task taskRunUUID:nil];
+    ORKStepResult *firstResult = [[ORKStepResult alloc] initWithStepIdentifier:@"first" results:nil];
+    ORKStepResult *secondResult = [[ORKStepResult alloc] initWithStepIdentifier:@"second" results:nil];
+    XCTAssertEqualObjects([taskViewController managedResults], @[]);
+    
+    [taskViewController addManagedStepIdentifier:@"first"];
+    [taskViewController setManagedResult:firstResult forKey:@"first"];
+    [taskViewController addManagedStepIdentifier:@"second"];
+    [taskViewController setManagedResult:secondResult forKey:@"second"];
+    NSArray *snapshot = [taskViewController managedResults];
+    XCTAssertEqualObjects(snapshot, (@[firstResult, secondResult]));
+    XCTAssertEqual([taskViewController managedResults], snapshot);
+    
+    // Restoring keeps the results in step order and has no empty slots
+    ORKTaskViewController *restoredViewController = [[ORKTaskViewController alloc] initWithTask:task restorationData:[taskViewController restorationData] delegate:nil];
+    XCTAssertEqualObjects([restoredViewController managedResults], (@[firstResult, secondResult]));
+    
+    [taskViewController removeLastManagedStepIdentifier];
+    XCTAssertEqualObjects([taskViewController managedResults], @[firstResult]);
+    
+    // Going forward again picks up the result stored for the slot
+    [taskViewController addManagedStepIdentifier:@"second"];
+    XCTAssertEqualObjects([taskViewController managedResults], (@[firstResult, secondResult]));
+    
+    [taskViewController removeAllManagedStepIdentifiers];
+    XCTAssertEqualObjects([taskViewController managedResults], @[]);
+    XCTAssertEqualObjects([taskViewController result].results, @[]);
+}
+
 - (void)testIndexOfStep {
     ORKOrderedTask *task = [ORKOrderedTask twoFingerTappingIntervalTaskWithIdentifier:@"tapping" intendedUseDescription:nil duration:30 handOptions:0 options:0];
     
@@ -574,6 +574,54 @@
     }
 }
 
+- (void)testFilteredChoices {
+    NSArray *choices = @[[ORKTextChoice choiceWithText:@"Apple" value:@"apple"],
+                         [ORKTextChoice choiceWithText:@"Apricot" value:@"apricot"],
+                         [ORKTextChoice choiceWithText:@"Banana" value:@"banana"],
+                         [ORKTextChoice choiceWithText:@"Crème brûlée" value:@"creme"],
+                         [ORKTextChoice choiceWithText:@"Pineapple" value:@"pineapple"]];
+    ORKTextChoiceAnswerFormat *answerFormat = [ORKTextChoiceAnswerFormat choiceAnswerFormatWithStyle:ORKChoiceAnswerStyleMultipleChoice textChoices:choices];
+    ORKTextChoiceCellGroup *group = [[ORKTextChoiceCellGroup alloc] initWithTextChoiceAnswerFormat:answerFormat
+                                                                                            answer:nil
+                                                                                beginningIndexPath:[NSIndexPath indexPathForRow:0 inSection:0]
+                                                                               immediateNavigation:NO];
+    XCTAssertEqual(group.size, choices.count);
+    
+    // Short queries match word prefixes
+    group.filterQuery = @"ap";
+    XCTAssertEqual(group.size, 2);
+    XCTAssertEqual([group choiceIndexAtIndexPath:[NSIndexPath indexPathForRow:0 inSection:0]], 0);
+    XCTAssertEqual([group choiceIndexAtIndexPath:[NSIndexPath indexPathForRow:1 inSection:0]], 1);
+    XCTAssertEqual([group choiceIndexAtIndexPath:[NSIndexPath indexPathForRow:2 inSection:0]], NSNotFound);
+    
+    // Longer queries match anywhere in the text, ignoring case and diacritics
+    group.filterQuery = @"APPLE";
+    XCTAssertEqual(group.size, 2);
+    XCTAssertEqual([group choiceIndexAtIndexPath:[NSIndexPath indexPathForRow:1 inSection:0]], 4);
+    group.filterQuery = @"creme";
+    XCTAssertEqual(group.size, 1);
+    XCTAssertEqual([group choiceIndexAtIndexPath:[NSIndexPath indexPathForRow:0 inSection:0]], 3);
+    
+    // Selecting a filtered row selects the underlying choice
+    group.filterQuery = @"banana";
+    [group didSelectCellAtIndexPath:[NSIndexPath indexPathForRow:0 inSection:0]];
+    XCTAssertEqualObjects(group.answer, @[@"banana"]);
+    
+    // A reused cell reflects the choice it is bound to
+    ORKChoiceViewCell *cell = [group cellAtIndexPath:[NSIndexPath indexPathForRow:0 inSection:0] reusingCell:nil withReuseIdentifier:@"abc"];
+    XCTAssertTrue(cell.selectedItem);
+    group.filterQuery = nil;
+    XCTAssertEqual(group.size, choices.count);
+    ORKChoiceViewCell *reusedCell = [group cellAtIndexPath:[NSIndexPath indexPathForRow:0 inSection:0] reusingCell:cell withReuseIdentifier:@"abc"];
+    XCTAssertEqual(reusedCell, cell);
+    XCTAssertFalse(reusedCell.selectedItem);
+    
+    // The selection survives filtering
+    [group didSelectCellAtIndexPath:[NSIndexPath indexPathForRow:0 inSection:0]];
+    XCTAssertTrue(reusedCell.selectedItem);
+    XCTAssertEqualObjects(group.answer, (@[@"apple", @"banana"]));
+}
+
 - (void)testMultiChoiceWithAllExclusives {
     // All exclusives should behave exactly like single choice mode, so use that test method
     NSArray *choices = [self textChoicesWithAllExclusives];
@@ -32,8 +32,6 @@
 @import XCTest;
 @import ResearchKit.Private;
 
-#import "ORKESerialization.h"
-
 #import <objc/runtime.h>
 
 
@@ -317,19 +315,68 @@ ORK_MAKE_TEST_INIT(NSRegularExpression, (^{
 
     ORKOrderedTask *task = [[ORKOrderedTask alloc] initWithIdentifier:@"id" steps:@[activeStep, questionStep, questionStep2, questionStep3]];
     
-    NSDictionary *dict1 = [ORKESerializer JSONObjectForObject:task error:nil];
+    NSDictionary *dict1 = [ORKJSONSerializer JSONObjectForObject:task error:nil];
     
     NSData *data = [NSJSONSerialization dataWithJSONObject:dict1 options:NSJSONWritingPrettyPrinted error:nil];
     NSString *tempPath = [NSTemporaryDirectory() stringByAppendingPathComponent:[[NSUUID UUID].UUIDString stringByAppendingPathExtension:@"json"]];
     [data writeToFile:tempPath atomically:YES];
     NSLog(@"JSON file at %@", tempPath);
     
-    ORKOrderedTask *task2 = [ORKESerializer objectFromJSONObject:dict1 error:nil];
+    ORKOrderedTask *task2 = [ORKJSONSerializer objectFromJSONObject:dict1 error:nil];
     
-    NSDictionary *dict2 = [ORKESerializer JSONObjectForObject:task2 error:nil];
+    NSDictionary *dict2 = [ORKJSONSerializer JSONObjectForObject:task2 error:nil];
     
     XCTAssertTrue([dict1 isEqualToDictionary:dict2], @"Should be equal");
+
+    NSError *error = nil;
+    NSData *streamedData = [ORKJSONSerializer JSONDataForObject:task error:&error];
+    XCTAssertNotNil(streamedData, @"%@", error);
+    XCTAssertEqualObjects([NSJSONSerialization JSONObjectWithData:streamedData options:0 error:nil], dict1);
+
+    NSOutputStream *stream = [NSOutputStream outputStreamToMemory];
+    [stream open];
+    XCTAssertTrue([ORKJSONSerializer writeObject:task toStream:stream error:&error], @"%@", error);
+    [stream close];
+    XCTAssertEqualObjects([stream propertyForKey:NSStreamDataWrittenToMemoryStreamKey], streamedData);
+
+    ORKOrderedTask *task3 = [ORKJSONSerializer objectFromJSONData:streamedData error:&error];
+    XCTAssertEqualObjects(task3, task);
+
+    XCTAssertNil([ORKJSONSerializer objectFromJSONObject:@{@"_class": @"ORKNotAClass"} error:&error]);
+    XCTAssertEqualObjects(error.domain, ORKErrorDomain);
+    XCTAssertEqual(error.code, ORKErrorInvalidObject);
+    
+    NSMutableDictionary *invalidSteps = [dict1 mutableCopy];
+    invalidSteps[@"steps"] = @{@"identifier": @"id1"};
+    error = nil;
+    XCTAssertNil([ORKJSONSerializer objectFromJSONObject:invalidSteps error:&error]);
+    XCTAssertEqual(error.code, ORKErrorInvalidObject);
     
+    NSMutableDictionary *unexpectedProperty = [dict1 mutableCopy];
+    unexpectedProperty[@"notAProperty"] = @YES;
+    error = nil;
+    XCTAssertNil([ORKJSONSerializer objectFromJSONObject:unexpectedProperty error:&error]);
+    XCTAssertEqual(error.code, ORKErrorInvalidObject);
+}
+
+- (void)testRegistrationWhileEncoding {
+    ORKOrderedTask *task = [[ORKOrderedTask alloc] initWithIdentifier:@"id" steps:@[[[ORKInstructionStep alloc] initWithIdentifier:@"step"]]];
+    NSDictionary *expected = [ORKJSONSerializer JSONObjectForObject:task error:NULL];
+    
+    dispatch_apply(100, dispatch_get_global_queue(QOS_CLASS_DEFAULT, 0), ^(size_t iteration) {
+        if (iteration % 10 == 0) {
+            [ORKJSONSerializer registerSerializableClassPropertyName:@"text"
+                                                            forClass:[ORKStep class]
+                                                          valueClass:[NSString class]
+                                                      containerClass:[NSObject class]
+                                                      writeAfterInit:YES
+                                                   objectToJSONBlock:nil
+                                                   jsonToObjectBlock:nil];
+        } else {
+            NSError *error = nil;
+            XCTAssertEqualObjects([ORKJSONSerializer JSONObjectForObject:task error:&error], expected, @"%@", error);
+        }
+    });
 }
 
 - (NSArray<Class> *)classesWithSecureCoding {
@@ -364,27 +411,27 @@ ORK_MAKE_TEST_INIT(NSRegularExpression, (^{
 - (void)testORKSerialization {
     
     // Find all classes that are serializable this way
-    NSArray *classesWithORKSerialization = [ORKESerializer serializableClasses];
+    NSArray *classesWithORKSerialization = [ORKJSONSerializer serializableClasses];
     
-    // All classes that conform to NSSecureCoding should also support ORKESerialization
+    // All classes that conform to NSSecureCoding should also support ORKJSONSerialization
     NSArray *classesWithSecureCoding = [self classesWithSecureCoding];
     
-    NSArray *classesExcludedForORKESerialization = @[
-                                                     [ORKStepNavigationRule class],     // abstract base class
-                                                     [ORKSkipStepNavigationRule class],     // abstract base class
-                                                     [ORKStepModifier class],     // abstract base class
-                                                     [ORKPredicateSkipStepNavigationRule class],     // NSPredicate doesn't yet support JSON serialzation
-                                                     [ORKKeyValueStepModifier class],     // NSPredicate doesn't yet support JSON serialzation
-                                                     [ORKCollector class], // ORKCollector doesn't support JSON serialzation
-                                                     [ORKHealthCollector class],
-                                                     [ORKHealthCorrelationCollector class],
-                                                     [ORKMotionActivityCollector class]
-                                                     ];
+    NSArray *classesExcludedForORKJSONSerialization = @[
+                                                        [ORKStepNavigationRule class],     // abstract base class
+                                                        [ORKSkipStepNavigationRule class],     // abstract base class
+                                                        [ORKStepModifier class],     // abstract base class
+                                                        [ORKPredicateSkipStepNavigationRule class],     // NSPredicate doesn't yet support JSON serialzation
+                                                        [ORKKeyValueStepModifier class],     // NSPredicate doesn't yet support JSON serialzation
+                                                        [ORKCollector class], // ORKCollector doesn't support JSON serialzation
+                                                        [ORKHealthCollector class],
+                                                        [ORKHealthCorrelationCollector class],
+                                                        [ORKMotionActivityCollector class]
+                                                        ];
     
-    if ((classesExcludedForORKESerialization.count + classesWithORKSerialization.count) != classesWithSecureCoding.count) {
+    if ((classesExcludedForORKJSONSerialization.count + classesWithORKSerialization.count) != classesWithSecureCoding.count) {
         NSMutableArray *unregisteredList = [classesWithSecureCoding mutableCopy];
         [unregisteredList removeObjectsInArray:classesWithORKSerialization];
-        [unregisteredList removeObjectsInArray:classesExcludedForORKESerialization];
+        [unregisteredList removeObjectsInArray:classesExcludedForORKJSONSerialization];
         XCTAssertEqual(unregisteredList.count, 0, @"Classes didn't implement ORKSerialization %@", unregisteredList);
     }
     
@@ -415,7 +462,9 @@ ORK_MAKE_TEST_INIT(NSRegularExpression, (^{
                                               @"ORKConsentSection.customImage",
                                               @"ORKConsentSection.escapedContent",
                                               @"ORKConsentSignature.signatureImage",
+                                              @"ORKConsentSignature.signatureImageData",
                                               @"ORKConsentDocument.writer",
+                                              @"ORKConsentDocument.composer",
                                               @"ORKConsentDocument.signatureFormatter",
                                               @"ORKConsentDocument.sectionFormatter",
                                               @"ORKConsentDocument.sections",
@@ -458,7 +507,9 @@ ORK_MAKE_TEST_INIT(NSRegularExpression, (^{
                                               @"ORKRegistrationStep.passcodeValidationRegularExpression",
                                               @"ORKRegistrationStep.passcodeInvalidMessage",
                                               @"ORKSignatureResult.signatureImage",
+                                              @"ORKSignatureResult.signatureImageData",
                                               @"ORKSignatureResult.signaturePath",
+                                              @"ORKSignatureResult.strokes",
                                               @"ORKPageStep.steps",
                                               @"ORKNavigablePageStep.steps",
                                               ];
@@ -533,7 +584,7 @@ ORK_MAKE_TEST_INIT(NSRegularExpression, (^{
         }
         
         // Serialization
-        id mockDictionary = [[MockCountingDictionary alloc] initWithDictionary:[ORKESerializer JSONObjectForObject:instance error:NULL]];
+        id mockDictionary = [[MockCountingDictionary alloc] initWithDictionary:[ORKJSONSerializer JSONObjectForObject:instance error:NULL]];
         
         // Must contain corrected _class field
         XCTAssertTrue([NSStringFromClass(aClass) isEqualToString:mockDictionary[@"_class"]]);
@@ -551,7 +602,7 @@ ORK_MAKE_TEST_INIT(NSRegularExpression, (^{
         
         [mockDictionary startObserving];
        
-        id instance2 = [ORKESerializer objectFromJSONObject:mockDictionary error:NULL];
+        id instance2 = [ORKJSONSerializer objectFromJSONObject:mockDictionary error:NULL];
        
         NSArray *unTouchedKeys = [mockDictionary unTouchedKeys];
         
@@ -563,7 +614,7 @@ ORK_MAKE_TEST_INIT(NSRegularExpression, (^{
         [mockDictionary stopObserving];
         
         // Serialize again, the output ought to be equal
-        NSDictionary *dictionary2 = [ORKESerializer JSONObjectForObject:instance2 error:NULL];
+        NSDictionary *dictionary2 = [ORKJSONSerializer JSONObjectForObject:instance2 error:NULL];
         BOOL isMatch = [mockDictionary isEqualToDictionary:dictionary2];
         if (!isMatch) {
             XCTAssertTrue(isMatch, @"Should be equal for class: %@", NSStringFromClass(aClass));
@@ -657,6 +708,7 @@ ORK_MAKE_TEST_INIT(NSRegularExpression, (^{
                                        @"ORKRegistrationStep.passcodeValidationRegex",
                                        ];
     NSArray *knownNotSerializedProperties = @[@"ORKConsentDocument.writer", // created on demand
+                                              @"ORKConsentDocument.composer", // created on demand
                                               @"ORKConsentDocument.signatureFormatter", // created on demand
                                               @"ORKConsentDocument.sectionFormatter", // created on demand
                                               @"ORKStep.task", // weak ref - object will be nil
@@ -680,6 +732,7 @@ ORK_MAKE_TEST_INIT(NSRegularExpression, (^{
                                               @"ORKImageCaptureStep.templateImage",
                                               @"ORKVideoCaptureStep.templateImage",
                                               @"ORKConsentSignature.signatureImage",
+                                              @"ORKConsentSignature.signatureImageData",
                                               @"ORKConsentSection.customImage",
                                               @"ORKInstructionStep.image",
                                               @"ORKInstructionStep.auxiliaryImage",
@@ -691,7 +744,9 @@ ORK_MAKE_TEST_INIT(NSRegularExpression, (^{
                                               @"ORKContinuousScaleAnswerFormat.minimumImage",
                                               @"ORKContinuousScaleAnswerFormat.maximumImage",
                                               @"ORKSignatureResult.signatureImage",
+                                              @"ORKSignatureResult.signatureImageData",
                                               @"ORKSignatureResult.signaturePath",
+                                              @"ORKSignatureResult.strokes",
                                               @"ORKPageStep.steps",
                                               @"ORKNavigablePageStep.steps",
                                               ];